@@ -0,0 +1,89 @@
+//This file is part of Bertini 2.
+//
+//example/performance_numbers/src/mpfr_lu.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//example/performance_numbers/src/mpfr_lu.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with example/performance_numbers/src/mpfr_lu.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "bertini2/mpfr_lu.hpp"
+
+
+using namespace bertini;
+
+
+/**
+ Microseconds per factor-and-solve, over enough repetitions to take about a tenth of a second.
+ */
+template<typename LUT>
+double MicrosecondsPerSolve(LUT & lu, Mat<mpfr_complex> const& A, Vec<mpfr_complex> const& b, Vec<mpfr_complex> & x)
+{
+	unsigned num_solves = 0;
+	auto start = std::chrono::steady_clock::now();
+	auto end = start;
+	do
+	{
+		lu.compute(A);
+		x = lu.solve(b);
+		++num_solves;
+		end = std::chrono::steady_clock::now();
+	}
+	while (std::chrono::duration<double>(end-start).count() < 0.1);
+
+	return std::chrono::duration<double, std::micro>(end-start).count() / num_solves;
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_size = argc > 1 ? std::stoi(argv[1]) : 200; ///> the largest matrix to factor
+
+	std::cout << std::setw(8) << "digits" << std::setw(8) << "n"
+	          << std::setw(14) << "Eigen (us)" << std::setw(14) << "MPC (us)" << std::setw(10) << "speedup" << std::setw(14) << "difference" << "\n";
+
+	for (unsigned digits : {30, 64, 128})
+	{
+		DefaultPrecision(digits);
+		for (unsigned size : {10, 20, 50, 100, 200})
+		{
+			if (size > max_size)
+				break;
+
+			Mat<mpfr_complex> A = RandomOfUnits<mpfr_complex>(size, size);
+			Vec<mpfr_complex> b = RandomOfUnits<mpfr_complex>(size);
+			Vec<mpfr_complex> x_eigen, x_mpc;
+
+			Eigen::PartialPivLU<Mat<mpfr_complex>> eigen_lu(size);
+			MPFRPartialPivLU mpc_lu(size);
+
+			auto eigen_time = MicrosecondsPerSolve(eigen_lu, A, b, x_eigen);
+			auto mpc_time = MicrosecondsPerSolve(mpc_lu, A, b, x_mpc);
+
+			std::cout << std::setw(8) << digits << std::setw(8) << size
+			          << std::setw(14) << eigen_time << std::setw(14) << mpc_time << std::setw(10) << eigen_time/mpc_time
+			          << std::setw(14) << static_cast<double>((x_eigen-x_mpc).template lpNorm<Eigen::Infinity>()) << std::endl;
+		}
+	}
+
+	return 0;
+}
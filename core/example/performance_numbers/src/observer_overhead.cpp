@@ -0,0 +1,140 @@
+//This file is part of Bertini 2.
+//
+//example/performance_numbers/src/observer_overhead.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//example/performance_numbers/src/observer_overhead.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with example/performance_numbers/src/observer_overhead.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "bertini2/trackers/amp_tracker.hpp"
+#include "bertini2/trackers/observers.hpp"
+
+
+using namespace bertini;
+using namespace bertini::tracking;
+
+using dbl = std::complex<double>;
+
+
+/**
+ Emits the events of a successful tracker step, either the old way, building each one and handing it to every observer, or through Emit.
+ */
+struct StepEmitter : public Observable
+{
+	void StepNotifyingAll(AMPTracker const& tracker, Vec<dbl> const& point) const
+	{
+		NotifyObservers(NewStep<AMPTracker>(tracker));
+		NotifyObservers(SuccessfulPredict<AMPTracker, dbl>(tracker, point));
+		NotifyObservers(SuccessfulCorrect<AMPTracker, dbl>(tracker, point));
+		NotifyObservers(SuccessfulStep<AMPTracker>(tracker));
+	}
+
+	void StepEmitting(AMPTracker const& tracker, Vec<dbl> const& point) const
+	{
+		Emit<NewStep<AMPTracker>>(tracker);
+		Emit<SuccessfulPredict<AMPTracker, dbl>>(tracker, point);
+		Emit<SuccessfulCorrect<AMPTracker, dbl>>(tracker, point);
+		Emit<SuccessfulStep<AMPTracker>>(tracker);
+	}
+};
+
+
+template<typename StepT>
+double NanosecondsPerStep(unsigned num_steps, StepT const& step)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned ii = 0; ii < num_steps; ++ii)
+		step();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end-start).count() / num_steps;
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_steps = argc > 1 ? std::stoi(argv[1]) : 10000000; ///> number of simulated steps per measurement
+
+	DefaultPrecision(16);
+
+	auto x = node::Variable::Make("x");
+	auto y = node::Variable::Make("y");
+	auto t = node::Variable::Make("t");
+
+	System sys;
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(VariableGroup{x,y});
+
+	AMPTracker tracker(sys);
+	tracker.Setup(Predictor::RK4, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMPConfigFrom(sys));
+
+	Vec<dbl> point(2);
+	point << dbl(1), dbl(1);
+
+	FirstPrecisionRecorder<AMPTracker> first_precision;
+	MinMaxPrecisionRecorder<AMPTracker> min_max_precision;
+
+
+	StepEmitter unobserved;
+
+	StepEmitter recorded;
+	recorded.AddObserver(first_precision);
+	recorded.AddObserver(min_max_precision);
+
+	StaticObservers<FirstPrecisionRecorder<AMPTracker>, MinMaxPrecisionRecorder<AMPTracker>> static_recorded(first_precision, min_max_precision);
+	auto static_step = [&]()
+	{
+		static_recorded.Emit<NewStep<AMPTracker>>(tracker);
+		static_recorded.Emit<SuccessfulPredict<AMPTracker, dbl>>(tracker, point);
+		static_recorded.Emit<SuccessfulCorrect<AMPTracker, dbl>>(tracker, point);
+		static_recorded.Emit<SuccessfulStep<AMPTracker>>(tracker);
+	};
+
+
+	std::cout << "nanoseconds per step, emitting the 4 events of a successful step, " << num_steps << " steps\n\n";
+	std::cout << std::setw(40) << "" << std::setw(18) << "NotifyObservers" << std::setw(18) << "Emit" << "\n";
+	std::cout << std::setw(40) << "no observers"
+	          << std::setw(18) << NanosecondsPerStep(num_steps, [&](){ unobserved.StepNotifyingAll(tracker, point);})
+	          << std::setw(18) << NanosecondsPerStep(num_steps, [&](){ unobserved.StepEmitting(tracker, point);}) << "\n";
+	std::cout << std::setw(40) << "ZeroDim's precision recorders"
+	          << std::setw(18) << NanosecondsPerStep(num_steps, [&](){ recorded.StepNotifyingAll(tracker, point);})
+	          << std::setw(18) << NanosecondsPerStep(num_steps, [&](){ recorded.StepEmitting(tracker, point);}) << "\n";
+	std::cout << std::setw(40) << "precision recorders, StaticObservers"
+	          << std::setw(18) << ""
+	          << std::setw(18) << NanosecondsPerStep(num_steps, static_step) << "\n";
+
+
+	// for scale, how long an actual step takes
+	Vec<mpfr_complex> start_point(2), end_point;
+	start_point << mpfr_complex(1), mpfr_complex(1);
+
+	auto start = std::chrono::steady_clock::now();
+	tracker.TrackPath(end_point, mpfr_complex(1), mpfr_complex(1)/mpfr_complex(2), start_point);
+	auto end = std::chrono::steady_clock::now();
+
+	std::cout << "\nfor scale, tracking a path in 2 variables took " << std::chrono::duration<double, std::nano>(end-start).count() / tracker.NumTotalStepsTaken() << " nanoseconds per step\n";
+
+	return 0;
+}
@@ -0,0 +1,136 @@
+//This file is part of Bertini 2.
+//
+//example/performance_numbers/src/parsing_throughput.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//example/performance_numbers/src/parsing_throughput.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with example/performance_numbers/src/parsing_throughput.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include "bertini2/io/parsing/system_parsers.hpp"
+#include "bertini2/io/parsing/fast_system_parser.hpp"
+
+
+/**
+ Write a random polynomial system in Bertini Classic format, with the given number of terms per function.  Each term is a floating point coefficient times a product of powers of a few variables.
+ */
+std::string SyntheticInput(unsigned num_variables, unsigned num_functions, unsigned num_terms)
+{
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<unsigned> variable(0, num_variables-1);
+	std::uniform_int_distribution<int> degree(1, 3);
+	std::uniform_int_distribution<int> num_factors(1, 4);
+	std::uniform_real_distribution<double> coefficient(-1, 1);
+
+	std::stringstream input;
+	input << std::setprecision(17);
+
+	input << "variable_group ";
+	for (unsigned ii = 0; ii < num_variables; ++ii)
+		input << (ii ? ", " : "") << "x" << ii;
+	input << ";\nfunction ";
+	for (unsigned ii = 0; ii < num_functions; ++ii)
+		input << (ii ? ", " : "") << "f" << ii;
+	input << ";\n";
+
+	for (unsigned ii = 0; ii < num_functions; ++ii)
+	{
+		input << "f" << ii << " = ";
+		for (unsigned jj = 0; jj < num_terms; ++jj)
+		{
+			auto c = coefficient(gen);
+			input << (jj ? (c < 0 ? " - " : " + ") : (c < 0 ? "-" : "")) << std::abs(c);
+			for (int kk = num_factors(gen); kk > 0; --kk)
+			{
+				input << "*x" << variable(gen);
+				auto d = degree(gen);
+				if (d > 1)
+					input << "^" << d;
+			}
+		}
+		input << ";\n";
+	}
+
+	return input.str();
+}
+
+
+template<typename ParseT>
+double SecondsToParse(ParseT const& parse)
+{
+	auto start = std::chrono::steady_clock::now();
+	auto sys = parse();
+	auto end = std::chrono::steady_clock::now();
+	if (sys.NumNaturalFunctions()==0)
+		throw std::runtime_error("parsed an empty system");
+	return std::chrono::duration<double>(end-start).count();
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_variables = argc > 1 ? std::stoi(argv[1]) : 20; ///> number of variables in the generated systems
+	unsigned num_functions = argc > 2 ? std::stoi(argv[2]) : 20; ///> number of functions in the generated systems
+	unsigned max_terms = argc > 3 ? std::stoi(argv[3]) : 100000; ///> the largest number of terms per function
+
+	double qi_time_limit = 60; ///> once the Qi grammar takes this many seconds, stop timing it
+
+	bertini::parsing::classic::FastSystemParser serial(1), parallel;
+
+	auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+	std::cout << std::setw(10) << "terms" << std::setw(12) << "MB"
+	          << std::setw(14) << "qi (s)" << std::setw(14) << "fast (s)" << std::setw(14) << "threads (s)" << std::setw(14) << "mapped (s)"
+	          << std::setw(12) << "qi MB/s" << std::setw(12) << "fast MB/s" << std::setw(12) << "speedup" << "\n";
+
+	bool time_qi = true;
+	for (unsigned num_terms = 10; num_terms <= max_terms; num_terms *= 10)
+	{
+		auto input = SyntheticInput(num_variables, num_functions, num_terms);
+		{
+			std::ofstream out(path.string());
+			out << input;
+		}
+		double megabytes = input.size()/1e6;
+
+		double qi_seconds = std::numeric_limits<double>::quiet_NaN();
+		if (time_qi)
+		{
+			qi_seconds = SecondsToParse([&](){ bertini::System sys; bertini::parsing::classic::parse(input.cbegin(), input.cend(), sys); return sys;});
+			time_qi = qi_seconds < qi_time_limit;
+		}
+
+		auto serial_seconds = SecondsToParse([&](){ return serial.Parse(input);});
+		auto parallel_seconds = SecondsToParse([&](){ return parallel.Parse(input);});
+		auto mapped_seconds = SecondsToParse([&](){ return parallel.ParseFile(path);});
+
+		std::cout << std::setw(10) << num_terms << std::setw(12) << megabytes
+		          << std::setw(14) << qi_seconds << std::setw(14) << serial_seconds << std::setw(14) << parallel_seconds << std::setw(14) << mapped_seconds
+		          << std::setw(12) << megabytes/qi_seconds << std::setw(12) << megabytes/mapped_seconds << std::setw(12) << qi_seconds/mapped_seconds << std::endl;
+	}
+
+	boost::filesystem::remove(path);
+	return 0;
+}
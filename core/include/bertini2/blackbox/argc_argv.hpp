@@ -28,14 +28,41 @@
 
 #pragma once
 
+#include <string>
+
+#include "bertini2/io/file_utilities.hpp"
+
 namespace bertini{
 
+namespace blackbox{
+
+/**
+\brief The options the program was invoked with.
+*/
+struct ProgramOptions
+{
+	Path input_file = "input"; ///< The Bertini Classic input file to solve.
+	Path output_directory = "."; ///< Where to write the main_data and raw_data files.
+	unsigned num_threads = 0; ///< The number of threads to parse and track with.  0 means use as many as the hardware supports.
+	Path cache_directory = ".bertini_cache"; ///< Where to cache parsed and set up systems, so later runs on the same input skip that work.  Empty to not cache.
+	bool print_help = false; ///< Print the usage and stop, rather than solving.
+};
+
+/**
+\brief The usage message for the program.
+*/
+std::string Usage();
+
+} // namespace blackbox
+
 /**
 Main initial function for doing stuff to interpret the command-line arguments for invokation of the program.
 
 \param argc The number of arguments to the program.  Must be at least one.
 \param argv array of character arrays, the arguments to the program when called.
+\return The options, with defaults for those not given.
+\throws std::runtime_error if an argument is unknown or malformed.
 */
-void ParseArgcArgv(int argc, char** argv);
+blackbox::ProgramOptions ParseArgcArgv(int argc, char** argv);
 
 } //namespace bertini
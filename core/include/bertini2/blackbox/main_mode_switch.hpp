@@ -30,11 +30,19 @@
 
 #pragma once
 
-
+#include "bertini2/blackbox/argc_argv.hpp"
 
 
 namespace bertini{
 
-	void MainModeSwitch();
-}
+	/**
+	\brief Solve the input file named in the options, and write the results.
+
+	Reads a Bertini Classic input file, builds the algorithm its config asks for, runs it with the number of threads from the options, writes main_data and raw_data to the output directory, and prints a summary of the timing and throughput.
 
+	Unless the options say not to, the parsed target system, and the start system and homotopy set up from it, are kept in a SystemCache keyed on the contents of the input file.  A later run on the same file loads them instead of parsing, differentiating and compiling again, and so reuses their random numbers.
+
+	\throws std::runtime_error if the input can't be read, asks for something not yet supported, or the results can't be written.
+	*/
+	void MainModeSwitch(blackbox::ProgramOptions const& options);
+}
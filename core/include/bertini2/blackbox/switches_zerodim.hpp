@@ -34,6 +34,9 @@
 
 #include "bertini2/system.hpp"
 #include "bertini2/nag_algorithms/zero_dim_solve.hpp"
+#include "bertini2/nag_algorithms/output.hpp"
+#include "bertini2/io/parsing/settings_parsers.hpp"
+#include "bertini2/io/system_cache.hpp"
 #include "bertini2/endgames.hpp"
 
 #include "bertini2/blackbox/config.hpp"
@@ -52,36 +55,134 @@ struct ZeroDimRT
 };
 
 
+/**
+\brief A zero dim algorithm whose concrete type was chosen at runtime, which can write its own results as it solves.
+*/
+struct AnyZeroDimRun : public virtual algorithm::AnyZeroDim
+{
+	virtual ~AnyZeroDimRun() = default;
+
+	/**
+	\brief Take the settings from the config section of a Bertini Classic input file.  Settings not given there take their default values.
+	*/
+	virtual void ApplyClassicConfig(std::string const& config) = 0;
+
+	/**
+	\brief Use the target system, start system and homotopy cached under a key, or cache those set up at construction if there are none, with the homotopy differentiated and compiled first so that is cached too.
+
+	Call before ApplyClassicConfig, since using cached systems sets the tracker's precision settings anew.
+	*/
+	virtual void UseCachedSystems(SystemCache const& cache, std::string const& key) = 0;
+
+	/**
+	\brief Solve, writing the results in the formats of Bertini Classic's main_data and raw_data files.
+
+	Each path is written to raw_data as its endgame finishes, in the order they finish.  main_data needs the multiplicities, which are known only once every path is done, so it is written after the solve.
+	*/
+	virtual void RunWritingClassic(std::ostream & main_data, std::ostream & raw_data) = 0;
+};
+
+
+/**
+\brief Attaches the Classic output writer to a concrete zero dim algorithm.
+*/
+template <typename ZeroDimT>
+struct ZeroDimRun : public ZeroDimT, public AnyZeroDimRun
+{
+	using ZeroDimT::ZeroDimT;
+
+	void ApplyClassicConfig(std::string const& config) override
+	{
+		using parsing::classic::FillConfigStruct;
+		using ZeroDimConf = typename ZeroDimT::ZeroDimConf;
+
+		auto tolerances = FillConfigStruct<algorithm::TolerancesConfig>(config);
+		this->Set(tolerances);
+		this->Set(FillConfigStruct<algorithm::PostProcessingConfig>(config));
+		this->Set(FillConfigStruct<algorithm::AutoRetrackConfig>(config));
+
+		// the path variable was named when the homotopy was made, and the threads come from the command line
+		auto zero_dim = FillConfigStruct<ZeroDimConf>(config);
+		zero_dim.path_variable_name = this->template Get<ZeroDimConf>().path_variable_name;
+		zero_dim.num_threads = this->template Get<ZeroDimConf>().num_threads;
+		this->Set(zero_dim);
+
+		this->SetMidpath(FillConfigStruct<algorithm::MidPathConfig>(config));
+
+		auto& tracker = this->GetTracker();
+		tracker.Setup(FillConfigStruct<tracking::Predictor>(config),
+		              tolerances.newton_before_endgame,
+		              tolerances.path_truncation_threshold,
+		              FillConfigStruct<tracking::SteppingConfig>(config),
+		              FillConfigStruct<tracking::NewtonConfig>(config));
+
+		this->SetToEndgame(FillConfigStruct<endgame::EndgameConfig>(config));
+		this->SetToEndgame(FillConfigStruct<endgame::SecurityConfig>(config));
+	}
+
+	void UseCachedSystems(SystemCache const& cache, std::string const& key) override
+	{
+		this->UsePrepared(cache.GetOrBuild(key, [this]()
+		{
+			this->Homotopy().SupportsEvaluationContexts(); // differentiates and compiles it
+			return this->Prepared();
+		}));
+	}
+
+	void RunWritingClassic(std::ostream & main_data, std::ostream & raw_data) override
+	{
+		using Classic = algorithm::output::Classic<ZeroDimT>;
+
+		Classic::RawDataHeader(raw_data, *this);
+
+		algorithm::output::ClassicRawDataStreamer<ZeroDimT> streamer(raw_data);
+		this->AddObserver(streamer);
+		try{
+			this->Run();
+		}
+		catch (...)
+		{
+			this->RemoveObserver(streamer);
+			throw;
+		}
+		this->RemoveObserver(streamer);
+
+		Classic::RawDataTrailer(raw_data, *this);
+		Classic::MainData(main_data, *this);
+	}
+};
+
+
 template <typename StartType, typename TrackerType, typename EndgameType, template<typename,typename> class SystemManagementPol, typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyComplete(ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyComplete(ConstTs const& ...ts)
 {
 	return std::make_unique<
+			ZeroDimRun<
 			algorithm::ZeroDim<
 				TrackerType, 
 				EndgameType, 
 				System, 
 				StartType,
 				SystemManagementPol>
+			>
 			>(ts...);
 }
 
 template <typename StartType, typename TrackerType, typename EndgameType, typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyShouldClone(std::true_type, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyShouldClone(std::true_type, ConstTs const& ...ts)
 {
-	return ZeroDimSpecifyComplete<StartType, TrackerType, 
-			typename endgame::EndgameSelector<TrackerType>::Cauchy, policy::CloneGiven>(ts...);
+	return ZeroDimSpecifyComplete<StartType, TrackerType, EndgameType, policy::CloneGiven>(ts...);
 }
 
 template <typename StartType, typename TrackerType, typename EndgameType, typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyShouldClone(std::false_type, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyShouldClone(std::false_type, ConstTs const& ...ts)
 {
-	return ZeroDimSpecifyComplete<StartType, TrackerType, 
-			typename endgame::EndgameSelector<TrackerType>::Cauchy, policy::RefToGiven>(ts...);
+	return ZeroDimSpecifyComplete<StartType, TrackerType, EndgameType, policy::RefToGiven>(ts...);
 }
 
 
 template <typename StartType, typename TrackerType, typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyEndgame(ZeroDimRT const& rt, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyEndgame(ZeroDimRT const& rt, ConstTs const& ...ts)
 {
 	
 	switch (rt.endgame)
@@ -97,7 +198,7 @@ std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyEndgame(ZeroDimRT const& rt
 }
 
 template <typename StartType, typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyTracker(ZeroDimRT const& rt, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyTracker(ZeroDimRT const& rt, ConstTs const& ...ts)
 {
 	switch (rt.tracker)
 	{
@@ -111,7 +212,7 @@ std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyTracker(ZeroDimRT const& rt
 }
 
 template <typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyStart(ZeroDimRT const& rt, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> ZeroDimSpecifyStart(ZeroDimRT const& rt, ConstTs const& ...ts)
 {
 	switch (rt.start)
 	{
@@ -125,7 +226,7 @@ std::unique_ptr<algorithm::AnyZeroDim> ZeroDimSpecifyStart(ZeroDimRT const& rt,
 }
 
 template <typename ... ConstTs>
-std::unique_ptr<algorithm::AnyZeroDim> MakeZeroDim(ZeroDimRT const& rt, ConstTs const& ...ts)
+std::unique_ptr<AnyZeroDimRun> MakeZeroDim(ZeroDimRT const& rt, ConstTs const& ...ts)
 {
 	return ZeroDimSpecifyStart(rt, ts...);
 }
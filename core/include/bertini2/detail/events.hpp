@@ -35,6 +35,9 @@
 
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
+#include <atomic>
+#include <type_traits>
+#include <vector>
 #include <boost/type_index.hpp>
 namespace bertini {
 
@@ -49,13 +52,56 @@ namespace bertini {
 		virtual ~AnyEvent() = default;
 	};
 
+	namespace detail {
+		inline
+		unsigned NextEventTypeId()
+		{
+			static std::atomic<unsigned> next{0};
+			return next++;
+		}
+	}
+
+	/**
+	\brief A small integer identifying an event type, unique within the program.
+
+	Ids are handed out on first use, so are only meaningful within a run.  Observables index their subscription caches with them.
+	*/
+	template<class EventT>
+	unsigned EventTypeId()
+	{
+		static const unsigned id = detail::NextEventTypeId();
+		return id;
+	}
+
+	/**
+	\brief The ids of an event type and all the event types it derives from, from AnyEvent down.
+
+	An event derived from a type an observer subscribes to is delivered to it, as with filtering by `dynamic_cast`.  The hierarchy is followed through each event type's `ParentEvent`, which every event type must declare.
+	*/
+	template<class EventT>
+	std::vector<unsigned> const& EventAncestry()
+	{
+		static const std::vector<unsigned> ancestry = []()
+		{
+			std::vector<unsigned> a;
+			if constexpr (!std::is_same<EventT, AnyEvent>::value)
+			{
+				static_assert(std::is_base_of<typename EventT::ParentEvent, EventT>::value && !std::is_same<typename EventT::ParentEvent, EventT>::value, "an event's ParentEvent must be a proper base of it");
+				a = EventAncestry<typename EventT::ParentEvent>();
+			}
+			a.push_back(EventTypeId<EventT>());
+			return a;
+		}();
+		return ancestry;
+	}
+
 	template<class ObsT, bool IsConst = true>
 	class Event;
 
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Observers say which event types they want with AnyObserver::SubscribeTo, and are only sent those, and types derived from them.  They then filter further by dynamic casting.
 
 	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
@@ -91,6 +137,7 @@ namespace bertini {
 		Event() = delete;
 
 		using HeldT = const ObsT&;
+		using ParentEvent = AnyEvent;
 	protected:
 		const ObsT& current_observable_;
 	};
@@ -99,7 +146,7 @@ namespace bertini {
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Observers say which event types they want with AnyObserver::SubscribeTo, and are only sent those, and types derived from them.  They then filter further by dynamic casting.
 
 	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
@@ -135,6 +182,7 @@ namespace bertini {
 		Event() = delete;
 
 		using HeldT = ObsT&;
+		using ParentEvent = AnyEvent;
 	protected:
 		ObsT& current_observable_;
 	};
@@ -156,6 +204,7 @@ namespace bertini {
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS \
 	public: \
 		using HeldT = typename event_parenttype<ObservedT>::HeldT; \
+		using ParentEvent = event_parenttype<ObservedT>; \
 		event_name(HeldT obs) : event_parenttype<ObservedT>(obs){} \
 		virtual ~event_name() = default; \
 		event_name() = delete; }
@@ -32,6 +32,11 @@
 #ifndef BERTINI_DETAIL_OBSERVABLE_HPP
 #define BERTINI_DETAIL_OBSERVABLE_HPP
 
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 #include "bertini2/detail/observer.hpp"
 #include "bertini2/detail/events.hpp"
 
@@ -57,7 +62,10 @@ namespace bertini{
 			if (find_if(begin(current_watchers_), end(current_watchers_), [&](const auto& held_obs)
 			                              { return &held_obs.get() == &new_observer; })==end(current_watchers_))
 				
+			{
 				current_watchers_.push_back(std::ref(new_observer));
+				observed_.clear();
+			}
 		}
 
 		/**
@@ -71,17 +79,71 @@ namespace bertini{
 			                              { return &held_obs.get() == &observer; });
 
 			current_watchers_.erase(new_end, current_watchers_.end());
+			observed_.clear();
 
 
 			// current_watchers_.erase(std::remove(current_watchers_.begin(), current_watchers_.end(), std::ref(observer)), current_watchers_.end());
 		}
 
+		/**
+		\brief Whether any attached observer wants events of a type.
+
+		The answer is cached per event type, and the cache is cleared when observers come and go, so after the first time this is a couple of loads.  With no observers at all it's a single comparison.
+		*/
+		template<class EventT>
+		bool IsObserved() const
+		{
+			if (current_watchers_.empty())
+				return false;
+
+			auto id = EventTypeId<EventT>();
+			if (id >= observed_.size())
+				observed_.resize(id+1, Subscription::Unknown);
+
+			auto& observed = observed_[id];
+			if (observed==Subscription::Unknown)
+			{
+				auto const& ancestry = EventAncestry<EventT>();
+				observed = std::any_of(current_watchers_.begin(), current_watchers_.end(), [&](auto const& obs){ return obs.get().SubscribesTo(ancestry); }) ? Subscription::Yes : Subscription::No;
+			}
+			return observed==Subscription::Yes;
+		}
+
 	protected:
 
+		/**
+		\brief Build an event and send it to the observers who subscribed to its type.
+
+		If nobody wants it, the event isn't even built, so emitting events from inner loops costs next to nothing when nobody is watching.  Prefer this to NotifyObservers.
+
+		\tparam EventT The type of event to emit.
+		\param args The arguments for the event's constructor, typically starting with `*this`.
+		*/
+		template<class EventT, typename... ArgTs>
+		void Emit(ArgTs&&... args) const
+		{
+			if (!IsObserved<EventT>())
+				return;
+
+			EventT const e(std::forward<ArgTs>(args)...);
+			auto const& ancestry = EventAncestry<EventT>();
+
+			// by index, since observers may remove themselves as they observe
+			for (std::size_t ii = 0; ii < current_watchers_.size(); )
+			{
+				auto& obs = current_watchers_[ii].get();
+				if (obs.SubscribesTo(ancestry))
+					obs.Observe(e);
+
+				if (ii < current_watchers_.size() && &current_watchers_[ii].get()==&obs)
+					++ii;
+			}
+		}
+
 		/**
 		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		This ignores subscriptions, since the event's type isn't known at compile time, and the event has already been built.  Emit is the better choice.
 
 		\param e The event to emit.  Its type should be derived from AnyEvent.
 		*/
@@ -105,7 +167,70 @@ namespace bertini{
 
 		using ObserverContainer = std::vector<std::reference_wrapper<AnyObserver>>;
 
+		enum class Subscription : unsigned char { Unknown, No, Yes };
+
 		mutable ObserverContainer current_watchers_;
+		mutable std::vector<Subscription> observed_; ///< Whether anyone wants each type of event, indexed by EventTypeId.
+	};
+
+
+
+	/**
+	\brief A list of observers whose types are known at compile time, for emitting events to them with no virtual dispatch.
+
+	The observers are held by reference, and called by their static types, so `Observe` calls can be inlined.  Like Observable, events are only built if some observer in the list subscribes to them.
+
+	This is a standalone utility, for code that runs its own loop and emits its own events.  Tracker and Endgame do not take a StaticObservers, and never emit to one; to observe them, attach observers with Observable::AddObserver.
+
+	\code
+	tracking::MinMaxPrecisionRecorder<AMPTracker> recorder;
+	StaticObservers<tracking::MinMaxPrecisionRecorder<AMPTracker>> observers(recorder);
+	observers.Emit<PrecisionChanged<AMPTracker>>(tracker, 16, 30);
+	\endcode
+
+	\tparam ObserverTs The types of the observers.  Each must be derived from AnyObserver, with a public Observe.
+	*/
+	template<class... ObserverTs>
+	class StaticObservers
+	{
+	public:
+
+		explicit
+		StaticObservers(ObserverTs&... observers) : observers_(observers...)
+		{}
+
+		/**
+		\brief Whether any of the observers wants events of a type.
+		*/
+		template<class EventT>
+		bool IsObserved() const
+		{
+			auto const& ancestry = EventAncestry<EventT>();
+			return std::apply([&](auto const&... obs){ return (false || ... || obs.SubscribesTo(ancestry)); }, observers_);
+		}
+
+		/**
+		\brief Build an event, if anyone wants it, and send it to those who do.
+		*/
+		template<class EventT, typename... ArgTs>
+		void Emit(ArgTs&&... args) const
+		{
+			if (!IsObserved<EventT>())
+				return;
+
+			EventT const e(std::forward<ArgTs>(args)...);
+			auto const& ancestry = EventAncestry<EventT>();
+			auto observe = [&](auto& obs)
+			{
+				using ObserverT = std::remove_reference_t<decltype(obs)>;
+				if (obs.SubscribesTo(ancestry))
+					obs.ObserverT::Observe(e); // qualified, so not a virtual call
+			};
+			std::apply([&](auto&... obs){ (observe(obs), ...); }, observers_);
+		}
+
+	private:
+		std::tuple<ObserverTs&...> observers_;
 	};
 
 } // namespace bertini
@@ -32,8 +32,10 @@
 #ifndef BERTINI_DETAIL_OBSERVER_HPP
 #define BERTINI_DETAIL_OBSERVER_HPP
 
+#include <algorithm>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/fusion/adapted/std_tuple.hpp>
 
@@ -63,6 +65,62 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+		/**
+		\brief Whether this observer wants events of a type, given the type's ancestry.
+
+		An observer which never called SubscribeTo wants everything.
+
+		\param event_ancestry The ids of an event type and its bases, as from EventAncestry.
+		*/
+		bool SubscribesTo(std::vector<unsigned> const& event_ancestry) const
+		{
+			if (subscriptions_.empty())
+				return true;
+
+			for (auto id : event_ancestry)
+				if (std::find(subscriptions_.begin(), subscriptions_.end(), id)!=subscriptions_.end())
+					return true;
+			return false;
+		}
+
+		/**
+		\brief Whether this observer limited the events it wants, with SubscribeTo.
+		*/
+		bool HasSubscriptions() const
+		{
+			return !subscriptions_.empty();
+		}
+
+	protected:
+
+		/**
+		\brief Ask to be sent events of a type, and of types derived from it.
+
+		Once an observer has subscribed to anything, it is sent only the events it subscribed to, so that observables can skip building events nobody wants.  Subscribe before attaching to an observable, typically in the constructor; observables remember who wants what.
+
+		\tparam EventT The event type, for example `PrecisionChanged<AMPTracker>`.
+		*/
+		template<class EventT>
+		void SubscribeTo()
+		{
+			auto id = EventTypeId<EventT>();
+			if (std::find(subscriptions_.begin(), subscriptions_.end(), id)==subscriptions_.end())
+				subscriptions_.push_back(id);
+		}
+
+		/**
+		\brief Subscribe to everything some other observer subscribes to.
+		*/
+		void SubscribeToAllOf(AnyObserver const& other)
+		{
+			for (auto id : other.subscriptions_)
+				if (std::find(subscriptions_.begin(), subscriptions_.end(), id)==subscriptions_.end())
+					subscriptions_.push_back(id);
+		}
+
+	private:
+		std::vector<unsigned> subscriptions_; ///< The ids of the event types this observer wants.  Empty means all of them.
 	};
 
 
@@ -101,6 +159,17 @@ namespace bertini{
 	{	BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 
+		/**
+		\brief Subscribes to the union of what the glued-together observers want, unless one of them wants everything.
+		*/
+		MultiObserver()
+		{
+			bool all = false;
+			boost::fusion::for_each(observers_, [&](auto const& obs){ all = all || !obs.HasSubscriptions(); });
+			if (!all)
+				boost::fusion::for_each(observers_, [&](auto const& obs){ this->SubscribeToAllOf(obs); });
+		}
+
 		/**
 		\brief Observe override which calls the overrides for the types you glued together.
 
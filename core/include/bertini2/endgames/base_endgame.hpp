@@ -36,6 +36,7 @@
 */
 
 #include <iostream>
+#include <limits>
 #include <typeinfo>
 
 
@@ -121,6 +122,7 @@ protected:
 	mutable Vec<BCT> previous_approximation_; 
 	mutable unsigned int cycle_number_ = 0; 
 	mutable NumErrorT approximate_error_;
+	mutable NumErrorT divergence_rate_ = 0;
 
 
 
@@ -151,6 +153,7 @@ public:
 	*/
 	SuccessCode Run(const BCT & start_time, const Vec<BCT> & start_point, BCT const& target_time)
 	{
+		divergence_rate_ = 0;
 		return this->AsFlavor().RunImpl(start_time, start_point, target_time);
 	}
 
@@ -178,7 +181,7 @@ public:
 				// BOOST_LOG_TRIVIAL(severity_level::trace) << "refining failed, code " << int(refine_success);
 				return refine_success;
 			}
-			NotifyObservers(SampleRefined<EmitterType>(AsFlavor()));
+			this->template Emit<SampleRefined<EmitterType>>(AsFlavor());
 		}
 
 		if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
@@ -288,6 +291,15 @@ public:
 		return approximate_error_;
 	}
 
+	/**
+	\brief Get the power of 1/|t-t0| at which the norm of the path was last found to be growing, or 0 if it wasn't found to be diverging.
+	*/
+	inline
+	NumErrorT DivergenceRate() const
+	{
+		return divergence_rate_;
+	}
+
 
 	/**
 	Get the latest time at which a point on the path was computed
@@ -372,6 +384,76 @@ public:
 		return SuccessCode::Success;
 	}
 
+
+	/**
+	\brief Decides whether a path is going to infinity, from the growth of the norms of its samples toward the target time.
+
+	## Input
+
+			times: the most recent times on the path, in the order tracked.
+			samples: the samples at those times.
+			target_time: the time the samples approach.
+
+	## Output
+
+		true if the path is judged to be going to infinity.  The estimated rate is kept, and available from DivergenceRate().
+
+	## Details
+
+		On a path going to infinity the norm of the dehomogenized point grows like \f$|t-t_0|^{-v}\f$, with v a positive rational whose denominator is the cycle number.  Each consecutive pair of samples gives an estimate of v, 
+
+		\f[ \frac{\log(n_{k+1}/n_k)}{\log(|t_k-t_0|/|t_{k+1}-t_0|)}. \f]
+
+		The path is declared divergent once the estimates are all at least SecurityConfig::min_divergence_rate and agree to within divergence_rate_tolerance, and the latest norm exceeds divergence_min_norm.  On a path to a finite point, the estimates decay geometrically toward 0, so don't settle.
+
+		Does nothing unless SecurityConfig::early_divergence_detection.  Needs at least three samples.
+	*/
+	template<typename CT>
+	bool IsDiverging(TimeCont<CT> const& times, SampCont<CT> const& samples, CT const& target_time) const
+	{
+		using std::abs;
+		using std::log;
+		using std::max;
+		using std::min;
+
+		const auto& security = SecuritySettings();
+
+		divergence_rate_ = 0;
+		if (!security.early_divergence_detection || samples.size() < 3)
+			return false;
+
+		assert(times.size()==samples.size() && "must have same number of times and samples");
+
+		NumErrorT previous_log_norm(0), previous_log_distance(0);
+		NumErrorT min_rate = std::numeric_limits<NumErrorT>::infinity(), max_rate = -min_rate;
+		for (unsigned ii = 0; ii < samples.size(); ++ii)
+		{
+			auto norm = static_cast<NumErrorT>(this->GetSystem().DehomogenizePoint(samples[ii]).template lpNorm<Eigen::Infinity>());
+			auto distance = static_cast<NumErrorT>(abs(times[ii] - target_time));
+			if (!(norm > 0) || !(distance > 0))
+				return false;
+
+			auto log_norm = log(norm), log_distance = log(distance);
+			if (ii > 0)
+			{
+				auto rate = (log_norm - previous_log_norm) / (previous_log_distance - log_distance);
+				min_rate = min(min_rate, rate);
+				max_rate = max(max_rate, rate);
+			}
+			previous_log_norm = log_norm;
+			previous_log_distance = log_distance;
+
+			if (ii==samples.size()-1 && norm < security.divergence_min_norm)
+				return false;
+		}
+
+		if (!(min_rate >= security.min_divergence_rate) || max_rate - min_rate > security.divergence_rate_tolerance * max_rate)
+			return false;
+
+		divergence_rate_ = min_rate;
+		return true;
+	}
+
 	virtual ~EndgameBase() = default;
 };
 			
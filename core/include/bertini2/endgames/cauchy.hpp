@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "bertini2/endgames/base_endgame.hpp"
 
 
@@ -204,6 +206,26 @@ protected:
 	\brief A deque of samples collected by CircleTrack. Computed a mean of the values of this deque, after a loop has been closed, will give an approximation of the origin.
 	*/
 	mutable TupleOfSamps cauchy_samples_;
+	/**
+	\brief The stepsize the tracker had adapted to at the end of the most recent circle, divided by that circle's radius.  Non-positive until a circle has been tracked on the current path.  Used to start the next circle, if CauchyConfig::reuse_circle_stepsize.
+	*/
+	mutable NumErrorT stepsize_per_radius_ = 0;
+	/**
+	\brief The number of samples per loop around the target time, if doubled from EndgameConfig::num_sample_points by the adaptive quadrature.  Zero for the configured number.
+	*/
+	mutable unsigned samples_per_loop_ = 0;
+	/**
+	\brief The estimated error of the mean of the current Cauchy samples, from the decay of their discrete Fourier coefficients.  Infinite unless they decay geometrically.  Only computed if CauchyConfig::adaptive_quadrature.
+	*/
+	mutable NumErrorT quadrature_error_ = std::numeric_limits<NumErrorT>::infinity();
+	/**
+	\brief The largest ratio between the largest discrete Fourier coefficients of consecutive quarters of the spectrum of the current Cauchy samples.  Infinite if they don't decay geometrically, and 1 if there weren't enough of them to tell.
+	*/
+	mutable NumErrorT coefficient_decay_ratio_ = 1;
+	/**
+	\brief The cycle number estimated from which discrete Fourier coefficients of the current Cauchy samples vanish.  Zero until estimated.
+	*/
+	mutable unsigned coefficient_cycle_number_ = 0;
 
 
 
@@ -302,6 +324,39 @@ public:
 	}
 
 
+	/**
+	\brief The number of samples taken per loop around the target time.
+	*/
+	unsigned SamplesPerLoop() const
+	{
+		return samples_per_loop_ ? samples_per_loop_ : this->EndgameSettings().num_sample_points;
+	}
+
+	/**
+	\brief The estimated error of the mean of the most recent Cauchy samples.  Infinite unless CauchyConfig::adaptive_quadrature, and their discrete Fourier coefficients decay geometrically.
+	*/
+	NumErrorT QuadratureErrorEstimate() const
+	{
+		return quadrature_error_;
+	}
+
+	/**
+	\brief The rate at which the discrete Fourier coefficients of the most recent Cauchy samples decay, per quarter of the spectrum.  Infinite if they don't decay geometrically, and 1 if it couldn't be measured.
+	*/
+	NumErrorT CoefficientDecayRatio() const
+	{
+		return coefficient_decay_ratio_;
+	}
+
+	/**
+	\brief The cycle number estimated from the discrete Fourier coefficients of the most recent Cauchy samples.  Zero unless CauchyConfig::adaptive_quadrature.
+	*/
+	unsigned CoefficientCycleNumber() const
+	{
+		return coefficient_cycle_number_;
+	}
+
+
 	const BCT& LatestTimeImpl() const
 	{
 		return GetPSEGTimes<BCT>().back();
@@ -377,72 +432,65 @@ public:
 		auto& circle_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
 		CT starting_time = circle_times.back();  // take a COPY here, so won't invalidate it later
+		const Vec<CT> starting_sample = circle_samples.back();
 
 		// the initial sample has already been added to the sample repo... so don't do that here, please
-		
-		const auto num_vars = this->GetSystem().NumVariables();
-
-		for (unsigned ii = 0; ii < this->EndgameSettings().num_sample_points; ++ii)
-		{
-			const Vec<CT>& current_sample = circle_samples.back();
-			const CT& current_time = circle_times.back();
 
 #ifndef BERTINI_DISABLE_PRECISION_CHECKS
-			if (Precision(current_time)!=Precision(current_sample)){
-				std::stringstream err_msg;
-				err_msg << "current time and sample for circle track must be of same precision.  respective precisions: " << Precision(current_time) << " " << Precision(current_sample) << std::endl;
-				throw std::runtime_error(err_msg.str());
-			}
+		if (Precision(starting_time)!=Precision(starting_sample)){
+			std::stringstream err_msg;
+			err_msg << "current time and sample for circle track must be of same precision.  respective precisions: " << Precision(starting_time) << " " << Precision(starting_sample) << std::endl;
+			throw std::runtime_error(err_msg.str());
+		}
 #endif
 
-			//set up the time value for the next sample. 
-			using std::polar;
+		//set up the time values for the samples. 
+		using std::polar;
 
 #ifndef USE_BMP_COMPLEX 
-			using bertini::polar;
+		using bertini::polar;
 #endif
 
-			//Generalized since we could have a nonzero target time. 
-			using std::arg;
-			RT radius = abs(starting_time - target_time), angle = arg(starting_time - target_time); // generalized for nonzero target_time.
-
-			auto next_sample = Vec<CT>(num_vars);
-			CT next_time = (ii==this->EndgameSettings().num_sample_points-1) 
-								?
-							  starting_time
-								:
-							  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / (this->EndgameSettings().num_sample_points) + angle) + target_time;
-			// If we are tracking to a nonzero target time we need to shift our values to track to. This is a step that may not be needed if target_time = 0
-							  ;
-
-
-			auto tracking_success = this->GetTracker().TrackPath(next_sample, current_time, next_time, current_sample);	
-			if (tracking_success != SuccessCode::Success)
-			{
-				return tracking_success;
-			}
+		//Generalized since we could have a nonzero target time. 
+		using std::arg;
+		RT radius = abs(starting_time - target_time), angle = arg(starting_time - target_time); // generalized for nonzero target_time.
+
+		const auto num_samples = SamplesPerLoop();
+		std::vector<CT> sample_times;
+		sample_times.reserve(num_samples);
+		for (unsigned ii = 0; ii < num_samples; ++ii)
+			sample_times.push_back( (ii==num_samples-1) 
+									?
+								  starting_time
+									:
+								  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / num_samples + angle) + target_time);
+
+		// go around the whole circle in one track, so the tracker keeps its stepsize and precision from one arc to the next
+		auto& tracker = this->GetTracker();
+		bool reuse_stepsize = GetCauchySettings().reuse_circle_stepsize && stepsize_per_radius_ > 0;
+		if (reuse_stepsize)
+			tracker.SetStepSize(radius * static_cast<RT>(stepsize_per_radius_));
+
+		std::vector<Vec<CT>> next_samples;
+		auto tracking_success = tracker.TrackContour(next_samples, starting_time, sample_times, starting_sample, reuse_stepsize);
+
+		for (unsigned ii = 0; ii < next_samples.size(); ++ii)
+		{
+			auto& next_sample = next_samples[ii];
+			auto& next_time = sample_times[ii];
 
-			NotifyObservers(CircleAdvanced<EmitterType>(*this, next_sample, next_time));
-			
+			this->template Emit<CircleAdvanced<EmitterType>>(*this, next_sample, next_time);
 
 			this->EnsureAtPrecision(next_time,Precision(next_sample)); assert(Precision(next_time)==Precision(next_sample));
 
-			// auto refinement_success = this->RefineSample(next_sample, next_sample, next_time, 
-			// 							this->FinalTolerance() * this->EndgameSettings().sample_point_refinement_factor,
-			// 							this->EndgameSettings().max_num_newton_iterations);
-			// if (refinement_success != SuccessCode::Success)
-			// {
-			// 	return refinement_success;
-			// }
-
-			// this->EnsureAtPrecision(next_time,Precision(next_sample)); 
-			// assert(Precision(next_time)==Precision(next_sample));
-
 			AddToCauchyData(next_time, next_sample);
-
-			// NotifyObservers(SampleRefined<EmitterType>(*this));
 		}
 
+		if (tracking_success != SuccessCode::Success)
+			return tracking_success;
+
+		stepsize_per_radius_ = static_cast<NumErrorT>(tracker.CurrentStepsize() / radius);
+
 		return SuccessCode::Success;
 
 	}//end CircleTrack
@@ -678,7 +726,7 @@ public:
 		else
 		{
 			RT norm;
-			for(unsigned int ii=0; ii < this->EndgameSettings().num_sample_points; ++ii)
+			for(unsigned int ii=0; ii < SamplesPerLoop(); ++ii)
 			{
 				norm = samples[ii].template lpNorm<Eigen::Infinity>();
 				if(norm > max)
@@ -757,7 +805,7 @@ public:
 				{
 					if (CheckClosedLoop<CT>())
 					{//error is small enough, exit the loop with success. 
-						NotifyObservers(ClosedLoop<EmitterType>(*this));
+						this->template Emit<ClosedLoop<EmitterType>>(*this);
 						initial_cauchy_loop_success = SuccessCode::Success;
 						loop_hasnt_closed = false;
 						break;
@@ -899,7 +947,7 @@ public:
 
 		}//end while
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template Emit<InEGOperatingZone<EmitterType>>(*this);
 
 		return SuccessCode::Success;
 	}
@@ -926,10 +974,10 @@ public:
 		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
-		if (cau_samples.size() != this->CycleNumber() * this->EndgameSettings().num_sample_points+1)
+		if (cau_samples.size() != this->CycleNumber() * SamplesPerLoop()+1)
 		{
 			std::stringstream err_msg;
-			err_msg << "to compute cauchy approximation, cau_samples must be of size " << this->CycleNumber() * this->EndgameSettings().num_sample_points+1 << " but is of size " << cau_samples.size() << '\n';
+			err_msg << "to compute cauchy approximation, cau_samples must be of size " << this->CycleNumber() * SamplesPerLoop()+1 << " but is of size " << cau_samples.size() << '\n';
 			throw std::runtime_error(err_msg.str());
 		}
 
@@ -942,7 +990,7 @@ public:
 		}
 
 
-		auto total_num_pts = this->CycleNumber() * this->EndgameSettings().num_sample_points;
+		auto total_num_pts = this->CycleNumber() * SamplesPerLoop();
 		this->template RefineAllSamples(cau_samples, cau_times);
 
 		Precision(result, Precision(cau_samples.back()));
@@ -950,12 +998,239 @@ public:
 		result = Vec<CT>::Zero(this->GetSystem().NumVariables());
 		for(unsigned int ii = 0; ii < total_num_pts; ++ii)
 			result += cau_samples[ii];
-		result /= this->CycleNumber() * this->EndgameSettings().num_sample_points;
+		result /= total_num_pts;
 
 		return SuccessCode::Success;
 
 	}
 
+	/**
+	\brief Computes the discrete Fourier coefficients of the Cauchy samples, and from them the error of their mean, the rate at which they decay, and the cycle number.
+
+		## Output:
+			None.  Sets the values returned by QuadratureErrorEstimate(), CoefficientDecayRatio() and CoefficientCycleNumber().
+
+		##Details:
+	\tparam CT The complex number type.
+				Around c loops of N/c samples each, the samples are those of the Puiseux series \f$x(s) = \sum_j a_j s^j\f$ on a circle of radius \f$\rho = r^{1/c}\f$ in \f$s\f$, so the j-th discrete Fourier coefficient is \f$a_j \rho^j\f$, plus aliases \f$a_{j+lN} \rho^{j+lN}\f$.  The mean, the 0-th coefficient, differs from the root only by the aliases of \f$a_0\f$, the first of which is \f$a_N \rho^N\f$.
+
+				Inside the radius of convergence of the series, the coefficients decay geometrically, at the rate \f$\rho/R\f$.  The coefficients 1 through N-1 are split into quarters, and the largest in each quarter compared with the largest in the one before.  They decay geometrically if each ratio is less than 1, and no larger than the square root of the ratio before it.  Coefficients below the accuracy the samples are refined to are noise, so the comparison stops at the first quarter of them.  Then the aliases are bounded by the largest ratio r, and the last quarter b above the noise, as \f$r b / (1-r)\f$, plus the accuracy of the samples.  If the coefficients grow, or their decay slows, the circle is too large, and the error is infinite.
+
+				If the path has cycle number c, the coefficients at every index are generally nonzero.  If they vanish, to the accuracy of the samples, except at multiples of some g dividing c, the samples repeat after c/g loops, which is the cycle number estimated from the coefficients.
+
+				Assumes the loop has been closed, and the samples refined to uniform precision.
+	*/
+	template<typename CT>
+	void AnalyzeCauchyCoefficients() const
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::acos;
+		using std::polar;
+		using std::max;
+		using std::sqrt;
+#ifndef USE_BMP_COMPLEX 
+		using bertini::polar;
+#endif
+
+		const auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		const unsigned num_pts = this->CycleNumber() * SamplesPerLoop();
+		assert(cau_samples.size()==num_pts+1);
+
+		RT angle = 2*acos(static_cast<RT>(-1)) / num_pts;
+		std::vector<CT> roots_of_unity; // conjugated, for the forward transform
+		roots_of_unity.reserve(num_pts);
+		for (unsigned kk = 0; kk < num_pts; ++kk)
+			roots_of_unity.push_back(polar(static_cast<RT>(1), -angle*kk));
+
+		std::vector<NumErrorT> coefficient_norms(num_pts, NumErrorT(0));
+		for (unsigned jj = 1; jj < num_pts; ++jj)
+		{
+			Vec<CT> coefficient = Vec<CT>::Zero(cau_samples.back().size());
+			for (unsigned kk = 0; kk < num_pts; ++kk)
+				coefficient += cau_samples[kk] * roots_of_unity[(static_cast<unsigned long>(jj)*kk) % num_pts];
+			coefficient /= num_pts;
+			coefficient_norms[jj] = static_cast<NumErrorT>(coefficient.template lpNorm<Eigen::Infinity>());
+		}
+
+		const NumErrorT noise = this->FinalTolerance() * this->EndgameSettings().sample_point_refinement_factor;
+
+		// the cycle number, from which coefficients vanish
+		coefficient_cycle_number_ = this->CycleNumber();
+		for (unsigned g = this->CycleNumber(); g > 1; --g)
+		{
+			if (this->CycleNumber() % g)
+				continue;
+
+			bool vanish = true;
+			for (unsigned jj = 1; jj < num_pts && vanish; ++jj)
+				if (jj % g && coefficient_norms[jj] > noise)
+					vanish = false;
+
+			if (vanish)
+			{
+				coefficient_cycle_number_ = this->CycleNumber() / g;
+				break;
+			}
+		}
+
+		// the decay, from the largest coefficient in each quarter
+		quadrature_error_ = std::numeric_limits<NumErrorT>::infinity();
+		coefficient_decay_ratio_ = 1;
+		if (num_pts < 5) // too few to have four quarters
+			return;
+
+		NumErrorT quarter_max[4];
+		for (unsigned qq = 0; qq < 4; ++qq)
+		{
+			quarter_max[qq] = 0;
+			for (unsigned jj = 1 + qq*(num_pts-1)/4; jj < 1 + (qq+1)*(num_pts-1)/4; ++jj)
+				quarter_max[qq] = max(quarter_max[qq], coefficient_norms[jj]);
+		}
+
+		if (quarter_max[0] <= noise) // nothing to measure a decay from
+			return;
+
+		NumErrorT ratio(0), previous_ratio(1);
+		unsigned last_above_noise = 0;
+		for (unsigned qq = 1; qq < 4; ++qq)
+		{
+			if (quarter_max[qq] <= noise)
+			{ // decayed into the noise
+				ratio = max(ratio, noise / quarter_max[qq-1]);
+				break;
+			}
+
+			NumErrorT current_ratio = quarter_max[qq] / quarter_max[qq-1];
+			if (current_ratio >= 1 || current_ratio > sqrt(previous_ratio))
+			{
+				coefficient_decay_ratio_ = std::numeric_limits<NumErrorT>::infinity();
+				return;
+			}
+
+			ratio = max(ratio, current_ratio);
+			previous_ratio = current_ratio;
+			last_above_noise = qq;
+		}
+
+		coefficient_decay_ratio_ = ratio;
+		if (ratio < 1)
+			quadrature_error_ = ratio * quarter_max[last_above_noise] / (1 - ratio) + noise;
+	}
+
+
+	/**
+	\brief Estimates the error of the mean of the Cauchy samples, from the decay of their discrete Fourier coefficients.
+
+		## Output:
+			The estimated error, infinite unless the coefficients decay geometrically.  See AnalyzeCauchyCoefficients().
+
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	NumErrorT EstimateQuadratureError() const
+	{
+		AnalyzeCauchyCoefficients<CT>();
+		return quadrature_error_;
+	}
+
+
+	/**
+	\brief Doubles the Cauchy samples, by tracking from each to the point halfway to the next around the circle.  The samples already tracked are kept.
+
+		## Input: 
+			target_time: the time value that we are creating loops around
+
+		## Output: 
+			SuccessCode deeming if we were able to track to all the new samples.
+
+		##Details:
+	\tparam CT The complex number type.
+				Each new sample is half an arc from an old one, so doubling costs about half a circle of tracking per loop.  Subsequent circles use the doubled number of samples too.
+	*/
+	template<typename CT>
+	SuccessCode DoubleCauchySamples(CT const& target_time)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::acos;
+		using std::arg;
+		using std::polar;
+#ifndef USE_BMP_COMPLEX 
+		using bertini::polar;
+#endif
+
+		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
+		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		const unsigned num_pts = this->CycleNumber() * SamplesPerLoop();
+		assert(cau_samples.size()==num_pts+1);
+
+		RT radius = abs(cau_times.front() - target_time);
+		RT half_arc = acos(static_cast<RT>(-1)) / SamplesPerLoop();
+
+		TimeCont<CT> doubled_times;
+		SampCont<CT> doubled_samples;
+		for (unsigned ii = 0; ii < num_pts; ++ii)
+		{
+			CT next_time = polar(radius, arg(cau_times[ii] - target_time) + half_arc) + target_time;
+			Vec<CT> next_sample;
+			auto tracking_success = this->GetTracker().TrackPath(next_sample, cau_times[ii], next_time, cau_samples[ii]);
+			if (tracking_success != SuccessCode::Success)
+				return tracking_success;
+
+			this->EnsureAtPrecision(next_time,Precision(next_sample));
+
+			doubled_times.push_back(cau_times[ii]);
+			doubled_samples.push_back(cau_samples[ii]);
+			doubled_times.push_back(next_time);
+			doubled_samples.push_back(next_sample);
+		}
+		doubled_times.push_back(cau_times.back());
+		doubled_samples.push_back(cau_samples.back());
+
+		cau_times.swap(doubled_times);
+		cau_samples.swap(doubled_samples);
+		samples_per_loop_ = 2*SamplesPerLoop();
+
+		this->template Emit<SamplesDoubled<EmitterType>>(*this);
+		return SuccessCode::Success;
+	}
+
+
+	/**
+	\brief Doubles the Cauchy samples until the estimated error of their mean is below the final tolerance, or CauchyConfig::max_sample_doublings is reached.
+
+		## Input: 
+			target_time: the time value that we are creating loops around
+
+		## Output: 
+			SuccessCode deeming if we were able to refine and track to all the samples.
+
+		##Details:
+	\tparam CT The complex number type.
+				If the discrete Fourier coefficients of the samples don't decay geometrically, the circle is too large for more samples to help, so they aren't doubled.  The estimates are kept, and available from QuadratureErrorEstimate(), CoefficientDecayRatio() and CoefficientCycleNumber().
+	*/
+	template<typename CT>
+	SuccessCode ResolveCauchyIntegral(CT const& target_time)
+	{
+		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
+		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
+
+		for (unsigned ii = 0; ; ++ii)
+		{
+			auto refine_success = this->RefineAllSamples(cau_samples, cau_times);
+			if (refine_success != SuccessCode::Success)
+				return refine_success;
+
+			AnalyzeCauchyCoefficients<CT>();
+			if (quadrature_error_ < this->FinalTolerance() || ii >= GetCauchySettings().max_sample_doublings || coefficient_decay_ratio_ == std::numeric_limits<NumErrorT>::infinity())
+				return SuccessCode::Success;
+
+			auto doubling_success = DoubleCauchySamples(target_time);
+			if (doubling_success != SuccessCode::Success)
+				return doubling_success;
+		}
+	}
+
+
 	/**
 	\brief Collects samples while tracking around the target time, until we close the loop, or exceed the limit on # of loops. 
 
@@ -998,7 +1273,7 @@ public:
 				return SuccessCode::Success;
 			}
 		} 
-		NotifyObservers(CycleNumTooHigh<EmitterType>(*this));
+		this->template Emit<CycleNumTooHigh<EmitterType>>(*this);
 		return SuccessCode::CycleNumTooHigh;
 	}//end ComputeCauchySamples
 
@@ -1032,14 +1307,21 @@ public:
 		auto time_advance_success = this->GetTracker().TrackPath(next_sample,current_time, next_time, current_sample);
 		if (time_advance_success != SuccessCode::Success)
 		{
-			NotifyObservers(EndgameFailure<EmitterType>(*this));
+			this->template Emit<EndgameFailure<EmitterType>>(*this);
 			return time_advance_success;
 		}
 
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 		RotateOntoPS(next_time, next_sample);
 
-		NotifyObservers(TimeAdvanced<EmitterType>(*this));
+		this->template Emit<TimeAdvanced<EmitterType>>(*this);
+
+		if (this->IsDiverging(ps_times, ps_samples, target_time))
+		{
+			this->template Emit<DivergenceDetected<EmitterType>>(*this);
+			return SuccessCode::GoingToInfinity;
+		}
+
 		return SuccessCode::Success;
 	}
 
@@ -1090,6 +1372,11 @@ public:
 
 		ClearTimesAndSamples<CT>(); //clear times and samples before we begin.
 		this->CycleNumber(0);
+		stepsize_per_radius_ = 0;
+		samples_per_loop_ = 0;
+		quadrature_error_ = std::numeric_limits<NumErrorT>::infinity();
+		coefficient_decay_ratio_ = 1;
+		coefficient_cycle_number_ = 0;
 		prev_approx = start_point;
 		
 		auto init_success = GetIntoEGZone(start_time, start_point, target_time);
@@ -1108,6 +1395,13 @@ public:
 		
 		do
 		{
+			if (GetCauchySettings().adaptive_quadrature)
+			{
+				auto resolve_success = ResolveCauchyIntegral<CT>(target_time);
+				if (resolve_success!=SuccessCode::Success)
+					return resolve_success;
+			}
+
 			//Compute a cauchy approximation.  Uses the previously computed samples, 
 			//either from InitialCauchyLoops, or ComputeCauchySamples
 			auto extrapolation_success = ComputeCauchyApproximationOfXAtT0<CT>(latest_approx);
@@ -1115,11 +1409,16 @@ public:
 				return extrapolation_success;
 
 			approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-			NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+			if (GetCauchySettings().adaptive_quadrature && coefficient_cycle_number_==this->CycleNumber())
+			{ // geometric decay of the coefficients puts the circle inside the radius of convergence, where the mean is off only by the aliases they bound.  the estimate is infinite otherwise.
+				using std::min;
+				approx_error = min(approx_error, quadrature_error_);
+			}
+			this->template Emit<ApproximatedRoot<EmitterType>>(*this);
 
 			if (approx_error < this->FinalTolerance())
 			{
-				NotifyObservers(Converged<EmitterType>(*this));
+				this->template Emit<Converged<EmitterType>>(*this);
 				return SuccessCode::Success;
 			}
 
@@ -1130,7 +1429,7 @@ public:
 				if (norm_of_dehom_prev   > this->SecuritySettings().max_norm &&  
 					norm_of_dehom_latest > this->SecuritySettings().max_norm  )
 				{
-					NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+					this->template Emit<SecurityMaxNormReached<EmitterType>>(*this);
 					return SuccessCode::SecurityMaxNormReached;
 				}
 			}
@@ -97,6 +97,10 @@ namespace bertini{ namespace endgame{
 	{
 		int level = 0; //SecurityLevel
 		NumErrorT max_norm = NumErrorT(1e4); //SecurityMaxNorm wrong default value
+		bool early_divergence_detection = true; ///< Whether to end the endgame as soon as the norms of the samples grow like a fixed negative power of the distance to the target time, rather than waiting for max_norm to be exceeded.  ZeroDim has its tracker check the same before the endgame, see tracking::DivergenceConfig.
+		NumErrorT min_divergence_rate = NumErrorT(1)/NumErrorT(10); ///< The smallest power of 1/|t-t0| at which the norm must be growing for a path to be declared divergent.
+		NumErrorT divergence_rate_tolerance = NumErrorT(1)/NumErrorT(10); ///< How much estimates of that power from consecutive samples may differ, relative to the largest.
+		NumErrorT divergence_min_norm = NumErrorT(100); ///< The norm the latest sample must exceed for the path to be declared divergent.
 	};
 
 	
@@ -132,6 +136,9 @@ namespace bertini{ namespace endgame{
 		unsigned int num_needed_for_stabilization = 3;
 		T maximum_cauchy_ratio = T(1)/T(2);
 		unsigned int fail_safe_maximum_cycle_number = 250; //max number of loops before giving up. 
+		bool reuse_circle_stepsize = false; ///< Whether to start each circle with the stepsize adapted on the previous one, scaled by the ratio of their radii, rather than the tracker's initial stepsize.
+		bool adaptive_quadrature = false; ///< Whether to judge the samples around the loops by their discrete Fourier coefficients.  While the coefficients decay geometrically, but not enough to bound the error of the mean by the final tolerance, the samples are doubled, reusing those already tracked.  A circle whose coefficients bound the error that well, and agree with the cycle number, ends the endgame without shrinking the circle again.
+		unsigned int max_sample_doublings = 3; ///< With adaptive_quadrature, the most times the samples around one circle are doubled.
 
 	};
 
@@ -74,6 +74,11 @@ namespace bertini {
 	*/
 	ADD_BERTINI_EVENT_TYPE(SecurityMaxNormReached,EndgameFailure);
 
+	/**
+	\brief The norms of the samples are growing like a negative power of the distance to the target time, so the path is going to infinity.
+	*/
+	ADD_BERTINI_EVENT_TYPE(DivergenceDetected,EndgameFailure);
+
 	/**
 	\brief Started running the endgame
 	*/
@@ -92,6 +97,8 @@ namespace bertini {
 	class CircleAdvanced : public EndgameEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = EndgameEvent<ObservedT>;
+
 
 		using CT = typename ObservedT::BaseComplexType;
 		/**
@@ -127,6 +134,11 @@ namespace bertini {
 	*/
 	ADD_BERTINI_EVENT_TYPE(ClosedLoop,EndgameEvent);
 
+	/**
+	\brief Doubled the number of samples around the loops, to better resolve the Cauchy integral.
+	*/
+	ADD_BERTINI_EVENT_TYPE(SamplesDoubled,EndgameEvent);
+
 	/**
 	\brief Approximated a root at target time.
 	*/
@@ -152,6 +164,8 @@ namespace bertini {
 	class PrecisionChanged : public EndgameEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = EndgameEvent<ObservedT>;
+
 		/**
 		\brief The constructor for a PrecisionChanged Event.
 
@@ -29,11 +29,111 @@
 
 #pragma once
 
+#include <vector>
+
 #include "bertini2/common/config.hpp"
 
 namespace bertini{
 	namespace endgame{
 
+/**
+\brief Newton's divided differences for Hermite interpolation, built up one point at a time.
+
+Each node is a time, with the sample and derivative there, and enters the interpolation twice, once for each.  Adding a point computes the new bottom row of the divided difference table from the previous one, so only that row and the diagonal -- the coefficients of the Newton form -- are stored.  The storage is kept through Reset(), so reusing an interpolator allocates nothing once it has grown to the number of points used.
+
+\tparam CT The complex number type.
+*/
+template<typename CT>
+class HermiteInterpolator
+{
+public:
+
+	/**
+	\brief Forget all nodes, keeping the storage.
+	*/
+	void Reset()
+	{
+		num_points_ = 0;
+	}
+
+	/**
+	\brief Add a node, with the sample and derivative there.
+	*/
+	void AddNode(CT const& time, Vec<CT> const& sample, Vec<CT> const& derivative)
+	{
+		AddPoint(time, sample, nullptr);
+		AddPoint(time, sample, &derivative);
+	}
+
+	/**
+	\brief The number of nodes added since the last Reset().
+	*/
+	unsigned NumNodes() const
+	{
+		return num_points_/2;
+	}
+
+	/**
+	\brief Evaluate the interpolant at a time, building it from the highest term down, two terms per node.
+
+	Each node is stored twice among the interpolation points, so the points for the terms of node ii are at 2*ii and 2*ii+1.
+
+	\note The original HermiteInterpolateAndSolve used the times at ii and ii-1 in this recurrence, so its interpolant was wrong whenever there were two or more nodes.  Power series endgame estimates computed with it differ from those computed here.
+	*/
+	Vec<CT> Evaluate(CT const& target_time) const
+	{
+		assert(num_points_>0 && "must have a node to interpolate");
+
+		Vec<CT> result = diagonal_[num_points_-1];
+		for (unsigned ii = NumNodes()-1; ii >= 1; --ii)
+			result = ((result*(target_time - points_[2*ii]) + diagonal_[2*ii]) * (target_time - points_[2*ii-1]) + diagonal_[2*ii-1]).eval();
+
+		return (result * (target_time - points_[0]) + diagonal_[0]).eval();
+	}
+
+private:
+
+	/**
+	Add an interpolation point.  The second for a node is given the derivative, which is the first divided difference at a repeated point.
+	*/
+	void AddPoint(CT const& time, Vec<CT> const& sample, Vec<CT> const* derivative)
+	{
+		const unsigned m = num_points_;
+		if (points_.size() <= m)
+		{
+			points_.resize(m+1);
+			row_.resize(m+1);
+			diagonal_.resize(m+1);
+		}
+
+		points_[m] = time;
+
+		// row_[k] holds f[z_{m-1-k},...,z_{m-1}], and is replaced by f[z_{m-k},...,z_m].  previous_ keeps the entry just replaced, for the next.
+		using std::swap;
+		swap(previous_, row_[0]);
+		row_[0] = sample;
+		for (unsigned k = 1; k <= m; ++k)
+		{
+			swap(replaced_, row_[k]);
+			if (k==1 && derivative)
+				row_[k] = *derivative;
+			else
+				row_[k] = (row_[k-1] - previous_) / (points_[m] - points_[m-k]);
+			swap(previous_, replaced_);
+		}
+
+		diagonal_[m] = row_[m];
+		++num_points_;
+	}
+
+	unsigned num_points_ = 0;
+	std::vector<CT> points_;
+	std::vector<Vec<CT>> row_;
+	std::vector<Vec<CT>> diagonal_;
+	Vec<CT> previous_, replaced_;
+};
+
+
 /**
 
 \brief Estimates the root to interpolating polynomial.
@@ -60,7 +160,7 @@ Details:
 \tparam CT The complex number type.
 */			
 template<typename CT>		
-	Vec<CT> HermiteInterpolateAndSolve(CT const& target_time, const unsigned int num_sample_points, const TimeCont<CT> & times, const SampCont<CT> & samples, const SampCont<CT> & derivatives, ContStart shift_from = ContStart::Back)
+	Vec<CT> HermiteInterpolateAndSolve(HermiteInterpolator<CT> & interpolator, CT const& target_time, const unsigned int num_sample_points, const TimeCont<CT> & times, const SampCont<CT> & samples, const SampCont<CT> & derivatives, ContStart shift_from = ContStart::Back)
 {
 	assert((times.size() >= num_sample_points) && "must have sufficient number of sample times");
 	assert((samples.size() >= num_sample_points) && "must have sufficient number of sample points");
@@ -79,52 +179,22 @@ template<typename CT>
 		num_t = num_s = num_d = num_sample_points-1;
 	}
 
-	Mat< Vec<CT> > space_differences(2*num_sample_points,2*num_sample_points);
-	Vec<CT> time_differences(2*num_sample_points);
-
-
+	interpolator.Reset();
 	for(unsigned int ii=0; ii<num_sample_points; ++ii)
-	{ 
-		space_differences(2*ii,0)   = samples[    num_s-ii];		/*  F[2*i][0]    = samples[i];    */
-		space_differences(2*ii+1,0) = samples[    num_s-ii]; 	/*  F[2*i+1][0]  = samples[i];    */
-		space_differences(2*ii+1,1) = derivatives[num_d-ii];		/*  F[2*i+1][1]  = derivatives[i]; */
-		time_differences(2*ii)      = times[      num_t-ii];		/*  z[2*i]       = times[i];       */
-		time_differences(2*ii+1)    = times[      num_t-ii];		/*  z[2*i+1]     = times[i];       */
-	}
-
-	//Add first round of finite differences to fill out rest of matrix. 
-	for(unsigned int ii=1; ii< num_sample_points; ++ii)
-	{
-		space_differences(2*ii,1) = (space_differences(2*ii,0) - space_differences(2*ii-1,0)) / (time_differences(2*ii) - time_differences(2*ii-1));
-	
-	}
+		interpolator.AddNode(times[num_t-ii], samples[num_s-ii], derivatives[num_d-ii]);
 
-	//Filling out finite difference matrix to get the diagonal for hermite interpolation polyonomial.
-	for(unsigned int ii=2; ii < 2*num_sample_points; ++ii)
-	{
-		for(unsigned int jj=2; jj <=ii; ++jj)
-		{
-			space_differences(ii,jj) = 
-				(space_differences(ii,jj-1) - space_differences(ii-1,jj-1)) 
-					/ 
-				(time_differences(ii) - time_differences(ii-jj));						
-		}
-	}
-
-	//Start of Result from Hermite polynomial, this is using the diagonal of the 
-	//finite difference matrix.
-	Vec<CT> Result = space_differences(2*num_sample_points - 1,2*num_sample_points - 1); 
+	return interpolator.Evaluate(target_time);
+} //re: HermiteInterpolateAndSolve
 
 
-	//This builds the hermite polynomial from the highest term down. 
-	//As we multiply the previous result we will construct the highest term down to the last term.
-	for (unsigned ii=num_sample_points-1; ii >= 1; --ii)
-	{
-		Result = ((Result*(target_time - time_differences(ii)) + space_differences(2*ii, 2*ii)) * (target_time - time_differences(ii-1)) + space_differences(2*ii-1, 2*ii-1)).eval();  
-	}
-	
-	// Last term in hermite polynomial.
-	return (Result * (target_time - time_differences(0)) + space_differences(0,0)).eval(); 
-} //re: HermiteInterpolateAndSolve
+/**
+\brief Estimates the root to interpolating polynomial, using a fresh interpolator.  See the overload taking a HermiteInterpolator, to reuse its storage.
+*/
+template<typename CT>		
+	Vec<CT> HermiteInterpolateAndSolve(CT const& target_time, const unsigned int num_sample_points, const TimeCont<CT> & times, const SampCont<CT> & samples, const SampCont<CT> & derivatives, ContStart shift_from = ContStart::Back)
+{
+	HermiteInterpolator<CT> interpolator;
+	return HermiteInterpolateAndSolve(interpolator, target_time, num_sample_points, times, samples, derivatives, shift_from);
+}
 
 }}  // re: namespaces
@@ -77,6 +77,10 @@ virtual void Observe(AnyEvent const& e) override
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "closed a loop, cycle number " << p->Get().CycleNumber();
 	}
+	else if (auto p = dynamic_cast<const SamplesDoubled<EmitterT>*>(&e))
+	{
+		BOOST_LOG_TRIVIAL(severity_level::debug) << "doubled the samples around the loops";
+	}
 	else if (auto p = dynamic_cast<const ApproximatedRoot<EmitterT>*>(&e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "approximated the target root.  approximation " << p->Get().template FinalApproximation<BCT>() << " with error " << p->Get().ApproximateError();
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "bertini2/endgames/base_endgame.hpp"
+#include "bertini2/mpfr_lu.hpp"
 
 
 namespace bertini{ namespace endgame{
@@ -208,10 +209,20 @@ protected:
 	mutable TupleOfSamps samples_;
 
 	/**
-	\brief Holds the derivatives at each space point. 
+	\brief Holds the derivatives at each space point.  Computed only for samples which don't have one yet, so may be shorter than samples_ until ComputeAllDerivatives() is called.
 	*/			
 	mutable TupleOfSamps derivatives_;
 
+	/**
+	\brief Workspace for the LU factorization of the Jacobian, when computing derivatives.
+	*/
+	mutable std::tuple<PivotedLU<BCT>> derivative_lu_;
+
+	/**
+	\brief Workspace for the Hermite interpolation.
+	*/
+	mutable typename NeededTypes::template ToTupleOfCont<HermiteInterpolator> interpolators_;
+
 	/**
 	\brief Random vector used in computing an upper bound on the cycle number. 
 	*/
@@ -247,13 +258,18 @@ public:
 	{
 		std::get<TimeCont<CT> >(times_).clear(); 
 		std::get<SampCont<CT> >(samples_).clear();
+		std::get<SampCont<CT> >(derivatives_).clear();
 	}
 
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetTimes(TimeCont<CT> const& times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set;}
+	void SetTimes(TimeCont<CT> const& times_to_set) 
+	{ 
+		std::get<TimeCont<CT> >(times_) = times_to_set;
+		std::get<SampCont<CT> >(derivatives_).clear();
+	}
 
 	/**
 	\brief Function to get the times used for the Power Series endgame.
@@ -271,7 +287,11 @@ public:
 	\brief Function to set the space values used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetSamples(SampCont<CT> const& samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set;}
+	void SetSamples(SampCont<CT> const& samples_to_set) 
+	{ 
+		std::get<SampCont<CT> >(samples_) = samples_to_set;
+		std::get<SampCont<CT> >(derivatives_).clear();
+	}
 
 	/**
 	\brief Function to get the space values used for the Power Series endgame.
@@ -279,6 +299,12 @@ public:
 	template<typename CT>
 	const auto& GetSamples() const {return std::get<SampCont<CT> >(samples_);}
 
+	/**
+	\brief Function to get the derivatives at the samples, as of the last ComputeAllDerivatives().
+	*/	
+	template<typename CT>
+	const auto& GetDerivatives() const {return std::get<SampCont<CT> >(derivatives_);}
+
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
@@ -408,7 +434,7 @@ public:
 
 			std::tie(s_times, s_derivatives) = TransformToSPlane(candidate, t0, num_pts, ContStart::Front);
 			RT cand_power{1/static_cast<RT>(candidate)};
-			RT curr_diff = (HermiteInterpolateAndSolve<CT>(
+			RT curr_diff = (HermiteInterpolateAndSolve<CT>(std::get<HermiteInterpolator<CT>>(interpolators_),
 								  pow((most_recent_time-t0)/(times[0]-t0),cand_power), // the target time
 			                      num_pts,s_times,samples,s_derivatives, ContStart::Front) // the input data
 			                 - 
@@ -438,6 +464,9 @@ public:
 
 		##Details:
 				\tparam CT The complex number type.
+				Derivatives are kept from one call to the next, as samples move through the window, so only samples added since the last call need one computed -- usually just the newest.  They are all recomputed if the precision of the samples has gone up since.
+
+				Each derivative takes one evaluation of the system, for both the Jacobian and the time derivative, and the factorization reuses its workspace.
 	*/
 	template<typename CT>
 	void ComputeAllDerivatives()
@@ -452,13 +481,22 @@ public:
 		{
 			auto max_precision = this->EnsureAtUniformPrecision(times, samples);
 			this->GetSystem().precision(max_precision);
+
+			if (!derivatives.empty() && Precision(derivatives.front())!=max_precision)
+				derivatives.clear();
 		}
 
-		//Compute dx_dt for each sample.
-		derivatives.clear(); derivatives.resize(samples.size());
-		for(unsigned ii = 0; ii < samples.size(); ++ii)
+		if (derivatives.size() > samples.size())
+			derivatives.clear();
+
+		//Compute dx_dt for each sample which doesn't have one.
+		const auto& sys = this->GetSystem();
+		auto& LU = std::get<PivotedLU<CT>>(derivative_lu_);
+		for(auto ii = derivatives.size(); ii < samples.size(); ++ii)
 		{	
-			derivatives[ii] = -this->GetSystem().Jacobian(samples[ii],times[ii]).lu().solve(this->GetSystem().TimeDerivative(samples[ii],times[ii]));
+			sys.template SetAndReset<CT>(samples[ii],times[ii]);
+			LU.compute(sys.template JacobianView<CT>());
+			derivatives.push_back(-LU.solve(sys.template TimeDerivativeView<CT>()));
 		}
 	}
 
@@ -541,7 +579,7 @@ public:
 		// the data was transformed to be on the interval [0 1] so we can hard-code the time-to-solve as 0 here.
 
 		Precision(result, Precision(s_derivatives.back()));
-		result = HermiteInterpolateAndSolve(CT(0), num_pts, s_times, std::get<SampCont<CT> >(samples_), s_derivatives, ContStart::Back);
+		result = HermiteInterpolateAndSolve(std::get<HermiteInterpolator<CT>>(interpolators_), CT(0), num_pts, s_times, std::get<SampCont<CT> >(samples_), s_derivatives, ContStart::Back);
 		return SuccessCode::Success;
 	}//end ComputeApproximationOfXAtT0
 
@@ -578,7 +616,7 @@ public:
 
   		if (abs(next_time - target_time) < this->EndgameSettings().min_track_time) // generalized for target_time not equal to 0.
   		{
-  			NotifyObservers(MinTrackTimeReached<EmitterType>(*this));
+  			this->template Emit<MinTrackTimeReached<EmitterType>>(*this);
   			return SuccessCode::MinTrackTimeReached;
   		}
 
@@ -586,7 +624,7 @@ public:
 			if (tracking_success != SuccessCode::Success)
 				return tracking_success;
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template Emit<InEGOperatingZone<EmitterType>>(*this);
 
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 	
@@ -602,19 +640,27 @@ public:
 										this->EndgameSettings().max_num_newton_iterations);
 		if (refine_success != SuccessCode::Success)
 		{
-			NotifyObservers(RefiningFailed<EmitterType>(*this));
+			this->template Emit<RefiningFailed<EmitterType>>(*this);
 			return refine_success;
 		}
 		
 		this->EnsureAtPrecision(times.back(),Precision(samples.back()));
 
-		NotifyObservers(SampleRefined<EmitterType>(*this));
+		this->template Emit<SampleRefined<EmitterType>>(*this);
 
 		// we keep one more samplepoint than needed around, for estimating the cycle number
 		if (times.size() > this->EndgameSettings().num_sample_points+1)
 		{
 			times.pop_front();
 			samples.pop_front();
+			if (!derivatives.empty())
+				derivatives.pop_front();
+		}
+
+		if (this->IsDiverging(times, samples, target_time))
+		{
+			this->template Emit<DivergenceDetected<EmitterType>>(*this);
+			return SuccessCode::GoingToInfinity;
 		}
 
  		return SuccessCode::Success;
@@ -669,7 +715,7 @@ public:
 
 		if (initial_sample_success!=SuccessCode::Success)
 		{
-			NotifyObservers(EndgameFailure<EmitterType>(*this));
+			this->template Emit<EndgameFailure<EmitterType>>(*this);
 			return initial_sample_success;
 		}
 
@@ -698,7 +744,7 @@ public:
 	  		auto advance_code = AdvanceTime<CT>(target_time);
 	  		if (advance_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template Emit<EndgameFailure<EmitterType>>(*this);
 	 			return advance_code;
 	 		}
 
@@ -709,12 +755,12 @@ public:
 	 		extrapolation_code = ComputeApproximationOfXAtT0(latest_approx, target_time);
 	 		if (extrapolation_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template Emit<EndgameFailure<EmitterType>>(*this);
 	 			return extrapolation_code;
 	 		}
 
 	 		approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-	 		NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+	 		this->template Emit<ApproximatedRoot<EmitterType>>(*this);
 
 
 	 		if(this->SecuritySettings().level <= 0)
@@ -722,7 +768,7 @@ public:
 	 			norm_of_dehom_of_latest_approx = this->GetSystem().DehomogenizePoint(latest_approx).template lpNorm<Eigen::Infinity>();
 		 		if(norm_of_dehom_of_latest_approx > this->SecuritySettings().max_norm && norm_of_dehom_of_prev_approx > this->SecuritySettings().max_norm)
 		 		{
-		 			NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+		 			this->template Emit<SecurityMaxNormReached<EmitterType>>(*this);
 	 				return SuccessCode::SecurityMaxNormReached;
 		 		}
 	 			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
@@ -735,7 +781,7 @@ public:
 	 		prev_approx = latest_approx;
 		} //end while	
 
-		NotifyObservers(Converged<EmitterType>(*this));
+		this->template Emit<Converged<EmitterType>>(*this);
 		return SuccessCode::Success;
 
 	} //end PSEG
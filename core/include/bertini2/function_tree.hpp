@@ -51,6 +51,7 @@
 #include "bertini2/function_tree/roots/jacobian.hpp"
 
 #include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/function_tree/factory.hpp"
 
 
 
@@ -0,0 +1,155 @@
+//This file is part of Bertini 2.
+//
+//b2/core/include/bertini2/function_tree/factory.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2/core/include/bertini2/function_tree/factory.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2/core/include/bertini2/function_tree/factory.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//  silviana amethyst, university of wisconsin-eau claire
+
+/**
+\file include/bertini2/function_tree/factory.hpp 
+
+\brief An interning factory for function tree nodes, so that structurally identical subtrees exist once.
+*/
+
+
+#ifndef BERTINI_FUNCTION_TREE_FACTORY_HPP
+#define BERTINI_FUNCTION_TREE_FACTORY_HPP
+
+#pragma once
+
+#include "bertini2/function_tree/node.hpp"
+
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief A unary operator of the same kind as n, on another operand.  For changing a tree without changing nodes which may be shared with others.
+
+	\return nullptr for a kind of unary operator this doesn't know how to make.
+	*/
+	std::shared_ptr<UnaryOperator> WithOperand(std::shared_ptr<UnaryOperator> const& n, std::shared_ptr<Node> const& operand);
+
+
+
+	/**
+	\brief Hash-consing table for function tree nodes.
+
+	Maps the structure of a node -- its type, the identities of its already-interned operands, and whatever data tells it apart from others of its type, such as signs, an integer exponent, or a numeric value -- to a single representative node.  Interning trees through one factory turns them into a DAG in which structurally identical subtrees exist exactly once.  The duplicates are released when nothing else holds them, and since the SLPCompiler keys on node identity, each common subexpression is then compiled and evaluated once.
+
+	Variables, differentials, linear products and function handles are distinct by identity.  The entry node of a handle is interned, but the handle itself is never merged with another.
+
+	Interning never changes a node, since it may be shared with trees which aren't being interned.  Where the operands of a node have other representatives, its representative is a copy of it on those.  Handles are the exception: a handle keeps its identity, and is given the representative of its entry node as its root.
+
+	\code
+	node::NodeFactory factory;
+	for (auto& f : functions)
+		factory.Intern(f);
+	\endcode
+	*/
+	class NodeFactory
+	{
+	public:
+
+		/**
+		\brief Intern a node and everything beneath it.
+
+		\param n The node to intern.
+		\return The representative of n's structure.  Either n itself, or a structurally identical node interned earlier.
+		*/
+		std::shared_ptr<Node> Intern(std::shared_ptr<Node> const& n);
+
+
+		/**
+		\brief Make a node, and intern it.
+
+		\tparam T The type of node to make.  Its Make function is forwarded the arguments.
+		\return The representative of the new node's structure.
+		*/
+		template<typename T, typename... Ts>
+		std::shared_ptr<Node> Make(Ts&& ...ts)
+		{
+			return Intern(T::Make(std::forward<Ts>(ts)...));
+		}
+
+
+		/**
+		\brief The number of structurally distinct nodes interned so far.
+		*/
+		size_t NumDistinct() const
+		{
+			return representatives_.size();
+		}
+
+
+		/**
+		\brief The number of nodes seen so far, including ones which turned out to be duplicates.
+		*/
+		size_t NumSeen() const
+		{
+			return seen_.size();
+		}
+
+
+		/**
+		\brief Forget everything interned so far.
+		*/
+		void Clear()
+		{
+			representatives_.clear();
+			seen_.clear();
+		}
+
+	private:
+
+		/**
+		\brief What tells a node apart from others of its type: the representatives of its operands, and its own data, such as signs, an integer exponent, or a numeric value.
+		*/
+		struct Key
+		{
+			std::type_index type;
+			std::vector<const Node*> operands;
+			std::vector<bool> flags; // the signs of a sum, or whether each factor of a product multiplies or divides
+			int exponent = 0; // of an integer power
+			std::shared_ptr<Node> number; // an Integer, Rational or Float, compared by value
+
+			bool operator==(Key const& other) const;
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(Key const& k) const;
+		};
+
+		// the operand pointers in the keys are the representatives, which this map holds alive.
+		std::unordered_map< Key, std::shared_ptr<Node>, KeyHash > representatives_;
+
+		// from every node seen to its representative.  holds the seen nodes alive too, so their addresses cannot be recycled while the factory is in use.
+		std::unordered_map< const Node*, std::pair< std::shared_ptr<Node>, std::shared_ptr<Node> > > seen_;
+	};
+
+} // namespace node
+} // namespace bertini
+
+
+#endif //include guards
@@ -45,6 +45,8 @@
 #include "bertini2/config.h"
 
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -399,6 +401,54 @@ private:
 
 
 
+	/**
+	\brief Memo table for symbolic differentiation.
+
+	While an instance is alive, derivatives taken through DifferentiationMemo::Derivative are remembered by (node, variable) pair.  A node reachable along several paths through the expression DAG -- a subfunction used by several functions, say -- is then differentiated only once per variable, and the derivative DAG shares structure the same way the original does, instead of growing into a tree.
+
+	Instances nest.  Only the outermost one on a thread owns the table; inner ones are no-ops, so it is always safe to open one.
+	*/
+	class DifferentiationMemo
+	{
+	public:
+		DifferentiationMemo();
+		~DifferentiationMemo();
+
+		DifferentiationMemo(DifferentiationMemo const&) = delete;
+		DifferentiationMemo& operator=(DifferentiationMemo const&) = delete;
+
+		/**
+		\brief Differentiate a node, consulting the active memo table.
+
+		Operators should differentiate their operands through this, rather than by calling Differentiate on them directly.  If no table is active, one is opened for the duration of the call.
+
+		\param n The node to differentiate.
+		\param v The variable with respect to which to differentiate.  nullptr for the Jacobian-style derivative.
+		*/
+		static std::shared_ptr<Node> Derivative(std::shared_ptr<Node> const& n, std::shared_ptr<Variable> const& v);
+
+	private:
+		// keys hold the nodes alive, so their addresses cannot be recycled while the table is in use.
+		using Key = std::pair< std::shared_ptr<const Node>, std::shared_ptr<const Variable> >;
+		using Table = std::map< Key, std::shared_ptr<Node> >;
+
+		static thread_local Table* active_;
+		std::unique_ptr<Table> owned_;
+	};
+
+
+	/**
+	\brief Whether a node is a Number whose value is exactly zero.  Used to short-circuit differentiation.
+	*/
+	bool IsZeroNumber(std::shared_ptr<Node> const& n);
+
+	/**
+	\brief Whether a node is a Number whose value is exactly one.  Used to short-circuit differentiation.
+	*/
+	bool IsOneNumber(std::shared_ptr<Node> const& n);
+
+
+
 	// inherit from this to get a nice method of producing shared pointers to specific type, solving the diamond problem
 	//
 	// T is a derived type
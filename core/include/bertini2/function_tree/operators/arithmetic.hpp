@@ -150,6 +150,17 @@ namespace node{
 			NaryOperator::AddOperand(std::move(child));
 			signs_.push_back(sign);
 		}
+
+
+		/**
+		\brief Replace all the terms at once.
+
+		\param operands The new terms.  Must not be empty.
+		\param signs The signs of the new terms, true = add, false = subtract.
+
+		\throws std::runtime_error if the sizes differ, or there are no terms.
+		*/
+		void SetOperands(std::vector<std::shared_ptr<Node>> operands, std::vector<bool> signs);
 		
 		
 		/**
@@ -432,6 +443,17 @@ namespace node{
 			NaryOperator::AddOperand(std::move(child));
 			mult_or_div_.push_back(mult);
 		}
+
+
+		/**
+		\brief Replace all the factors at once.
+
+		\param operands The new factors.  Must not be empty.
+		\param mult_or_div Whether each new factor multiplies or divides, true = mult, false = divide.
+
+		\throws std::runtime_error if the sizes differ, or there are no factors.
+		*/
+		void SetOperands(std::vector<std::shared_ptr<Node>> operands, std::vector<bool> mult_or_div);
 		
 		
 		/**
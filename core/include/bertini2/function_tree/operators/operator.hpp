@@ -179,6 +179,12 @@ namespace node{
 		
 		
 		size_t NumOperands() const;
+
+
+		/**
+		\brief Replace the operand at a position.  The meaning of the position (its sign, say) is unchanged.
+		*/
+		void SetOperand(size_t index, std::shared_ptr<Node> n);
 		
 		inline auto const& Operands() const{
 			return operands_;
@@ -27,7 +27,7 @@
 
 \brief simplification methods for nodal functions
 
-General methods exploting polymorphism, for simplifying a Node, and all subnodes
+A worklist-driven simplifier for a Node, and all subnodes, with constant folding and collection of like terms and factors
 */
 
 
@@ -37,11 +37,126 @@ General methods exploting polymorphism, for simplifying a Node, and all subnodes
 #pragma once
 
 #include "bertini2/function_tree/node.hpp"
+#include "bertini2/function_tree/factory.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
 
 namespace bertini {
 
+/**
+\brief Counts and timings from simplifying function trees.
+*/
+struct SimplificationStatistics
+{
+	size_t nodes_visited = 0; ///< Distinct nodes visited.  Shared subtrees count once.
+	size_t rewrites = 0; ///< Nodes replaced by simpler ones.
+	size_t constants_folded = 0; ///< Numbers combined arithmetically with other numbers.
+	size_t terms_merged = 0; ///< Summands combined with identical ones, up to a numeric coefficient.
+	size_t factors_merged = 0; ///< Factors combined with identical ones, or integer powers of them.
+	std::chrono::duration<double> elapsed{0}; ///< Time spent simplifying, in seconds.
+
+	SimplificationStatistics& operator+=(SimplificationStatistics const& other);
+};
+
+std::ostream& operator<<(std::ostream& out, SimplificationStatistics const& s);
+
+
+
+/**
+\brief Simplifies function trees, visiting each node once.
+
+Nodes are visited in post-order, using an explicit worklist rather than recursion, so the operands of a node are already simplified when it is.  The simplified form of every node visited is remembered, so a subtree shared by many parents, or by many trees passed to the same Simplifier, is simplified once.  Each node is then rewritten by local rules:
+
+* sums and products are flattened into their parents,
+* numeric operands of sums and products are folded together, exactly for integers and rationals,
+* summands which differ only by a numeric coefficient are merged, as are factors which are integer powers of the same base, in the numerator or in the denominator,
+* zero and unit terms and factors are dropped, and trivial integer powers, powers, negations and functions of constants are collapsed.
+
+Identical subtrees are recognized by interning through a NodeFactory, so merging works on structure, not just identity.
+
+Nodes are never changed, since they may be shared with trees which aren't being simplified.  A node which simplifies is replaced by another, so a tree's simplified form is reached from the node Simplify returns.  SimplifyInPlace alone changes the node passed to it, and nothing beneath it.  Factors in the numerator aren't cancelled against the same ones in the denominator, unless they are nonzero constants, so x/x stays as it is rather than losing x=0 from its domain.  Function handles are not descended into.
+
+\code
+Simplifier s;
+for (auto& d : derivatives)
+	s.SimplifyInPlace(d);
+std::cout << s.Statistics();
+\endcode
+*/
+class Simplifier
+{
+public:
+
+	/**
+	\brief Simplify a node and everything beneath it.
+
+	\param n The node to simplify.
+	\return The simplest node found equal to n.  This may be n itself, or another node entirely, such as one of its operands, or a number.
+	*/
+	std::shared_ptr<node::Node> Simplify(std::shared_ptr<node::Node> const& n);
+
+	/**
+	\brief Simplify a node and everything beneath it, keeping the identity of the node.
+
+	If the node would be replaced, a sum or product gets the replacement's terms or factors.  Other nodes keep their type, with their operands simplified.
+
+	\return The number of nodes replaced by simpler ones, n's own replacement included.  Zero if nothing could be simplified.
+	*/
+	unsigned SimplifyInPlace(std::shared_ptr<node::Node> const& n);
+
+	/**
+	\brief The counts and timings, accumulated over everything simplified since construction or the last Clear.
+	*/
+	SimplificationStatistics const& Statistics() const
+	{
+		return statistics_;
+	}
+
+	/**
+	\brief Forget everything simplified so far, and reset the statistics.
+	*/
+	void Clear();
+
+private:
+
+	std::shared_ptr<node::Node> Visit(std::shared_ptr<node::Node> const& n);
+	std::shared_ptr<node::Node> Rewrite(std::shared_ptr<node::Node> const& n);
+	std::shared_ptr<node::Node> RewriteSum(std::shared_ptr<node::SumOperator> const& n, std::vector<std::shared_ptr<node::Node>> const& operands, std::vector<bool> const& signs);
+	std::shared_ptr<node::Node> RewriteMult(std::shared_ptr<node::MultOperator> const& n, std::vector<std::shared_ptr<node::Node>> const& operands, std::vector<bool> const& mult_or_div);
+	std::shared_ptr<node::Node> RewriteUnary(std::shared_ptr<node::UnaryOperator> const& n);
+	std::shared_ptr<node::Node> RewritePower(std::shared_ptr<node::PowerOperator> const& n);
+
+	std::shared_ptr<node::Node> const& Simplified(std::shared_ptr<node::Node> const& n) const;
+
+	// from every node visited to its simplified form.  holds the visited nodes alive too, so their addresses cannot be recycled.
+	std::unordered_map< const node::Node*, std::pair< std::shared_ptr<node::Node>, std::shared_ptr<node::Node> > > simplified_;
+
+	node::NodeFactory factory_;
+
+	SimplificationStatistics statistics_;
+};
+
+
+
+/**
+\brief Simplify a node in place, as Simplifier::SimplifyInPlace does.  The nodes beneath it are left as they are, and it refers to their simplified forms instead.
+
+\return The number of nodes replaced by simpler ones.  This used to be the number of rounds of simplification, which were repeated until nothing changed.  Now there is one pass, and zero means nothing could be simplified.
+
+\see Simplifier
+*/
 unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n);
 
+/**
+\brief Simplify a node in place, as Simplifier::SimplifyInPlace does, accumulating statistics.
+
+\return The number of nodes replaced by simpler ones.
+*/
+unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n, SimplificationStatistics & stats);
+
 } // namespace bertini
 
 
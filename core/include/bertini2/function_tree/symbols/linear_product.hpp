@@ -40,6 +40,8 @@
 #ifndef BERTINI_FUNCTION_TREE_LINPRODUCT_HPP
 #define BERTINI_FUNCTION_TREE_LINPRODUCT_HPP
 
+#include <numeric>
+
 #include "bertini2/function_tree.hpp"
 
 #include "bertini2/eigen_extensions.hpp"
@@ -393,7 +395,7 @@ namespace  bertini {
 			/**
 			 \brief Are there rational coefficients?
 			*/
-			bool IsRationalCoefficients()
+			bool IsRationalCoefficients() const
 			{
 				return is_rational_coeffs_;
 			}
@@ -420,6 +422,61 @@ namespace  bertini {
 				
 				return coeff_ret;
 			}
+
+
+
+			/**
+			 \brief The number of linear factors in the product.
+			*/
+			size_t NumFactors() const
+			{
+				return num_factors_;
+			}
+
+
+			/**
+			 \brief The number of variables in each linear factor, not counting the homogenizing variable.
+			*/
+			size_t NumVariables() const
+			{
+				return num_variables_;
+			}
+
+
+			/**
+			 \brief The linear product this one was broken off from by GetLinears, or this one itself if it was not broken off another.
+
+			 Products broken off the same source share its linear factors, which lets the SLP compiler evaluate each linear of the source once, however many derivative terms it appears in.
+			*/
+			std::shared_ptr<const LinearProduct> Source() const
+			{
+				if (source_)
+					return source_;
+				return shared_from_this();
+			}
+
+
+			/**
+			 \brief Which factors of Source() make up this linear product, in order.
+			*/
+			std::vector<size_t> SourceFactors() const
+			{
+				if (source_)
+					return source_factors_;
+
+				std::vector<size_t> factors(num_factors_);
+				std::iota(factors.begin(), factors.end(), 0);
+				return factors;
+			}
+
+
+			/**
+			 \brief Make a number node holding one coefficient at its true value, rational if possible.
+
+			 \param factor The index of the linear factor.
+			 \param term The index of the variable, or NumVariables() for the coefficient of the homogenizing variable.
+			*/
+			std::shared_ptr<Node> CoefficientAsNode(size_t factor, size_t term) const;
 			
 			
 
@@ -580,6 +637,9 @@ namespace  bertini {
 			bool is_rational_coeffs_; ///< Do we have a rational coefficient to downsample from?
 			bool is_homogenized_ = false;  ///< Have we homogenized the linear product?
 			bool is_hom_vars_ = false;  ///< Is this linear for a homogeneous variable group?
+
+			std::shared_ptr<const LinearProduct> source_; ///< The linear product this one was broken off from by GetLinears.  nullptr if not broken off another.
+			std::vector<size_t> source_factors_; ///< Which factors of source_ this one consists of.  Empty if not broken off another.
 			
 			
 			mutable std::vector<dbl> temp_var_d_;
@@ -700,6 +760,15 @@ namespace  bertini {
 			
             std::shared_ptr<LinearProduct> GetLinears(std::vector<size_t> indices) const;
 
+
+
+			/**
+			 \brief Record that a linear product was broken off from this one, consisting of the factors with given indices.
+
+			 \return The broken off linear product.
+			*/
+			std::shared_ptr<LinearProduct> RecordSource(std::shared_ptr<LinearProduct> const& broken_off, std::vector<size_t> const& indices) const;
+
 			
 			
 			void SetupVariables(size_t num_factors, VariableGroup const& variables)
@@ -795,11 +864,28 @@ namespace  bertini {
 			 \brief Create a linear differential node. Only a linear, not a product.
 			 
 			 \param linear The linear that we are differentiating.
+			 \param diff_variable The variable we are differentiating with respect to.  If nullptr, the variable passed in at evaluation time is used, as for Jacobian nodes.
 			 
 			 */
-			DiffLinear(std::shared_ptr<LinearProduct> const& linear);
+			DiffLinear(std::shared_ptr<LinearProduct> const& linear, std::shared_ptr<Variable> const& diff_variable = nullptr);
 			
 		public:
+
+			/**
+			 \brief The linear which this is the differential of.
+			*/
+			std::shared_ptr<const LinearProduct> const& Linear() const
+			{
+				return linear_;
+			}
+
+			/**
+			 \brief The variable this is the differential with respect to, or nullptr if it is determined at evaluation time.
+			*/
+			std::shared_ptr<Variable> const& DiffVariable() const
+			{
+				return diff_variable_;
+			}
 			
 			
 			
@@ -971,9 +1057,12 @@ namespace  bertini {
 			 */
 			void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 			{
+				// a variable fixed at construction takes precedence over the one passed in
+				auto const& v = diff_variable_ ? diff_variable_ : diff_variable;
+
 				for(int ii = 0; ii < variables_.size(); ++ii)
 				{
-					if(diff_variable == variables_[ii])
+					if(v == variables_[ii])
 					{
 						auto& coeff_ref = std::get<Mat<dbl>>(coeffs_);
 						evaluation_value = coeff_ref(0,ii);
@@ -982,10 +1071,10 @@ namespace  bertini {
 				}
 				
 				// If not one of the affine variables
-				if(diff_variable == hom_variable_)
+				if(v == hom_variable_)
 				{
 					auto& coeff_ref = std::get<Mat<dbl>>(coeffs_);
-					evaluation_value = coeff_ref(0,variables_.size()-1);
+					evaluation_value = coeff_ref(0,num_variables_);
 					return;
 				}
 				
@@ -1018,9 +1107,12 @@ namespace  bertini {
 			 */
 			void FreshEval_mp(mpfr_complex& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 			{
+				// a variable fixed at construction takes precedence over the one passed in
+				auto const& v = diff_variable_ ? diff_variable_ : diff_variable;
+
 				for(int ii = 0; ii < variables_.size(); ++ii)
 				{
-					if(diff_variable == variables_[ii])
+					if(v == variables_[ii])
 					{
 						auto& coeff_ref = std::get<Mat<mpfr_complex>>(coeffs_);
 						evaluation_value = coeff_ref(0,ii);
@@ -1029,10 +1121,10 @@ namespace  bertini {
 				}
 				
 				// If not one of the affine variables
-				if(diff_variable == hom_variable_)
+				if(v == hom_variable_)
 				{
 					auto& coeff_ref = std::get<Mat<mpfr_complex>>(coeffs_);
-					evaluation_value = coeff_ref(0,variables_.size()-1);
+					evaluation_value = coeff_ref(0,num_variables_);
 					return;
 				}
 				
@@ -1076,6 +1168,10 @@ namespace  bertini {
 			
 			
 			size_t num_variables_;  ///< The number of variables in each linear.
+
+			std::shared_ptr<const LinearProduct> linear_; ///< The linear this is the differential of.
+
+			std::shared_ptr<Variable> diff_variable_; ///< The variable of differentiation, if fixed at construction.
 			
 			
 			
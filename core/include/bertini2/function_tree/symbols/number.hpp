@@ -185,6 +185,15 @@ namespace node{
 
 		void print(std::ostream & target) const override;
 
+
+		/**
+		\brief The exact value of this Integer.
+		*/
+		mpz_int const& TrueValue() const
+		{
+			return true_value_;
+		}
+
 		template<typename... Ts> 
 		static 
 		std::shared_ptr<Integer> Make(Ts&& ...ts){ 
@@ -262,6 +271,15 @@ namespace node{
 		void print(std::ostream & target) const override;
 
 
+		/**
+		\brief The value this Float was made from, at its full precision.
+		*/
+		mpfr_complex const& HighestPrecisionValue() const
+		{
+			return highest_precision_value_;
+		}
+
+
 		template<typename... Ts> 
 		static 
 		std::shared_ptr<Float> Make(Ts&& ...ts){ 
@@ -360,7 +378,21 @@ namespace node{
 		void print(std::ostream & target) const override;
 
 
+		/**
+		\brief The exact real part of this Rational.
+		*/
+		mpq_rational const& TrueValueReal() const
+		{
+			return true_value_real_;
+		}
 
+		/**
+		\brief The exact imaginary part of this Rational.
+		*/
+		mpq_rational const& TrueValueImag() const
+		{
+			return true_value_imag_;
+		}
 
 		
 		template<typename... Ts> 
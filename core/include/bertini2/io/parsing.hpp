@@ -31,6 +31,7 @@
 #pragma once
 
 #include "bertini2/io/parsing/classic_utilities.hpp"
+#include "bertini2/io/parsing/fast_system_parser.hpp"
 #include "bertini2/io/parsing/function_parsers.hpp"
 #include "bertini2/io/parsing/number_parsers.hpp"
 #include "bertini2/io/parsing/settings_parsers.hpp"
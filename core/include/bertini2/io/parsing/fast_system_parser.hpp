@@ -0,0 +1,740 @@
+//This file is part of Bertini 2.
+//
+//bertini2/io/parsing/fast_system_parser.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/io/parsing/fast_system_parser.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/io/parsing/fast_system_parser.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+ \file bertini2/io/parsing/fast_system_parser.hpp
+
+ \brief Provides a hand-written recursive-descent parser for Bertini Classic input, for systems too large for the Qi grammar.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "bertini2/system/system.hpp"
+#include "bertini2/io/file_utilities.hpp"
+
+
+namespace bertini {
+	namespace parsing {
+		namespace classic {
+
+			namespace detail {
+
+				/**
+				 A position in the text being parsed, with the whitespace and '%' comment skipping, and the error reporting, shared by the statement splitter and the expression parser.
+				 */
+				struct Cursor
+				{
+					char const* buffer_begin; // for counting lines when reporting errors
+					char const* pos;
+					char const* end;
+
+					void SkipSpace()
+					{
+						while (pos < end)
+						{
+							if (std::isspace(static_cast<unsigned char>(*pos)))
+								++pos;
+							else if (*pos=='%')
+								while (pos < end && *pos!='\n')
+									++pos;
+							else
+								break;
+						}
+					}
+
+					bool AtEnd()
+					{
+						SkipSpace();
+						return pos==end;
+					}
+
+					char Peek()
+					{
+						SkipSpace();
+						return pos < end ? *pos : '\0';
+					}
+
+					bool Accept(char c)
+					{
+						if (Peek()!=c)
+							return false;
+						++pos;
+						return true;
+					}
+
+					void Expect(char c)
+					{
+						if (!Accept(c))
+							Fail(std::string("expected '") + c + "'");
+					}
+
+					/**
+					 Read a name fitting the naming rules: a letter, followed by letters, digits, underscores and square brackets.
+					 */
+					std::string_view Name()
+					{
+						SkipSpace();
+						if (pos==end || !std::isalpha(static_cast<unsigned char>(*pos)))
+							Fail("expected a name");
+
+						auto begin = pos++;
+						while (pos < end && (std::isalnum(static_cast<unsigned char>(*pos)) || *pos=='_' || *pos=='[' || *pos==']'))
+							++pos;
+						return std::string_view(begin, pos-begin);
+					}
+
+					[[noreturn]]
+					void Fail(std::string const& message) const
+					{
+						auto line = 1 + std::count(buffer_begin, pos, '\n');
+						auto snippet_end = pos;
+						while (snippet_end < end && snippet_end-pos < 40 && *snippet_end!='\n')
+							++snippet_end;
+
+						std::stringstream err_msg;
+						err_msg << "parse error on line " << line << ": " << message << ", at '" << std::string(pos, snippet_end) << "'";
+						throw std::runtime_error(err_msg.str());
+					}
+				};
+
+
+				/**
+				 A declared name, and the statement declaring it.  A symbol can be used only in statements after its declaration, as with the Qi grammar.
+				 */
+				struct Symbol
+				{
+					std::shared_ptr<node::Node> node;
+					size_t declared_at;
+				};
+
+				// the keys point into the text being parsed, which outlives the table.
+				using SymbolTable = std::unordered_map<std::string_view, Symbol>;
+
+
+				/**
+				 Parses the body of one definition into a function tree.
+
+				 The grammar is that of the Qi FunctionParser.  Sums and products of several terms are built as single n-ary operators, rather than a chain of binary ones, and integer literal powers become IntegerPowerOperators.  The symbol table is only read, so bodies can be parsed concurrently.
+				 */
+				class ExpressionParser
+				{
+				public:
+					ExpressionParser(Cursor cursor, SymbolTable const& symbols, size_t statement, node::Node const* defining) : cursor_(cursor), symbols_(symbols), statement_(statement), defining_(defining)
+					{}
+
+					std::shared_ptr<node::Node> Parse()
+					{
+						auto result = Expression();
+						if (!cursor_.AtEnd())
+							cursor_.Fail("expected an operator");
+						return result;
+					}
+
+				private:
+
+					std::shared_ptr<node::Node> Expression()
+					{
+						auto first = Term();
+						std::shared_ptr<node::SumOperator> sum;
+						for (;;)
+						{
+							bool add;
+							if (cursor_.Accept('+'))
+								add = true;
+							else if (cursor_.Accept('-'))
+								add = false;
+							else
+								break;
+
+							auto next = Term();
+							if (!sum)
+								sum = node::SumOperator::Make(first, true);
+							sum->AddOperand(next, add);
+						}
+
+						if (sum)
+							return sum;
+						return first;
+					}
+
+					std::shared_ptr<node::Node> Term()
+					{
+						auto first = Factor();
+						std::shared_ptr<node::MultOperator> product;
+						for (;;)
+						{
+							bool mult;
+							if (cursor_.Accept('*'))
+								mult = true;
+							else if (cursor_.Accept('/'))
+								mult = false;
+							else
+								break;
+
+							auto next = Factor();
+							if (!product)
+								product = node::MultOperator::Make(first);
+							product->AddOperand(next, mult);
+						}
+
+						if (product)
+							return product;
+						return first;
+					}
+
+					// powers associate to the left, as in the Qi grammar
+					std::shared_ptr<node::Node> Factor()
+					{
+						auto base = Element();
+						while (cursor_.Accept('^'))
+						{
+							auto exponent = Element();
+							auto integer = std::dynamic_pointer_cast<node::Integer>(exponent);
+							if (integer && integer->TrueValue() >= 0 && integer->TrueValue() <= std::numeric_limits<int>::max())
+								base = node::IntegerPowerOperator::Make(base, integer->TrueValue().convert_to<int>());
+							else
+								base = node::PowerOperator::Make(base, exponent);
+						}
+						return base;
+					}
+
+					std::shared_ptr<node::Node> Element()
+					{
+						char c = cursor_.Peek();
+
+						if (c=='(')
+						{
+							++cursor_.pos;
+							auto result = Expression();
+							cursor_.Expect(')');
+							return result;
+						}
+
+						// unary signs apply to a whole factor, so -x^2 is -(x^2), and -x+y is (-x)+y
+						if (c=='-')
+						{
+							++cursor_.pos;
+							return node::NegateOperator::Make(Factor());
+						}
+						if (c=='+')
+						{
+							++cursor_.pos;
+							return Factor();
+						}
+
+						if (std::isdigit(static_cast<unsigned char>(c)) || c=='.')
+							return Number();
+
+						if (std::isalpha(static_cast<unsigned char>(c)))
+						{
+							auto at = cursor_.pos;
+							auto name = cursor_.Name();
+
+							auto found = symbols_.find(name);
+							if (found!=symbols_.end())
+							{
+								if (found->second.declared_at >= statement_ || found->second.node.get()==defining_)
+								{
+									cursor_.pos = at;
+									cursor_.Fail("symbol '" + std::string(name) + "' used before its definition");
+								}
+								return found->second.node;
+							}
+
+							if (name=="sin")  return node::sin(Argument());
+							if (name=="cos")  return node::cos(Argument());
+							if (name=="tan")  return node::tan(Argument());
+							if (name=="exp")  return node::exp(Argument());
+							if (name=="log")  return node::log(Argument());
+							if (name=="sqrt") return node::sqrt(Argument());
+
+							cursor_.pos = at;
+							cursor_.Fail("unknown symbol '" + std::string(name) + "'");
+						}
+
+						cursor_.Fail("expected a number, symbol, or parenthesized expression");
+					}
+
+					std::shared_ptr<node::Node> Argument()
+					{
+						cursor_.Expect('(');
+						auto result = Expression();
+						cursor_.Expect(')');
+						return result;
+					}
+
+					/**
+					 Numbers with a decimal point or an exponent become Floats, at the default precision.  The rest become Integers.
+					 */
+					std::shared_ptr<node::Node> Number()
+					{
+						auto& pos = cursor_.pos;
+						auto const end = cursor_.end;
+						auto const begin = pos;
+
+						auto is_digit = [&](char const* p){ return p < end && std::isdigit(static_cast<unsigned char>(*p)); };
+
+						while (is_digit(pos))
+							++pos;
+						bool is_integer = true;
+						if (pos < end && *pos=='.')
+						{
+							is_integer = false;
+							++pos;
+							while (is_digit(pos))
+								++pos;
+						}
+						if (pos-begin==1 && !is_integer)
+						{
+							pos = begin;
+							cursor_.Fail("expected digits");
+						}
+						if (pos < end && (*pos=='e' || *pos=='E'))
+						{
+							auto exponent = pos+1;
+							if (exponent < end && (*exponent=='-' || *exponent=='+'))
+								++exponent;
+							if (is_digit(exponent))
+							{
+								is_integer = false;
+								pos = exponent;
+								while (is_digit(pos))
+									++pos;
+							}
+						}
+
+						if (pos < end && (std::isalnum(static_cast<unsigned char>(*pos)) || *pos=='_'))
+							cursor_.Fail("expected an operator after a number");
+
+						if (!is_integer)
+							return node::Float::Make(std::string(begin, pos));
+
+						if (pos-begin <= 9)
+						{
+							int value = 0;
+							for (auto p = begin; p < pos; ++p)
+								value = 10*value + (*p-'0');
+							return node::Integer::Make(value);
+						}
+						return node::Integer::Make(std::string(begin, pos));
+					}
+
+
+					Cursor cursor_;
+					SymbolTable const& symbols_;
+					size_t statement_;
+					node::Node const* defining_;
+				};
+
+
+				/**
+				 Whether the text at p is the word, in any case, not run together with the surrounding text.
+				 */
+				inline
+				bool IsWordAt(char const* p, char const* begin, char const* end, std::string_view word)
+				{
+					auto is_name_char = [](char c){ return std::isalnum(static_cast<unsigned char>(c)) || c=='_'; };
+
+					if (static_cast<size_t>(end-p) < word.size())
+						return false;
+					for (size_t ii = 0; ii < word.size(); ++ii)
+						if (std::toupper(static_cast<unsigned char>(p[ii]))!=word[ii])
+							return false;
+					if (p > begin && is_name_char(p[-1]))
+						return false;
+					if (p+word.size() < end && is_name_char(p[word.size()]))
+						return false;
+					return true;
+				}
+
+				/**
+				 Find the next occurrence of the word outside comments, or end.
+				 */
+				inline
+				char const* FindWord(char const* from, char const* begin, char const* end, std::string_view word)
+				{
+					for (auto p = from; p < end; ++p)
+					{
+						if (*p=='%')
+							while (p < end && *p!='\n')
+								++p;
+						else if (IsWordAt(p, begin, end, word))
+							return p;
+					}
+					return end;
+				}
+
+				/**
+				 Find the END; closing a section starting at from, or end.
+				 */
+				inline
+				char const* FindSectionEnd(char const* from, char const* begin, char const* end)
+				{
+					for (auto p = FindWord(from, begin, end, "END"); p < end; p = FindWord(p+3, begin, end, "END"))
+					{
+						auto q = p+3;
+						while (q < end && std::isspace(static_cast<unsigned char>(*q)))
+							++q;
+						if (q < end && *q==';')
+							return p;
+					}
+					return end;
+				}
+
+				/**
+				 Locate the input section of a Bertini Classic input file, the part between INPUT and END;.  A file with neither is all input, and a file with a CONFIG section but no INPUT marker has its input after the config's END;.
+				 */
+				inline
+				std::pair<char const*, char const*> InputSection(char const* begin, char const* end)
+				{
+					auto input = FindWord(begin, begin, end, "INPUT");
+					if (input < end)
+						input += 5;
+					else
+					{
+						input = begin;
+						auto config = FindWord(begin, begin, end, "CONFIG");
+						if (config < end)
+						{
+							auto config_end = FindSectionEnd(config+6, begin, end);
+							input = config_end < end ? std::find(config_end, end, ';')+1 : end;
+						}
+					}
+
+					return {input, FindSectionEnd(input, begin, end)};
+				}
+
+			} // namespace detail
+
+
+
+
+			/**
+			 \brief A recursive-descent parser for Bertini Classic input, for large systems.
+
+			 Accepts the same language as the Qi SystemParser, and produces an equivalent System, but works directly on the characters of the input, and parses the function bodies in parallel.
+
+			 Parsing happens in two phases.  First the statements are split at their semicolons, and the declarations processed in order, so that the symbol table is complete.  Then the bodies of the definitions are parsed into function trees, concurrently, each reading the finished symbol table.  As with the Qi grammar, a symbol can only be used after the statement declaring it, and a later definition of a function replaces an earlier one.
+
+			 Sums and products are built as single n-ary operators, so a function with many terms is a shallow tree.
+
+			 \code
+			 bertini::parsing::classic::FastSystemParser parser;
+			 auto sys = parser.ParseFile("input");
+			 \endcode
+			 */
+			class FastSystemParser
+			{
+			public:
+
+				/**
+				 \param num_threads The number of threads to parse function bodies with.  0 means use as many as the hardware supports.
+				 */
+				explicit
+				FastSystemParser(unsigned num_threads = 0) : num_threads_(num_threads)
+				{
+					if (num_threads_==0)
+						num_threads_ = std::max(1u, std::thread::hardware_concurrency());
+				}
+
+
+				/**
+				 \brief Parse the statements in [begin, end) into a System.
+
+				 \throws std::runtime_error on malformed input, naming the line of the error.
+				 */
+				System Parse(char const* begin, char const* end) const
+				{
+					using namespace detail;
+
+					System sys;
+					SymbolTable symbols;
+
+					auto pi = node::Pi(), e = node::E(), i = node::I();
+					for (auto special : {std::make_pair("pi", pi), std::make_pair("Pi", pi), std::make_pair("e", e), std::make_pair("E", e), std::make_pair("i", i), std::make_pair("I", i)})
+						symbols.emplace(special.first, Symbol{special.second, 0});
+
+					// the functions, constants and parameters, which can be given definitions.
+					std::unordered_map<node::Node const*, std::shared_ptr<node::Function> > definable;
+
+					struct Definition
+					{
+						std::shared_ptr<node::Function> function;
+						Cursor body;
+						size_t statement;
+					};
+					std::vector<Definition> definitions;
+					std::unordered_map<node::Function const*, size_t> definition_of;
+
+					Cursor cursor{begin, begin, end};
+
+					auto declare = [&](std::string_view name, std::shared_ptr<node::Node> const& n, size_t statement)
+					{
+						if (IsKeyword(name))
+							cursor.Fail("'" + std::string(name) + "' is reserved");
+						if (!symbols.emplace(name, Symbol{n, statement}).second)
+							cursor.Fail("symbol '" + std::string(name) + "' declared twice");
+					};
+
+					auto names = [&]()
+					{
+						std::vector<std::string_view> result;
+						do
+							result.push_back(cursor.Name());
+						while (cursor.Accept(','));
+						cursor.Expect(';');
+						return result;
+					};
+
+
+					// phase one, the statements in order
+					for (size_t statement = 1; !cursor.AtEnd(); ++statement)
+					{
+						auto const statement_begin = cursor.pos;
+						auto keyword = cursor.Name();
+
+						if (keyword=="variable_group" || keyword=="hom_variable_group" || keyword=="variable" || keyword=="implicit_parameter" || keyword=="pathvariable")
+						{
+							VariableGroup group;
+							for (auto name : names())
+							{
+								group.push_back(node::Variable::Make(std::string(name)));
+								declare(name, group.back(), statement);
+							}
+
+							if (keyword=="variable_group")
+								sys.AddVariableGroup(group);
+							else if (keyword=="hom_variable_group")
+								sys.AddHomVariableGroup(group);
+							else if (keyword=="variable")
+								sys.AddUngroupedVariables(group);
+							else if (keyword=="implicit_parameter")
+								sys.AddImplicitParameters(group);
+							else
+							{
+								if (group.size()!=1)
+								{
+									cursor.pos = statement_begin;
+									cursor.Fail("there can be only one path variable");
+								}
+								sys.AddPathVariable(group.front());
+							}
+						}
+						else if (keyword=="function" || keyword=="constant" || keyword=="parameter")
+						{
+							std::vector<std::shared_ptr<node::Function> > group;
+							for (auto name : names())
+							{
+								group.push_back(node::Function::Make(std::string(name)));
+								declare(name, group.back(), statement);
+								definable.emplace(group.back().get(), group.back());
+							}
+
+							if (keyword=="function")
+								sys.AddFunctions(group);
+							else if (keyword=="constant")
+								sys.AddConstants(group);
+							else
+								sys.AddParameters(group);
+						}
+						else if (keyword=="random" || keyword=="random_real")
+						{
+							cursor.pos = statement_begin;
+							cursor.Fail("'" + std::string(keyword) + "' declarations are not supported");
+						}
+						else
+						{
+							// a definition, of a declared function, or of a new subfunction
+							cursor.Expect('=');
+
+							std::shared_ptr<node::Function> defined;
+							auto found = symbols.find(keyword);
+							if (found==symbols.end())
+							{
+								defined = node::Function::Make(std::string(keyword));
+								declare(keyword, defined, statement);
+								sys.AddSubfunction(defined);
+							}
+							else
+							{
+								auto d = definable.find(found->second.node.get());
+								if (d==definable.end())
+								{
+									cursor.pos = statement_begin;
+									cursor.Fail("cannot assign to '" + std::string(keyword) + "'");
+								}
+								defined = d->second;
+							}
+
+							auto body_begin = cursor.pos;
+							while (cursor.pos < end && *cursor.pos!=';')
+							{
+								if (*cursor.pos=='%')
+									while (cursor.pos < end && *cursor.pos!='\n')
+										++cursor.pos;
+								else
+									++cursor.pos;
+							}
+							if (cursor.pos==end)
+								cursor.Fail("expected ';'");
+
+							Definition definition{defined, Cursor{begin, body_begin, cursor.pos}, statement};
+							auto previous = definition_of.find(defined.get());
+							if (previous==definition_of.end())
+							{
+								definition_of.emplace(defined.get(), definitions.size());
+								definitions.push_back(definition);
+							}
+							else
+								definitions[previous->second] = definition;
+
+							++cursor.pos; // past the ;
+						}
+					}
+
+
+					// phase two, the bodies, each independent of the others
+					std::vector<std::shared_ptr<node::Node> > roots(definitions.size());
+					std::vector<std::exception_ptr> errors(definitions.size());
+
+					auto const precision = DefaultPrecision();
+					auto const options = mpfr_float::thread_default_variable_precision_options();
+
+					auto work = [&](std::atomic<size_t>& next_definition)
+					{
+						DefaultPrecision(precision);
+						scoped_mpfr_precision_options_this_thread precision_options(options);
+
+						for (size_t ii = next_definition++; ii < definitions.size(); ii = next_definition++)
+						{
+							auto const& d = definitions[ii];
+							try{
+								roots[ii] = ExpressionParser(d.body, symbols, d.statement, d.function.get()).Parse();
+							}
+							catch (...)
+							{
+								errors[ii] = std::current_exception();
+							}
+						}
+					};
+
+					std::atomic<size_t> next_definition(0);
+					if (num_threads_==1 || definitions.size() < 2 || end-begin < parallel_threshold_)
+						work(next_definition);
+					else
+					{
+						std::vector<std::thread> threads;
+						for (unsigned ii = 0; ii < std::min<size_t>(num_threads_, definitions.size()); ++ii)
+							threads.emplace_back(work, std::ref(next_definition));
+						for (auto& t : threads)
+							t.join();
+					}
+
+					// report the error in the earliest definition
+					for (auto const& e : errors)
+						if (e)
+							std::rethrow_exception(e);
+
+					for (size_t ii = 0; ii < definitions.size(); ++ii)
+						definitions[ii].function->SetRoot(roots[ii]);
+
+					return sys;
+				}
+
+
+				/**
+				 \brief Parse a string of statements into a System.
+				 */
+				System Parse(std::string const& input) const
+				{
+					return Parse(input.data(), input.data()+input.size());
+				}
+
+
+				/**
+				 \brief Parse the input section of a Bertini Classic input file into a System.
+
+				 The file is memory-mapped rather than read, and only its input section is parsed, as located by the INPUT and END; markers.  A file without markers is parsed whole.
+
+				 \throws std::runtime_error if the file doesn't exist or can't be mapped, or on malformed input.
+				 */
+				System ParseFile(Path const& input_file) const
+				{
+					if (!fs::exists(input_file) || fs::is_directory(input_file))
+						throw std::runtime_error("attempting to parse file which doesn't exist or is a directory, of name '" + input_file.string() + "'");
+
+					if (fs::file_size(input_file)==0)
+						return System();
+
+					namespace bip = boost::interprocess;
+					try{
+						bip::file_mapping file(input_file.string().c_str(), bip::read_only);
+						bip::mapped_region region(file, bip::read_only);
+
+						auto begin = static_cast<char const*>(region.get_address());
+						auto section = detail::InputSection(begin, begin+region.get_size());
+						return Parse(section.first, section.second);
+					}
+					catch (bip::interprocess_exception const& e)
+					{
+						throw std::runtime_error("failed to map file '" + input_file.string() + "' for parsing: " + e.what());
+					}
+				}
+
+			private:
+
+				static
+				bool IsKeyword(std::string_view name)
+				{
+					for (auto k : {"variable_group", "hom_variable_group", "variable", "function", "constant", "parameter", "implicit_parameter", "pathvariable", "random", "random_real"})
+						if (name==k)
+							return true;
+					return false;
+				}
+
+				// below this many characters, parsing the bodies takes less time than starting threads
+				static constexpr std::ptrdiff_t parallel_threshold_ = 1<<16;
+
+				unsigned num_threads_;
+			};
+
+		} // re: namespace classic
+	} // re: namespace parsing
+} // re: namespace bertini
+
@@ -195,11 +195,12 @@ namespace bertini {
 					;
 					
 					exp_elem_.name("exp_elem_");
+					// the unary signs come first, and apply to a factor, so that -x+y is (-x)+y and -2^2 is -(2^2)
 					exp_elem_ =
-					(symbol_  >> !qi::alnum) [_val = _1]
+					    (lit('-') > factor_  [_val = -_1])
+					|   (lit('+') > factor_  [_val = _1])
+					|   (symbol_  >> !qi::alnum) [_val = _1]
 					|   ( '(' > expression_  [_val = _1] > ')'  ) // using the > expectation here.
-					|   (lit('-') > expression_  [_val = -_1])
-					|   (lit('+') > expression_  [_val = _1])
 					|   (lit("sin") > '(' > expression_ [_val = sin_lazy(_1)] > ')' )
 					|   (lit("cos") > '(' > expression_ [_val = cos_lazy(_1)] > ')' )
 					|   (lit("tan") > '(' > expression_ [_val = tan_lazy(_1)] > ')' )
@@ -0,0 +1,297 @@
+//This file is part of Bertini 2.
+//
+//bertini2/io/system_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/io/system_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/io/system_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+ \file bertini2/io/system_cache.hpp
+
+ \brief Provides an on-disk cache of prepared systems, so that repeated runs on the same input can skip parsing, homogenizing, differentiating and compiling.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "bertini2/system/system.hpp"
+#include "bertini2/io/file_utilities.hpp"
+
+
+namespace bertini {
+
+	namespace detail {
+
+		/**
+		 A read-only stream buffer over memory we don't own, so an archive can be read straight out of a mapped file.
+		 */
+		struct MemoryBuffer : std::streambuf
+		{
+			MemoryBuffer(char const* begin, char const* end)
+			{
+				auto b = const_cast<char*>(begin); // the get area is never written through
+				setg(b, b, b + (end-begin));
+			}
+		};
+
+		/**
+		 64-bit FNV-1a, continuing from a previous hash.
+		 */
+		inline
+		std::uint64_t FNV1a(std::string_view bytes, std::uint64_t hash)
+		{
+			for (unsigned char c : bytes)
+			{
+				hash ^= c;
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+	} // namespace detail
+
+
+	/**
+	\brief A content-addressed cache of prepared Systems, stored in a directory.
+
+	Setting up a system for tracking -- parsing, homogenizing, patching, differentiating, simplifying and compiling to a straight-line program -- can take much longer than loading the result.  A driver computes a key from everything the prepared system depends on, typically the text of the input file and the settings, and asks the cache for it before doing the work:
+
+	\code
+	SystemCache cache(".bertini_cache");
+	auto key = SystemCache::Key(input_text, settings_text);
+	auto homotopy = cache.GetOrBuild(key, [&](){ return PrepareHomotopy(input_text); });
+	\endcode
+
+	Anything Boost.Serialization can archive may be stored, not only a System, so long as it is loaded as the type it was stored as.  A zero dim solve stores its target system, start system and homotopy together, as ZeroDim::PreparedSystems, so that the nodes they share are shared again when loaded.
+
+	Entries are Boost binary archives, in which multiprecision numbers are stored as their raw limbs, read by memory-mapping the file.  Binary archives are specific to the machine and the library versions, so each entry begins with a header recording them, and entries written elsewhere are treated as misses, and overwritten.
+
+	Entries are written to a temporary file and renamed into place, so concurrent runs sharing a cache see either a complete entry or none.
+	*/
+	class SystemCache
+	{
+	public:
+
+		/**
+		\param directory Where the entries live.  Created if it doesn't exist.
+		*/
+		explicit
+		SystemCache(Path const& directory) : directory_(directory)
+		{
+			fs::create_directories(directory_);
+		}
+
+
+		/**
+		\brief Compute a key from the text a system is prepared from.
+
+		The key is 128 bits, as hex, from two independent FNV-1a hashes of the input and the settings, each prefixed by its length so that moving text between them changes the key.
+		*/
+		static
+		std::string Key(std::string_view input, std::string_view settings = {})
+		{
+			auto hash = [&](std::uint64_t basis)
+			{
+				auto h = detail::FNV1a(std::to_string(input.size()) + ":", basis);
+				h = detail::FNV1a(input, h);
+				h = detail::FNV1a(std::to_string(settings.size()) + ":", h);
+				return detail::FNV1a(settings, h);
+			};
+
+			std::stringstream key;
+			key << std::hex << std::setfill('0') << std::setw(16) << hash(14695981039346656037ull) << std::setw(16) << hash(0x6c62272e07bb0142ull);
+			return key.str();
+		}
+
+
+		/**
+		\brief Compute a key from the contents of an input file, and the settings.
+		*/
+		static
+		std::string KeyForFile(Path const& input_file, std::string_view settings = {})
+		{
+			if (fs::file_size(input_file)==0)
+				return Key({}, settings);
+
+			namespace bip = boost::interprocess;
+			bip::file_mapping file(input_file.string().c_str(), bip::read_only);
+			bip::mapped_region region(file, bip::read_only);
+			return Key(std::string_view(static_cast<char const*>(region.get_address()), region.get_size()), settings);
+		}
+
+
+		/**
+		\brief The file holding the entry for a key.
+		*/
+		Path EntryPath(std::string const& key) const
+		{
+			return directory_ / (key + ".b2sys");
+		}
+
+
+		bool Contains(std::string const& key) const
+		{
+			return fs::exists(EntryPath(key));
+		}
+
+
+		/**
+		\brief Load the system stored under a key.
+
+		\tparam T The type stored under the key.
+		\return The system, or nothing if there's no usable entry for the key.
+		*/
+		template <typename T = System>
+		std::optional<T> Load(std::string const& key) const
+		{
+			auto path = EntryPath(key);
+			if (!fs::exists(path) || fs::file_size(path)==0)
+				return std::nullopt;
+
+			namespace bip = boost::interprocess;
+			try{
+				bip::file_mapping file(path.string().c_str(), bip::read_only);
+				bip::mapped_region region(file, bip::read_only);
+
+				auto begin = static_cast<char const*>(region.get_address());
+				detail::MemoryBuffer buffer(begin, begin + region.get_size());
+				std::istream in(&buffer);
+
+				std::string header;
+				std::getline(in, header);
+				if (header!=Header(key))
+					return std::nullopt;
+
+				T loaded;
+				boost::archive::binary_iarchive ia(in);
+				ia >> loaded;
+				return loaded;
+			}
+			catch (bip::interprocess_exception const&)
+			{
+				return std::nullopt;
+			}
+			catch (boost::archive::archive_exception const&)
+			{
+				return std::nullopt;
+			}
+		}
+
+
+		/**
+		\brief Store a system under a key, replacing any previous entry.
+
+		\throws std::runtime_error if the entry can't be written.
+		*/
+		template <typename T>
+		void Store(std::string const& key, T const& sys) const
+		{
+			auto path = EntryPath(key);
+			auto temporary = path;
+			temporary += "." + fs::unique_path().string();
+
+			{
+				std::ofstream out(temporary.string(), std::ios::binary);
+				if (!out)
+					throw std::runtime_error("unable to open '" + temporary.string() + "' for writing a cache entry");
+
+				out << Header(key) << '\n';
+				boost::archive::binary_oarchive oa(out);
+				oa << sys;
+
+				if (!out)
+					throw std::runtime_error("failed writing cache entry '" + temporary.string() + "'");
+			}
+
+			fs::rename(temporary, path);
+		}
+
+
+		/**
+		\brief Load the system stored under a key, or build and store it if there is none.
+
+		\param build A callable returning the System, or whatever else is stored under the key, invoked only on a miss.
+		*/
+		template <typename BuildT>
+		auto GetOrBuild(std::string const& key, BuildT const& build) const -> std::decay_t<decltype(build())>
+		{
+			using T = std::decay_t<decltype(build())>;
+
+			if (auto cached = Load<T>(key))
+				return *std::move(cached);
+
+			T sys = build();
+			Store(key, sys);
+			return sys;
+		}
+
+
+		/**
+		\brief Remove the entry for a key, if there is one.
+		*/
+		void Erase(std::string const& key) const
+		{
+			fs::remove(EntryPath(key));
+		}
+
+	private:
+
+		/**
+		 The first line of an entry, identifying the key and everything the binary archive's layout depends on.
+		 */
+		static
+		std::string Header(std::string const& key)
+		{
+			std::stringstream header;
+			header << "bertini2 system cache " << format_version_
+			       << " key " << key
+			       << " boost " << BOOST_VERSION
+			       << " limb " << sizeof(mp_limb_t)
+			       << " endian " << (IsLittleEndian() ? "little" : "big");
+			return header.str();
+		}
+
+		static
+		bool IsLittleEndian()
+		{
+			std::uint16_t one = 1;
+			return *reinterpret_cast<unsigned char const*>(&one)==1;
+		}
+
+		static constexpr unsigned format_version_ = 1; // increase when the serialization of System changes
+
+		Path directory_;
+	};
+
+} // namespace bertini
+
@@ -150,6 +150,13 @@ namespace boost { namespace serialization {
 	template <typename Archive>
 	void save(Archive& ar, ::boost::multiprecision::backends::mpc_complex_backend<0> const& r, unsigned /*version*/)
 	{
+		if constexpr (bertini::detail::IsBinaryArchive<Archive>::value)
+		{
+			bertini::detail::SaveLimbs(ar, mpc_realref(r.data()));
+			bertini::detail::SaveLimbs(ar, mpc_imagref(r.data()));
+			return;
+		}
+
 		unsigned num_digits(r.precision());
 		ar & num_digits;
 		std::string tmp = r.str(0,std::ios::scientific);
@@ -162,6 +169,13 @@ namespace boost { namespace serialization {
 	template <typename Archive>
 	void load(Archive& ar, ::boost::multiprecision::backends::mpc_complex_backend<0>& r, unsigned /*version*/)
 	{
+		if constexpr (bertini::detail::IsBinaryArchive<Archive>::value)
+		{
+			bertini::detail::LoadLimbs(ar, mpc_realref(r.data()));
+			bertini::detail::LoadLimbs(ar, mpc_imagref(r.data()));
+			return;
+		}
+
 		unsigned num_digits;
 		ar & num_digits;
 		r.precision(num_digits);
@@ -45,9 +45,15 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/split_member.hpp>
+#include <boost/serialization/array_wrapper.hpp>
 
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "bertini2/double_extensions.hpp"
 
@@ -137,6 +143,100 @@ namespace bertini{
 
 
 
+namespace bertini{
+	namespace detail{
+
+	/**
+	 Whether an archive is one of Boost's native binary archives.  These are not portable between machines anyway, so multiprecision numbers go into them as raw limbs, rather than as decimal strings, which are slow to produce and to read back.
+	 */
+	template <typename Archive>
+	using IsBinaryArchive = std::integral_constant<bool, std::is_same<Archive, boost::archive::binary_oarchive>::value || std::is_same<Archive, boost::archive::binary_iarchive>::value>;
+
+	/**
+	 What kind of value an mpfr number holds, as saved by SaveLimbs.
+	 */
+	enum class SavedKind : int { NaN, Inf, Zero, Regular };
+
+	/**
+	 Save an mpfr number exactly, as its precision, kind, sign and, if it's regular, the integer significand and exponent from mpfr_get_z_2exp, the significand as limbs.
+
+	 Only MPFR's documented interface is used, so the format doesn't depend on how MPFR lays out its numbers.
+	 */
+	template <typename Archive>
+	void SaveLimbs(Archive& ar, mpfr_srcptr x)
+	{
+		mpfr_prec_t prec = mpfr_get_prec(x);
+		int kind = static_cast<int>(mpfr_nan_p(x) ? SavedKind::NaN : mpfr_inf_p(x) ? SavedKind::Inf : mpfr_zero_p(x) ? SavedKind::Zero : SavedKind::Regular);
+		int sign = mpfr_signbit(x) ? -1 : 1;
+		ar & prec;
+		ar & kind;
+		ar & sign;
+
+		if (kind!=static_cast<int>(SavedKind::Regular))
+			return;
+
+		mpz_int significand;
+		mpfr_exp_t exp = mpfr_get_z_2exp(significand.backend().data(), x); // exact, x = significand * 2^exp
+
+		std::size_t num_limbs = mpz_size(significand.backend().data());
+		std::vector<mp_limb_t> limbs(num_limbs);
+		mpz_export(limbs.data(), &num_limbs, -1, sizeof(mp_limb_t), 0, 0, significand.backend().data());
+		ar & exp;
+		ar & num_limbs;
+		ar & boost::serialization::make_array(limbs.data(), num_limbs);
+	}
+
+	/**
+	 Load an mpfr number saved by SaveLimbs, changing its precision to the saved one.
+	 */
+	template <typename Archive>
+	void LoadLimbs(Archive& ar, mpfr_ptr x)
+	{
+		mpfr_prec_t prec;
+		int kind;
+		int sign;
+		ar & prec;
+		ar & kind;
+		ar & sign;
+
+		mpfr_set_prec(x, prec);
+
+		switch (static_cast<SavedKind>(kind))
+		{
+			case SavedKind::NaN:
+				mpfr_set_nan(x);
+				return;
+			case SavedKind::Inf:
+				mpfr_set_inf(x, sign);
+				return;
+			case SavedKind::Zero:
+				mpfr_set_zero(x, sign);
+				return;
+			case SavedKind::Regular:
+				break;
+			default:
+				throw std::runtime_error("unknown kind of mpfr number in archive");
+		}
+
+		mpfr_exp_t exp;
+		std::size_t num_limbs;
+		ar & exp;
+		ar & num_limbs;
+		std::vector<mp_limb_t> limbs(num_limbs);
+		ar & boost::serialization::make_array(limbs.data(), num_limbs);
+
+		mpz_int significand;
+		mpz_import(significand.backend().data(), num_limbs, -1, sizeof(mp_limb_t), 0, 0, limbs.data());
+		if (sign < 0)
+			mpz_neg(significand.backend().data(), significand.backend().data());
+
+		mpfr_set_z_2exp(x, significand.backend().data(), exp, MPFR_RNDN); // exact, the significand having at most prec bits
+	}
+
+	} // namespace detail
+} // namespace bertini
+
+
 // the following code block extends serialization to the mpfr_float class from boost::multiprecision
 namespace boost { namespace serialization {
 	/**
@@ -145,6 +245,12 @@ namespace boost { namespace serialization {
 	template <typename Archive>
 	void save(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, unsigned /*version*/)
 	{
+		if constexpr (bertini::detail::IsBinaryArchive<Archive>::value)
+		{
+			bertini::detail::SaveLimbs(ar, r.data());
+			return;
+		}
+
 		unsigned num_digits(r.precision());
 		ar & num_digits;
 		std::string tmp = r.str(0,std::ios::scientific);
@@ -157,6 +263,12 @@ namespace boost { namespace serialization {
 	template <typename Archive>
 	void load(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, unsigned /*version*/)
 	{
+		if constexpr (bertini::detail::IsBinaryArchive<Archive>::value)
+		{
+			bertini::detail::LoadLimbs(ar, r.data());
+			return;
+		}
+
 		unsigned num_digits;
 		ar & num_digits;
 		r.precision(num_digits);
@@ -0,0 +1,467 @@
+//This file is part of Bertini 2.
+//
+//mpfr_lu.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mpfr_lu.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mpfr_lu.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, University of Wisconsin Eau Claire
+
+/**
+\file mpfr_lu.hpp
+
+\brief A dense LU decomposition with partial pivoting for matrices of mpfr_complex, working directly on the underlying MPC numbers.
+*/
+
+#ifndef BERTINI_MPFR_LU_HPP
+#define BERTINI_MPFR_LU_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include <mpc.h>
+
+#include "bertini2/double_extensions.hpp"
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+
+namespace bertini {
+
+	namespace detail {
+
+		/**
+		\brief Hager's estimate of the 1-norm of the inverse of a matrix, in Higham's form for complex matrices, from functions solving with the matrix and with its conjugate transpose.
+
+		\param probe, image Scratch.  probe must be sized to the matrix.
+		*/
+		template<typename T, typename SolveT, typename AdjointSolveT>
+		double InverseOneNormEstimate(Vec<T> & probe, Vec<T> & image, SolveT const& solve, AdjointSolveT const& adjoint_solve)
+		{
+			using std::abs;
+			using std::conj;
+			using std::real;
+
+			const auto n = probe.size();
+			if (n==0)
+				return 0;
+
+			for (Eigen::Index ii = 0; ii < n; ++ii)
+				probe(ii) = T(1)/T(n);
+
+			double estimate = 0;
+			Eigen::Index previous_jj = -1;
+			for (unsigned iteration = 0; iteration < 5; ++iteration)
+			{
+				image = probe;
+				solve(image);
+
+				double norm = 0;
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+					norm += static_cast<double>(abs(image(ii)));
+
+				if (iteration > 0 && norm <= estimate)
+					break;
+				estimate = norm;
+
+				// the subgradient of the 1-norm at the image
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					auto magnitude = abs(image(ii));
+					if (magnitude==0)
+						image(ii) = T(1);
+					else
+						image(ii) /= magnitude;
+				}
+				adjoint_solve(image);
+
+				Eigen::Index jj = 0;
+				double largest = 0, inner_product = 0;
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					auto magnitude = static_cast<double>(abs(image(ii)));
+					if (magnitude > largest)
+					{
+						largest = magnitude;
+						jj = ii;
+					}
+					inner_product += static_cast<double>(real(conj(image(ii))*probe(ii)));
+				}
+
+				if (iteration > 0 && (largest <= inner_product || jj==previous_jj))
+					break;
+
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+					probe(ii) = T(ii==jj ? 1 : 0);
+				previous_jj = jj;
+			}
+
+			return estimate;
+		}
+
+	} // namespace detail
+
+
+	/**
+	\brief The 1-norm of a matrix, its largest column sum of moduli, to double precision.
+
+	This is the norm InverseOneNormEstimate estimates for the inverse, so the product of the two estimates the 1-norm condition number.
+	*/
+	template<typename Derived>
+	double OneNorm(Eigen::MatrixBase<Derived> const& A)
+	{
+		if constexpr (std::is_same<typename Derived::Scalar, dbl>::value)
+			return A.rows() ? A.cwiseAbs().colwise().sum().maxCoeff() : 0;
+		else
+		{
+			double one_norm = 0;
+			for (Eigen::Index jj = 0; jj < A.cols(); ++jj)
+			{
+				double column_sum = 0;
+				for (Eigen::Index ii = 0; ii < A.rows(); ++ii)
+				{
+					mpfr_complex const& a = A(ii,jj);
+					column_sum += std::hypot(mpfr_get_d(mpc_realref(a.backend().data()), MPFR_RNDN), mpfr_get_d(mpc_imagref(a.backend().data()), MPFR_RNDN));
+				}
+				one_norm = std::max(one_norm, column_sum);
+			}
+			return one_norm;
+		}
+	}
+
+
+
+	/**
+	\brief LU decomposition with partial pivoting of a square matrix of mpfr_complex.
+
+	A drop-in replacement for `Eigen::PartialPivLU<Mat<mpfr_complex>>`, for the uses Bertini makes of it: compute, solve, and matrixLU.  Eigen's kernels are generic in the scalar type, and for a heap-allocated type like mpfr_complex every multiply and add in the elimination makes a temporary.  Here the elimination and the triangular solves call MPC directly, updating each entry in place with a fused multiply-add, so that factoring allocates nothing once the storage for a given size and precision exists.
+
+	The factorization is stored as Eigen does, in one matrix with the unit lower triangle L below the diagonal and U on and above it, so that LUPartialPivotDecompositionSuccessful can test it.  Pivots are chosen by the cheap norm \f$|\Re z| + |\Im z|\f$, as LAPACK does for complex matrices.
+
+	Also solves with the conjugate transpose, and estimates the 1-norm of the inverse by Hager's method, as refined by Higham, so the condition number can be estimated without forming the inverse.
+
+	Solving uses scratch space held by the decomposition, so one decomposition must not be used from several threads at once.
+	*/
+	class MPFRPartialPivLU
+	{
+	public:
+		using Index = Eigen::Index;
+		using MatrixType = Mat<mpfr_complex>;
+
+		MPFRPartialPivLU() = default;
+
+		/**
+		\brief Preallocate for factoring matrices of a given size.
+		*/
+		explicit
+		MPFRPartialPivLU(Index size) : lu_(size,size), transpositions_(size)
+		{}
+
+		/**
+		\brief Factor a matrix.
+		*/
+		template<typename Derived>
+		explicit
+		MPFRPartialPivLU(Eigen::MatrixBase<Derived> const& A)
+		{
+			compute(A);
+		}
+
+
+		/**
+		\brief Factor a square matrix.
+
+		The factors are computed in the precision of the entries of A.  A singular matrix is factored anyway, with a zero on the diagonal of U, as Eigen does.
+		*/
+		template<typename Derived>
+		MPFRPartialPivLU& compute(Eigen::MatrixBase<Derived> const& A)
+		{
+			assert(A.rows()==A.cols() && "can only LU-factor square matrices");
+
+			const Index n = A.rows();
+			lu_ = A;
+			transpositions_.resize(n);
+			probe_.resize(n);
+			SetScratchPrecision(n ? lu_(0,0).precision() : DefaultPrecision());
+
+			one_norm_ = bertini::OneNorm(lu_);
+
+			for (Index kk = 0; kk < n; ++kk)
+			{
+				// find the pivot
+				Index pivot = kk;
+				Cabs1(largest_, lu_(kk,kk));
+				for (Index ii = kk+1; ii < n; ++ii)
+				{
+					Cabs1(magnitude_, lu_(ii,kk));
+					if (mpfr_greater_p(Raw(magnitude_), Raw(largest_)))
+					{
+						mpfr_swap(Raw(magnitude_), Raw(largest_));
+						pivot = ii;
+					}
+				}
+				transpositions_[kk] = pivot;
+
+				if (mpfr_zero_p(Raw(largest_)))
+					continue;
+
+				if (pivot!=kk)
+					for (Index jj = 0; jj < n; ++jj)
+						mpc_swap(Raw(lu_(kk,jj)), Raw(lu_(pivot,jj)));
+
+				// the multipliers, which are L's column kk
+				for (Index ii = kk+1; ii < n; ++ii)
+					mpc_div(Raw(lu_(ii,kk)), Raw(lu_(ii,kk)), Raw(lu_(kk,kk)), MPC_RNDNN);
+
+				// update the trailing submatrix, a column at a time, as the storage is column-major
+				for (Index jj = kk+1; jj < n; ++jj)
+				{
+					mpc_neg(Raw(negated_), Raw(lu_(kk,jj)), MPC_RNDNN);
+					for (Index ii = kk+1; ii < n; ++ii)
+						mpc_fma(Raw(lu_(ii,jj)), Raw(lu_(ii,kk)), Raw(negated_), Raw(lu_(ii,jj)), MPC_RNDNN);
+				}
+			}
+
+			return *this;
+		}
+
+
+		/**
+		\brief The factors L and U, stored together.  L has unit diagonal, which is not stored.
+		*/
+		MatrixType const& matrixLU() const
+		{
+			return lu_;
+		}
+
+		Index rows() const { return lu_.rows(); }
+		Index cols() const { return lu_.cols(); }
+
+
+		/**
+		\brief Solve \f$Ax = b\f$ for x.
+		*/
+		template<typename Derived>
+		typename Derived::PlainObject solve(Eigen::MatrixBase<Derived> const& b) const
+		{
+			typename Derived::PlainObject x = b;
+			SolveInPlace(x);
+			return x;
+		}
+
+
+		/**
+		\brief Overwrite b, a vector or matrix, with the solution of \f$Ax = b\f$.
+		*/
+		template<typename Derived>
+		void SolveInPlace(Eigen::MatrixBase<Derived> & b) const
+		{
+			assert(b.rows()==rows() && "right hand side must have as many rows as the factored matrix");
+
+			const Index n = rows();
+			for (Index cc = 0; cc < b.cols(); ++cc)
+			{
+				for (Index kk = 0; kk < n; ++kk)
+					if (transpositions_[kk]!=kk)
+						mpc_swap(Raw(b(kk,cc)), Raw(b(transpositions_[kk],cc)));
+
+				// L is unit lower triangular
+				for (Index kk = 0; kk < n; ++kk)
+				{
+					mpc_neg(Raw(negated_), Raw(b(kk,cc)), MPC_RNDNN);
+					for (Index ii = kk+1; ii < n; ++ii)
+						mpc_fma(Raw(b(ii,cc)), Raw(lu_(ii,kk)), Raw(negated_), Raw(b(ii,cc)), MPC_RNDNN);
+				}
+
+				for (Index kk = n; kk-- > 0; )
+				{
+					mpc_div(Raw(b(kk,cc)), Raw(b(kk,cc)), Raw(lu_(kk,kk)), MPC_RNDNN);
+					mpc_neg(Raw(negated_), Raw(b(kk,cc)), MPC_RNDNN);
+					for (Index ii = 0; ii < kk; ++ii)
+						mpc_fma(Raw(b(ii,cc)), Raw(lu_(ii,kk)), Raw(negated_), Raw(b(ii,cc)), MPC_RNDNN);
+				}
+			}
+		}
+
+
+		/**
+		\brief Overwrite b, a vector or matrix, with the solution of \f$A^H x = b\f$, where \f$A^H\f$ is the conjugate transpose.
+		*/
+		template<typename Derived>
+		void AdjointSolveInPlace(Eigen::MatrixBase<Derived> & b) const
+		{
+			assert(b.rows()==rows() && "right hand side must have as many rows as the factored matrix");
+
+			const Index n = rows();
+			for (Index cc = 0; cc < b.cols(); ++cc)
+			{
+				// U^H is lower triangular
+				for (Index kk = 0; kk < n; ++kk)
+				{
+					mpc_conj(Raw(conjugated_), Raw(lu_(kk,kk)), MPC_RNDNN);
+					mpc_div(Raw(b(kk,cc)), Raw(b(kk,cc)), Raw(conjugated_), MPC_RNDNN);
+					mpc_neg(Raw(negated_), Raw(b(kk,cc)), MPC_RNDNN);
+					for (Index ii = kk+1; ii < n; ++ii)
+					{
+						mpc_conj(Raw(conjugated_), Raw(lu_(kk,ii)), MPC_RNDNN);
+						mpc_fma(Raw(b(ii,cc)), Raw(conjugated_), Raw(negated_), Raw(b(ii,cc)), MPC_RNDNN);
+					}
+				}
+
+				// L^H is unit upper triangular
+				for (Index kk = n; kk-- > 0; )
+				{
+					mpc_neg(Raw(negated_), Raw(b(kk,cc)), MPC_RNDNN);
+					for (Index ii = 0; ii < kk; ++ii)
+					{
+						mpc_conj(Raw(conjugated_), Raw(lu_(kk,ii)), MPC_RNDNN);
+						mpc_fma(Raw(b(ii,cc)), Raw(conjugated_), Raw(negated_), Raw(b(ii,cc)), MPC_RNDNN);
+					}
+				}
+
+				for (Index kk = n; kk-- > 0; )
+					if (transpositions_[kk]!=kk)
+						mpc_swap(Raw(b(kk,cc)), Raw(b(transpositions_[kk],cc)));
+			}
+		}
+
+
+		/**
+		\brief The 1-norm of the factored matrix, the largest column sum of absolute values, to double precision.
+		*/
+		double OneNorm() const
+		{
+			return one_norm_;
+		}
+
+
+		/**
+		\brief Estimate the 1-norm of the inverse of the factored matrix.
+
+		Hager's method, in Higham's form for complex matrices (Higham, "FORTRAN codes for estimating the one-norm of a real or complex matrix", 1988): a few solves with A and its conjugate transpose climb toward the column of \f$A^{-1}\f$ of largest norm.  The result is a lower bound, almost always within a factor of 3 of the true norm.  Costs at most 5 solves with each, and usually 2.
+		*/
+		double InverseOneNormEstimate() const
+		{
+			return detail::InverseOneNormEstimate(probe_, image_,
+			                                      [this](Vec<mpfr_complex> & x){ SolveInPlace(x);},
+			                                      [this](Vec<mpfr_complex> & x){ AdjointSolveInPlace(x);});
+		}
+
+
+		/**
+		\brief Estimate the 1-norm condition number of the factored matrix, \f$\|A\|_1 \|A^{-1}\|_1\f$.
+		*/
+		double ConditionNumberEstimate() const
+		{
+			return OneNorm()*InverseOneNormEstimate();
+		}
+
+	private:
+
+		static mpc_ptr Raw(mpfr_complex & z)
+		{
+			return z.backend().data();
+		}
+
+		static mpc_srcptr Raw(mpfr_complex const& z)
+		{
+			return z.backend().data();
+		}
+
+		static mpfr_ptr Raw(mpfr_float & x)
+		{
+			return x.backend().data();
+		}
+
+		/**
+		 \f$|\Re z| + |\Im z|\f$, which is cheaper than the modulus, and as good for choosing pivots.
+		 */
+		void Cabs1(mpfr_float & result, mpfr_complex const& z)
+		{
+			mpfr_abs(Raw(result), mpc_realref(Raw(z)), MPFR_RNDN);
+			mpfr_abs(Raw(imag_part_), mpc_imagref(Raw(z)), MPFR_RNDN);
+			mpfr_add(Raw(result), Raw(result), Raw(imag_part_), MPFR_RNDN);
+		}
+
+		void SetScratchPrecision(unsigned precision)
+		{
+			magnitude_.precision(precision);
+			largest_.precision(precision);
+			imag_part_.precision(precision);
+			negated_.precision(precision);
+			conjugated_.precision(precision);
+		}
+
+		MatrixType lu_; // L below the diagonal, and U on and above it
+		std::vector<Index> transpositions_; // row kk was swapped with row transpositions_[kk] at step kk
+		double one_norm_ = 0; // 1-norm of the matrix before factoring
+
+		mpfr_float magnitude_, largest_, imag_part_; // scratch for pivoting
+		mutable mpfr_complex negated_, conjugated_; // scratch for elimination and solving
+		mutable Vec<mpfr_complex> probe_, image_; // scratch for the estimate of the norm of the inverse, sized in compute
+	};
+
+
+
+	/**
+	\brief Estimate the 1-norm of the inverse of a matrix, from its LU decomposition.
+	*/
+	inline
+	double InverseOneNormEstimate(MPFRPartialPivLU const& lu)
+	{
+		return lu.InverseOneNormEstimate();
+	}
+
+	inline
+	double InverseOneNormEstimate(Eigen::PartialPivLU<Mat<dbl>> const& lu)
+	{
+		Vec<dbl> probe(lu.rows()), image;
+		return detail::InverseOneNormEstimate(probe, image,
+		                                      [&lu](Vec<dbl> & x){ Vec<dbl> y = lu.solve(x); x = y;},
+		                                      [&lu](Vec<dbl> & x){ Vec<dbl> y = lu.adjoint().solve(x); x = y;});
+	}
+
+
+
+	/**
+	\brief The type of LU decomposition with partial pivoting to use for a matrix of a given numeric type.
+
+	Eigen's for doubles, and MPFRPartialPivLU for mpfr_complex.
+	*/
+	template<typename T>
+	struct PivotedLUType
+	{
+		using type = Eigen::PartialPivLU<Mat<T>>;
+	};
+
+	template<>
+	struct PivotedLUType<mpfr_complex>
+	{
+		using type = MPFRPartialPivLU;
+	};
+
+	template<typename T>
+	using PivotedLU = typename PivotedLUType<T>::type;
+
+} // namespace bertini
+
+
+#endif
@@ -132,6 +132,9 @@ struct ZeroDimConfig
 {
 	unsigned initial_ambient_precision = DoublePrecision();
 	unsigned max_num_crossed_path_resolve_attempts = 2; ///< The maximum number of times to attempt to re-solve crossed paths at the endgame boundary.
+	unsigned num_threads = 1; ///< The number of threads to track paths with.  0 means use as many as the hardware supports.
+	bool pipelined = false; ///< Whether each path should go on to its endgame as soon as it reaches the endgame boundary and is checked for crossings, rather than all paths waiting for each other at the boundary.  Keeps all threads busy between stages.  Each path's points at the start and the boundary are freed once its endgame is done and no path is left to cross it, so the final solutions replace the boundary points rather than adding to them.  The boundary points in ZeroDim::EndgameBoundaryData are then empty.
+	bool longest_endgames_first = true; ///< With more than one thread, whether to run the endgames predicted to take longest first, so that a few slow paths don't finish long after the rest.  Predictions are learned from the step counts, precisions and conditioning of paths tracked to the endgame boundary.
 
 	ComplexT start_time = ComplexT(1);
 	ComplexT endgame_boundary = ComplexT(1)/ComplexT(10);
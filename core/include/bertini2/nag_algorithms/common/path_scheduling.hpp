@@ -0,0 +1,509 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/common/path_scheduling.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/common/path_scheduling.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/common/path_scheduling.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file nag_algorithms/common/path_scheduling.hpp
+
+\brief Predicting how long paths take, and handing them to threads longest-first, or as a pipeline of their stages.
+
+Path tracking times are skewed -- a few singular or ill-conditioned paths can take a hundred times as long as the median.  Handed out in index order, the last long path can start just as the other threads run out of work, and they idle until it finishes.  Handing out the longest first shortens that tail.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/trackers/amp_cost_model.hpp"
+#include "bertini2/nag_algorithms/common/config.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+	/**
+	\brief What was measured about a path while tracking it to the endgame boundary, from which to predict how long its endgame takes, and how long its endgame did take.
+	*/
+	struct PathCost
+	{
+		unsigned num_steps = 0; ///< The number of steps taken to the endgame boundary, successful or not.
+		unsigned max_precision = DoublePrecision(); ///< The highest precision used before the endgame boundary.
+		NumErrorT condition_number = 1; ///< The estimate of the condition number of the Jacobian, arriving at the endgame boundary.
+		NumErrorT stepsize = 1; ///< The last stepsize used, arriving at the endgame boundary.
+		double seconds_before_endgame = 0; ///< How long tracking to the endgame boundary took.
+		double seconds_during_endgame = 0; ///< How long the endgame took.  0 until it has been run.
+	};
+
+
+	/**
+	\brief Predicts how long the endgame of a path takes, from what was measured tracking it to the endgame boundary.
+
+	The prediction is a log-linear model, in the step count, the cost of arithmetic at the highest precision used, the condition number and the stepsize at the boundary, and the time taken to get there.  It is fit by least squares to the endgames observed so far, and refit as the number of observations doubles.  Until there are enough observations to fit, the prediction is the time taken to the boundary, which is the best single predictor.
+
+	Predictions are only used for ordering, so their units don't matter.
+	*/
+	class PathCostModel
+	{
+	public:
+		static constexpr int NumFeatures = 6;
+		using FeatureVec = Eigen::Matrix<double, NumFeatures, 1>;
+		using FeatureMat = Eigen::Matrix<double, NumFeatures, NumFeatures>;
+
+		PathCostModel()
+		{
+			Clear();
+		}
+
+		/**
+		\brief Record how long the endgame of a path took.
+
+		\return Whether the model was refit, in which case earlier predictions are stale.
+		*/
+		bool Observe(PathCost const& path, double seconds)
+		{
+			auto phi = Features(path);
+			normal_matrix_.noalias() += phi * phi.transpose();
+			normal_rhs_ += phi * std::log(std::max(seconds, MinSeconds()));
+			++num_observations_;
+
+			if (num_observations_ < MinObservations() || num_observations_ < 2*num_observations_at_fit_)
+				return false;
+
+			Fit();
+			return true;
+		}
+
+		/**
+		\brief Predict how long the endgame of a path takes.
+		*/
+		double Predict(PathCost const& path) const
+		{
+			if (!IsFitted())
+				return path.seconds_before_endgame;
+
+			return std::exp(coefficients_.dot(Features(path)));
+		}
+
+		bool IsFitted() const
+		{
+			return num_observations_at_fit_ > 0;
+		}
+
+		unsigned long long NumObservations() const
+		{
+			return num_observations_;
+		}
+
+		/**
+		\brief Forget all observations.
+		*/
+		void Clear()
+		{
+			normal_matrix_.setZero();
+			normal_rhs_.setZero();
+			coefficients_.setZero();
+			num_observations_ = 0;
+			num_observations_at_fit_ = 0;
+		}
+
+	private:
+
+		static unsigned long long MinObservations()
+		{
+			return 2*NumFeatures;
+		}
+
+		static double MinSeconds()
+		{
+			return 1e-9;
+		}
+
+		static FeatureVec Features(PathCost const& path)
+		{
+			using std::log;
+			FeatureVec phi;
+			phi << 1,
+			       log(1 + double(path.num_steps)),
+			       log(tracking::ArithmeticCost(path.max_precision)),
+			       log(std::max(double(path.condition_number), 1.)),
+			       -log(std::min(std::max(double(path.stepsize), MinSeconds()), 1.)),
+			       log(std::max(path.seconds_before_endgame, MinSeconds()));
+			return phi;
+		}
+
+		void Fit()
+		{
+			// a little ridge regularization, since features like the precision are often constant across paths
+			FeatureMat regularized = normal_matrix_;
+			regularized.diagonal().array() += 1e-6 * (1 + normal_matrix_.diagonal().maxCoeff());
+			coefficients_ = regularized.ldlt().solve(normal_rhs_);
+			num_observations_at_fit_ = num_observations_;
+		}
+
+		FeatureMat normal_matrix_; ///< sum of outer products of the features of the observed paths
+		FeatureVec normal_rhs_; ///< sum of the features of the observed paths, times the log of their time
+		FeatureVec coefficients_;
+		unsigned long long num_observations_;
+		unsigned long long num_observations_at_fit_;
+	};
+
+
+	/**
+	\brief A thread-safe queue of paths, handing out the one with the longest predicted endgame first.
+
+	Each path is an independent task, taken by whichever thread is free next.  As paths finish, their times are given to the model, and when it refits, the paths still waiting are reordered by the new predictions.
+
+	A path's cost is copied when it is pushed, under the queue's lock, and the reordering uses the copy, so a path may be re-tracked, writing its cost, while an earlier push of it is still waiting here.
+
+	An endgame is sequential, so a running one is never split or handed to another thread.  Stragglers are kept from finishing last by starting the longest predicted endgames first.
+	*/
+	class LongestFirstPathQueue
+	{
+	public:
+		using PathIndexT = SolnCont<dbl_complex>::size_type;
+
+		/**
+		\param costs What was measured for each path, indexed by path.  The queue reads the endgame time of finished paths from here.
+		\param model The model predicting endgame times, which the queue teaches as paths finish.
+		*/
+		LongestFirstPathQueue(std::vector<PathCost> const& costs, PathCostModel & model) : costs_(costs), model_(model)
+		{}
+
+		void Push(PathIndexT path)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			pending_.push_back(Pending{model_.Predict(costs_[path]), path, costs_[path]});
+			std::push_heap(pending_.begin(), pending_.end());
+		}
+
+		/**
+		\brief Take the waiting path with the longest predicted endgame.
+
+		\return false if there are no waiting paths.
+		*/
+		bool Pop(PathIndexT & path)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (pending_.empty())
+				return false;
+
+			std::pop_heap(pending_.begin(), pending_.end());
+			path = pending_.back().path;
+			pending_.pop_back();
+			return true;
+		}
+
+		/**
+		\brief Report that a path's endgame has been run, and its time recorded in the costs.
+
+		Only the finished path's cost is read.  The others waiting are reordered by the costs copied when they were pushed.
+		*/
+		void Done(PathIndexT path)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!model_.Observe(costs_[path], costs_[path].seconds_during_endgame))
+				return;
+
+			for (auto& p : pending_)
+				p.predicted = model_.Predict(p.cost);
+			std::make_heap(pending_.begin(), pending_.end());
+		}
+
+		size_t Size() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return pending_.size();
+		}
+
+	private:
+
+		struct Pending
+		{
+			double predicted; ///< The predicted time of the path's endgame.
+			PathIndexT path;
+			PathCost cost; ///< The path's cost when it was pushed.
+
+			bool operator<(Pending const& other) const
+			{
+				return std::tie(predicted, path) < std::tie(other.predicted, other.path);
+			}
+		};
+
+		std::vector<PathCost> const& costs_;
+		PathCostModel & model_;
+		std::vector<Pending> pending_; ///< a max-heap on predicted time
+		mutable std::mutex mutex_;
+	};
+
+
+	/**
+	\brief Hands out the stages of paths to threads, so that each path goes from tracking to the endgame boundary on to its endgame without waiting for the others to reach the boundary.
+
+	Tracking comes before endgames -- re-tracks of crossed paths first, then first tracks in index order -- so that crossings are found before the crossed paths' endgames run.  Endgames are handed out once there is no tracking to start, longest predicted first, as by LongestFirstPathQueue.
+
+	A path can be asked to re-track whatever stage it is in.  If its endgame is waiting, the endgame is dropped.  If its endgame is running, the re-track waits for it to finish.  Either way, its endgame runs again once it is back at the boundary.
+
+	A path is final once it is done and can't be re-tracked again, either because it has no re-tracks left, or because tracking is over, so no arriving path can cross it.  Finish reports each path once when it becomes final, and again once tracking is over, when nothing will be checked against it any more.
+	*/
+	class PathPipeline
+	{
+	public:
+		using PathIndexT = LongestFirstPathQueue::PathIndexT;
+
+		enum class Stage
+		{
+			TrackToBoundary,
+			Endgame
+		};
+
+		struct Task
+		{
+			PathIndexT path;
+			Stage stage;
+			unsigned num_retracks; ///< How many times the path has been re-tracked, including by this task.
+		};
+
+		/**
+		\brief What became of the paths when a task finished.
+		*/
+		struct Finished
+		{
+			std::vector<PathIndexT> final_paths; ///< Paths which just became final, so their results won't change.
+			std::vector<PathIndexT> checked_paths; ///< Final paths which no arriving path will be checked against any more, since tracking is over.
+		};
+
+		/**
+		\param num_paths The number of paths, which are tracked in index order.
+		\param max_num_retracks How many times each path may be re-tracked.
+		\param costs What was measured for each path, indexed by path, for ordering endgames.
+		\param model The model predicting endgame times.
+		*/
+		PathPipeline(PathIndexT num_paths, unsigned max_num_retracks, std::vector<PathCost> const& costs, PathCostModel & model) :
+			num_paths_(num_paths), max_num_retracks_(max_num_retracks),
+			state_(num_paths, PathState::Waiting), num_retracks_(num_paths, 0), retrack_after_endgame_(num_paths, false), reported_final_(num_paths, false),
+			endgames_(costs, model)
+		{}
+
+		/**
+		\brief Take the next task, waiting for one if there are none now but tasks in progress could make more.
+
+		\return false if all paths are done, or the pipeline was abandoned.
+		*/
+		bool Next(Task & task)
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (true)
+			{
+				if (abandoned_)
+					return false;
+
+				if (!retracks_.empty())
+				{
+					auto path = retracks_.front();
+					retracks_.pop_front();
+					return Start(task, path, Stage::TrackToBoundary);
+				}
+
+				if (next_first_track_ < num_paths_)
+					return Start(task, next_first_track_++, Stage::TrackToBoundary);
+
+				PathIndexT path;
+				while (endgames_.Pop(path))
+					if (state_[path]==PathState::AtBoundary) // otherwise re-tracked since it was queued
+						return Start(task, path, Stage::Endgame);
+
+				if (num_in_progress_==0)
+					return false;
+
+				changed_.wait(lock);
+			}
+		}
+
+		/**
+		\brief Report that a task has been run.
+
+		\param task The task, as from Next.
+		\param to_endgame For tracking to the boundary, whether the path made it, so its endgame should run.
+		\param find_retracks Called with this pipeline once it is locked, returning the paths to re-track.  For tracking, this is where to check for crossed paths.  It may call CanRetrack.
+		\return The paths which became final, and those no longer checked against, each reported once.
+		*/
+		template<typename FindRetracksT>
+		Finished Finish(Task const& task, bool to_endgame, FindRetracksT const& find_retracks)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			--num_in_progress_;
+
+			auto const path = task.path;
+			if (task.stage==Stage::TrackToBoundary)
+			{
+				--num_tracking_;
+				state_[path] = to_endgame ? PathState::AtBoundary : PathState::Done;
+				if (to_endgame)
+					endgames_.Push(path);
+
+				for (auto const& crossed : find_retracks(static_cast<PathPipeline const&>(*this)))
+					Retrack(crossed);
+			}
+			else
+			{
+				state_[path] = PathState::Done;
+				endgames_.Done(path);
+				if (retrack_after_endgame_[path])
+				{
+					retrack_after_endgame_[path] = false;
+					--num_retracks_after_endgame_;
+					Retrack(path);
+				}
+			}
+
+			Finished finished;
+			if (TrackingOver() && !tracking_was_over_)
+			{
+				tracking_was_over_ = true;
+				for (PathIndexT ii = 0; ii < num_paths_; ++ii)
+					if (state_[ii]==PathState::Done)
+					{
+						ReportFinal(ii, finished);
+						finished.checked_paths.push_back(ii);
+					}
+			}
+			else if (state_[path]==PathState::Done && (tracking_was_over_ || !CanRetrack(path)))
+			{
+				if (ReportFinal(path, finished) && tracking_was_over_)
+					finished.checked_paths.push_back(path);
+			}
+
+			changed_.notify_all();
+			return finished;
+		}
+
+		/**
+		\brief Whether a path has re-tracks left.  For use by the find_retracks function passed to Finish.
+		*/
+		bool CanRetrack(PathIndexT path) const
+		{
+			return num_retracks_[path] < max_num_retracks_;
+		}
+
+		/**
+		\brief Stop handing out tasks, say because one threw.
+		*/
+		void Abandon()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			abandoned_ = true;
+			changed_.notify_all();
+		}
+
+	private:
+
+		enum class PathState
+		{
+			Waiting,
+			Tracking,
+			AtBoundary,
+			InEndgame,
+			Done
+		};
+
+		bool Start(Task & task, PathIndexT path, Stage stage)
+		{
+			state_[path] = stage==Stage::TrackToBoundary ? PathState::Tracking : PathState::InEndgame;
+			task = Task{path, stage, num_retracks_[path]};
+			++num_in_progress_;
+			if (stage==Stage::TrackToBoundary)
+				++num_tracking_;
+			return true;
+		}
+
+		/**
+		\brief Whether no path will arrive at the boundary again, since none is being tracked or waiting to be.
+		*/
+		bool TrackingOver() const
+		{
+			return next_first_track_==num_paths_ && retracks_.empty() && num_tracking_==0 && num_retracks_after_endgame_==0;
+		}
+
+		bool ReportFinal(PathIndexT path, Finished & finished)
+		{
+			if (reported_final_[path])
+				return false;
+			reported_final_[path] = true;
+			finished.final_paths.push_back(path);
+			return true;
+		}
+
+		void Retrack(PathIndexT path)
+		{
+			if (!CanRetrack(path))
+				return;
+
+			switch (state_[path])
+			{
+				case PathState::AtBoundary:
+				case PathState::Done:
+					++num_retracks_[path];
+					state_[path] = PathState::Waiting;
+					retracks_.push_back(path);
+					break;
+				case PathState::InEndgame:
+					if (!retrack_after_endgame_[path])
+						++num_retracks_after_endgame_;
+					retrack_after_endgame_[path] = true;
+					break;
+				case PathState::Waiting:
+				case PathState::Tracking:
+					break; // already going to be tracked again
+			}
+		}
+
+		const PathIndexT num_paths_;
+		const unsigned max_num_retracks_;
+
+		std::vector<PathState> state_;
+		std::vector<unsigned> num_retracks_;
+		std::vector<bool> retrack_after_endgame_; ///< re-tracks asked for while the endgame was running
+		std::vector<bool> reported_final_;
+
+		PathIndexT next_first_track_ = 0;
+		std::deque<PathIndexT> retracks_;
+		LongestFirstPathQueue endgames_;
+
+		unsigned num_in_progress_ = 0;
+		unsigned num_tracking_ = 0;
+		unsigned num_retracks_after_endgame_ = 0;
+		bool tracking_was_over_ = false;
+		bool abandoned_ = false;
+		std::mutex mutex_;
+		std::condition_variable changed_;
+	};
+
+	} // namespace algorithm
+} // namespace bertini
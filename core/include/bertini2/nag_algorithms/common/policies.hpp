@@ -167,6 +167,46 @@ public:
 			}
 
 
+			/**
+			\brief The systems SystemSetup makes, together, so they can be saved and given back, say through a SystemCache, rather than set up again.
+
+			The start system and homotopy share nodes, so they are archived together, which keeps them shared when loaded.
+			*/
+			struct PreparedSystems
+			{
+				SystemType target;
+				StartSystemType start;
+				SystemType homotopy;
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & target;
+					ar & start;
+					ar & homotopy;
+				}
+			};
+
+
+			/**
+			A getter for the systems as set up.
+			*/
+			PreparedSystems Prepared() const
+			{
+				return PreparedSystems{target_system_, start_system_, homotopy_};
+			}
+
+			/**
+			A setter for the systems, in place of setting them up.
+			*/
+			void Prepared(PreparedSystems const& prepared)
+			{
+				target_system_ = prepared.target;
+				start_system_ = prepared.start;
+				homotopy_ = prepared.homotopy;
+			}
+
+
 			/**
 			In contrast at AtConstruct, the AtSet function copies the given system into the stored system when setting, after construction.
 			*/
@@ -201,6 +241,7 @@ public:
 
 				homotopy = (1-t)*target + node::Rational::Make(node::Rational::Rand())*t*start;
 				homotopy.AddPathVariable(t);
+				homotopy.SetCompilePatchesIntoSLP(true); // one pass of the SLP evaluates the whole square homotopy, which can then be viewed without copying, and shared between threads through evaluation contexts
 			}
 
 			/**
@@ -211,7 +252,7 @@ public:
 			3. constructs the start system,
 			4. stores the number of start points, 
 			5. makes a path variable,
-			6. forms the straight line homotopy between target and start, with the gamma trick
+			6. forms the straight line homotopy between target and start, with the gamma trick, compiling its patches into its SLP
 
 			boom, you're ready to go.
 			*/
@@ -0,0 +1,81 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/events.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/events.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/events.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file nag_algorithms/events.hpp
+
+\brief Contains the events emitted by algorithms
+*/
+
+#pragma once
+
+#include "bertini2/detail/events.hpp"
+
+namespace bertini {
+
+	namespace algorithm{
+
+	/**
+	\brief Generic event for algorithms
+	*/
+	ADD_BERTINI_EVENT_TYPE(AlgorithmEvent,ConstEvent);
+
+
+	/**
+	\brief A path's endgame has finished, and its solution and metadata are in place.
+
+	With several threads, paths finish in no particular order.  The algorithm emits these one at a time, so observers needn't lock, but they are called from whichever thread ran the endgame.
+	*/
+	template<class ObservedT>
+	class PathFinished : public AlgorithmEvent<ObservedT>
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	public:
+		using ParentEvent = AlgorithmEvent<ObservedT>;
+
+		/**
+		\brief The constructor for a PathFinished Event.
+
+		\param obs The observable emitting the event.
+		\param path The index of the path which finished.
+		*/
+		PathFinished(const ObservedT & obs,
+		             unsigned long long path) : AlgorithmEvent<ObservedT>(obs),
+													path_(path)
+		{}
+
+		virtual ~PathFinished() = default;
+		PathFinished() = delete;
+
+		/**
+		\brief Get the index of the path which finished.
+		*/
+		auto Path() const {return path_;}
+	private:
+		const unsigned long long path_;
+	};
+
+	}// re: namespace algorithm
+
+}// re: namespace bertini
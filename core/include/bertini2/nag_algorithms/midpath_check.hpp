@@ -38,6 +38,9 @@ This essentially amounts to being certain that no two points are the same.
 #include "bertini2/nag_algorithms/common/config.hpp"
 #include "bertini2/detail/configured.hpp"
 
+#include <map>
+#include <random>
+
 namespace bertini{
 	namespace algorithm{
 
@@ -139,64 +142,108 @@ namespace bertini{
 					if ( boundary_data[ii].success_code != SuccessCode::Success)
 							continue;
 
-					const Vec<ComplexType>& solution_ii = boundary_data[ii].path_point;
-					const auto start_ii = start_system.template StartPoint<ComplexType>(ii);
-
 					for (PathIndT jj = ii+1; jj < boundary_data.size(); ++jj)
 					{
 						if ( boundary_data[jj].success_code != SuccessCode::Success)
 							continue;
 
-						const Vec<ComplexType>& solution_jj = boundary_data[jj].path_point;
-						const Vec<ComplexType> diff_sol = solution_ii - solution_jj;
-						
-						if ((diff_sol.template lpNorm<Eigen::Infinity>()/solution_ii.template lpNorm<Eigen::Infinity>()) < SamePointTol())
-						{
-							bool i_already_stored = false;
-							bool j_already_stored = false;
-							// Check if start points are the same
-							
-							const auto start_jj = start_system.template StartPoint<ComplexType>(jj);
-							auto diff_start = start_ii - start_jj;
-							bool same_start = (diff_start.template lpNorm<Eigen::Infinity>() > SamePointTol());
-							
-							
-							// Check if path has already been stored in crossed_paths_
-							for(auto& v : crossed_paths_)
-							{
-								if(v.index() == ii)
-								{
-									v.crossed_with(std::make_pair(jj,same_start));
-									i_already_stored = true;
-									v.rerun(same_start);
-								}
-								if(v.index() == jj)
-								{
-									v.crossed_with(std::make_pair(ii,same_start));
-									j_already_stored = true;
-									v.rerun(same_start);
-								}
-							}
-							
-							// If not already stored, create CrossedPath object and add to crossed_paths_
-							if(!i_already_stored)
-							{
-								CrossedPath tempPath(ii, jj, same_start);
-								crossed_paths_.push_back(tempPath);
-							}
-							if(!j_already_stored)
-							{
-								CrossedPath tempPath(jj, ii, same_start);
-								crossed_paths_.push_back(tempPath);
-							}
-							
-							passed_ = false;
-							
-						}
+						CheckPair(ii, jj, boundary_data, start_system);
 					}
 				}
 				return passed_;
 			};
+
+
+			/**
+			 \brief Forget the paths and crossings seen so far, to start checking paths one at a time as they arrive at the endgame boundary.
+
+			 Arrived points are indexed by a real projection, sorted, so that each arriving path is compared only with those whose projection is near its own, rather than with all of them.
+			*/
+			void StartIncremental()
+			{
+				crossed_paths_.clear();
+				passed_ = true;
+				index_.clear();
+				index_position_.clear();
+				projection_.resize(0);
+				max_norm_ = 0;
+			}
+
+
+			/**
+			 \brief Check a path newly arrived at the endgame boundary against the paths which arrived before it, and add it to them.
+
+			 Crossings are recorded as by Check, which decides whether each crossed path should be re-run.  A path which is to be re-tracked should Depart first.
+
+			 \param ii The index of the arriving path.  Its tracking must have succeeded.  If it arrived before, it replaces its earlier arrival.
+			 \param boundary_data Solution data at the endgame boundary.  Arrived paths' entries must not change until they Depart.
+			 \return The indices of the paths the arriving one crossed.
+			*/
+			template <typename StartSystemT>
+			std::vector<PathIndT> Arrive(PathIndT ii, BoundaryData const& boundary_data, StartSystemT const& start_system)
+			{
+				Depart(ii); // in case it arrived before
+				const Vec<ComplexType>& solution_ii = boundary_data[ii].path_point;
+
+				if (projection_.size()==0)
+				{
+					// the weights don't matter for correctness, only for how well they spread the points out
+					std::mt19937 generator(static_cast<std::mt19937::result_type>(solution_ii.size()));
+					std::uniform_real_distribution<double> weight(-1,1);
+					projection_.resize(2*solution_ii.size());
+					for (Eigen::Index kk = 0; kk < projection_.size(); ++kk)
+						projection_(kk) = weight(generator);
+				}
+
+				using std::max;
+				const double norm_ii = static_cast<double>(solution_ii.template lpNorm<Eigen::Infinity>());
+				max_norm_ = max(max_norm_, norm_ii);
+
+				// points within the same point tolerance in the infinity norm have projections closer than this
+				const double key = Project(solution_ii);
+				const double radius = 2 * projection_.template lpNorm<1>() * static_cast<double>(SamePointTol()) * max_norm_;
+
+				std::vector<PathIndT> crossed;
+				for (auto jj = index_.lower_bound(key-radius); jj!=index_.end() && jj->first <= key+radius; ++jj)
+				{
+					if (jj->second < ii)
+					{
+						if (CheckPair(jj->second, ii, boundary_data, start_system))
+							crossed.push_back(jj->second);
+					}
+					else if (CheckPair(ii, jj->second, boundary_data, start_system))
+						crossed.push_back(jj->second);
+				}
+
+				index_position_[ii] = index_.emplace(key, ii);
+				return crossed;
+			}
+
+
+			/**
+			 \brief Remove a path from the arrived paths, say because it is going to be re-tracked.
+			*/
+			void Depart(PathIndT ii)
+			{
+				auto position = index_position_.find(ii);
+				if (position==index_position_.end())
+					return;
+
+				index_.erase(position->second);
+				index_position_.erase(position);
+			}
+
+
+			/**
+			 \brief Whether a path has crossed another, from a different start point, so should be re-run.
+			*/
+			bool ShouldRerun(PathIndT ii) const
+			{
+				for (auto const& v : crossed_paths_)
+					if (v.index()==ii)
+						return v.rerun();
+				return false;
+			}
 			
 			
 			const std::vector<CrossedPath> GetCrossedPaths() const
@@ -207,9 +254,85 @@ namespace bertini{
 			
 			
 		private:
+
+			/**
+			 \brief Compare the boundary points of two paths, recording a crossing if they are the same.
+
+			 \param ii The lesser index of the two
+			 \param jj The greater index of the two
+			 \return Whether they crossed
+			*/
+			template <typename StartSystemT>
+			bool CheckPair(PathIndT ii, PathIndT jj, BoundaryData const& boundary_data, StartSystemT const& start_system)
+			{
+				const Vec<ComplexType>& solution_ii = boundary_data[ii].path_point;
+				const Vec<ComplexType>& solution_jj = boundary_data[jj].path_point;
+				const Vec<ComplexType> diff_sol = solution_ii - solution_jj;
+				
+				if (!((diff_sol.template lpNorm<Eigen::Infinity>()/solution_ii.template lpNorm<Eigen::Infinity>()) < SamePointTol()))
+					return false;
+
+				bool i_already_stored = false;
+				bool j_already_stored = false;
+				// Check if start points are the same
+				
+				const auto start_ii = start_system.template StartPoint<ComplexType>(ii);
+				const auto start_jj = start_system.template StartPoint<ComplexType>(jj);
+				auto diff_start = start_ii - start_jj;
+				bool same_start = (diff_start.template lpNorm<Eigen::Infinity>() > SamePointTol());
+				
+				
+				// Check if path has already been stored in crossed_paths_
+				for(auto& v : crossed_paths_)
+				{
+					if(v.index() == ii)
+					{
+						v.crossed_with(std::make_pair(jj,same_start));
+						i_already_stored = true;
+						v.rerun(same_start);
+					}
+					if(v.index() == jj)
+					{
+						v.crossed_with(std::make_pair(ii,same_start));
+						j_already_stored = true;
+						v.rerun(same_start);
+					}
+				}
+				
+				// If not already stored, create CrossedPath object and add to crossed_paths_
+				if(!i_already_stored)
+				{
+					CrossedPath tempPath(ii, jj, same_start);
+					crossed_paths_.push_back(tempPath);
+				}
+				if(!j_already_stored)
+				{
+					CrossedPath tempPath(jj, ii, same_start);
+					crossed_paths_.push_back(tempPath);
+				}
+				
+				passed_ = false;
+				return true;
+			}
+
+
+			double Project(Vec<ComplexType> const& point) const
+			{
+				double key = 0;
+				for (Eigen::Index kk = 0; kk < point.size(); ++kk)
+					key += projection_(2*kk) * static_cast<double>(point(kk).real()) + projection_(2*kk+1) * static_cast<double>(point(kk).imag());
+				return key;
+			}
+
 			
 			std::vector<CrossedPath> crossed_paths_; // Data for all paths that crossed on last check
 			bool passed_;  // Did the check pass?
+
+			// for checking incrementally
+			std::multimap<double, PathIndT> index_; // arrived paths, by the projection of their boundary point
+			std::map<PathIndT, typename std::multimap<double, PathIndT>::iterator> index_position_; // where each arrived path is in the index
+			Eigen::VectorXd projection_; // weights of the real and imaginary parts of the coordinates
+			double max_norm_ = 0; // the largest norm of an arrived point
 			
 			
 		}; //re: struct MidpathChecker
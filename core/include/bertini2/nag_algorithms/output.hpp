@@ -32,6 +32,7 @@ You can also provide your own, that's the point of these policies.
 
 #include "bertini2/nag_algorithms/zero_dim_solve.hpp"
 #include "bertini2/io/generators.hpp"
+#include "bertini2/detail/observer.hpp"
 
 
 namespace bertini {
@@ -100,7 +101,7 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 	void RawData(OutT & out, ZDT const& zd)
 	{
 		const auto n = zd.FinalSolutions().size();
-		NumVariables(out, zd,"\n\n");
+		RawDataHeader(out, zd);
 		for (decltype(zd.FinalSolutions().size()) ii{0}; ii<n; ++ii)
 		{
 			if (zd.FinalSolutionMetadata()[ii].endgame_success == SuccessCode::NeverStarted)
@@ -108,6 +109,26 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 			EndPointMDRaw(ii,out,zd,"\n\n");
 		}
 
+		RawDataTrailer(out, zd);
+	}
+
+	/**
+	\brief What raw_data has before the paths.
+	*/
+	template <typename OutT>
+	static 
+	void RawDataHeader(OutT & out, ZDT const& zd)
+	{
+		NumVariables(out, zd,"\n\n");
+	}
+
+	/**
+	\brief What raw_data has after the paths.
+	*/
+	template <typename OutT>
+	static 
+	void RawDataTrailer(OutT & out, ZDT const& zd)
+	{
 		out << "\n\n";
 		TargetSystem(out,zd,"\n\n");
 	}
@@ -221,6 +242,38 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 };
 
 
+/**
+\brief Writes each path to a Bertini Classic raw_data file as its endgame finishes, rather than after the solve, so a long solve's results reach the disk as they come.
+
+Write the header with Classic::RawDataHeader before solving, attach this to the algorithm, and write the trailer with Classic::RawDataTrailer after.  Paths are written in the order their results become final, once each.  In a pipelined solve, a path whose endgame ran is written once it can't be re-tracked again, which for paths with re-tracks left is when tracking is over.
+*/
+template <typename ZeroDimT>
+class ClassicRawDataStreamer : public Observer<ZeroDimT>
+{ BOOST_TYPE_INDEX_REGISTER_CLASS
+public:
+
+	explicit
+	ClassicRawDataStreamer(std::ostream & out) : out_(out)
+	{
+		this->template SubscribeTo<PathFinished<ZeroDimT>>();
+	}
+
+	virtual ~ClassicRawDataStreamer() = default;
+
+	void Observe(AnyEvent const& e) override
+	{
+		if (auto p = dynamic_cast<const PathFinished<ZeroDimT>*>(&e))
+		{
+			Classic<ZeroDimT>::EndPointMDRaw(p->Path(), out_, p->Get(), "\n\n");
+			out_.flush();
+		}
+	}
+
+private:
+	std::ostream & out_;
+};
+
+
 struct NonsingularSolutions
 {
 
@@ -34,7 +34,9 @@
 
 #include "bertini2/detail/visitable.hpp"
 #include "bertini2/tracking.hpp"
+#include "bertini2/endgames/config.hpp"
 #include "bertini2/nag_algorithms/midpath_check.hpp"
+#include "bertini2/nag_algorithms/events.hpp"
 #include "bertini2/io/generators.hpp"
 
 #include "bertini2/detail/configured.hpp"
@@ -43,7 +45,15 @@
 #include "bertini2/nag_algorithms/common/algorithm_base.hpp"
 #include "bertini2/nag_algorithms/common/config.hpp"
 #include "bertini2/nag_algorithms/common/policies.hpp"
+#include "bertini2/nag_algorithms/common/path_scheduling.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 
 
 namespace bertini {
@@ -84,6 +94,21 @@ struct AlgoTraits <ZeroDim<TrackerType, EndgameType, SystemType, StartSystemType
 struct AnyZeroDim : public virtual AnyAlgorithm
 {
 	virtual ~AnyZeroDim() = default;
+
+	/**
+	\brief Set the number of threads to track paths with.  0 means use as many as the hardware supports.
+	*/
+	virtual void SetNumThreads(unsigned num_threads) = 0;
+
+	/**
+	\brief The number of paths tracked, one per start point.
+	*/
+	virtual unsigned long long NumPaths() const = 0;
+
+	/**
+	\brief The number of paths whose endgame succeeded.
+	*/
+	virtual unsigned long long NumSuccessfulPaths() const = 0;
 };
 
 
@@ -132,6 +157,7 @@ struct SolutionMetaData
 	NumErrorT accuracy_estimate_user_coords;	// accuracy estimate between extrapolations, in natural coordinates
 	unsigned cycle_num;    						// cycle number used in extrapolations
 	SuccessCode endgame_success = SuccessCode::NeverStarted;      // success code
+	NumErrorT divergence_rate = 0;				// if the tracker or endgame found the path going to infinity, the power of 1/|t| at which its norm grows.  0 otherwise
 
 
 	///// things added by post-processing
@@ -139,7 +165,7 @@ struct SolutionMetaData
 
 	int multiplicity = 1; 		// multiplicity
 	bool is_real;       		// real flag:  0 - not real, 1 - real
-	bool is_finite;     		// finite flag: -1 - no finite/infinite distinction, 0 - infinite, 1 - finite
+	bool is_finite = true;     		// finite flag: -1 - no finite/infinite distinction, 0 - infinite, 1 - finite
 	bool is_singular;       		// singular flag: 0 - non-sigular, 1 - singular
 
 	bool operator==(const SolutionMetaData<ComplexType> & other){ 
@@ -157,6 +183,7 @@ struct SolutionMetaData
 			 && this->accuracy_estimate_user_coords == other.accuracy_estimate_user_coords
 			 && this->cycle_num == other.cycle_num
 			 && this->endgame_success == other.endgame_success
+			 && this->divergence_rate == other.divergence_rate
 			 && this->function_residual == other.function_residual
 			 && this->multiplicity == other.multiplicity
 			 && this->is_real == other.is_real
@@ -186,6 +213,7 @@ std::ostream& operator<<(std::ostream & out, const SolutionMetaData<NumT> & meta
 	out << "accuracy_estimate_user_coords = " << meta.accuracy_estimate_user_coords << std::endl;
 	out << "cycle_num = " << meta.cycle_num << std::endl;
 	out << "endgame_success = " << meta.endgame_success << std::endl;
+	out << "divergence_rate = " << meta.divergence_rate << std::endl;
 
 	out << "function_residual = " << meta.function_residual << std::endl;
 
@@ -315,7 +343,33 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 			\brief Main Run() function provided for calling from the blackbox mode
 			*/
 			void Run() override
-			{}
+			{
+				Solve();
+			}
+
+
+			/**
+			\brief Set the number of threads to track paths with.  0 means use as many as the hardware supports.
+
+			With more than one thread, the first, which is the calling thread, tracks with this algorithm's tracker and endgame, and each of the others gets its own, set up like this algorithm's.  Observers attached to this algorithm's tracker and endgame only see the paths tracked by the first thread, so track with one thread if you need them to see everything.
+			*/
+			void SetNumThreads(unsigned num_threads) override
+			{
+				auto zero_dim = this->template Get<ZeroDimConf>();
+				zero_dim.num_threads = num_threads;
+				this->template Set<ZeroDimConf>(zero_dim);
+			}
+
+			unsigned long long NumPaths() const override
+			{
+				return num_start_points_;
+			}
+
+			unsigned long long NumSuccessfulPaths() const override
+			{
+				return std::count_if(solution_final_metadata_.begin(), solution_final_metadata_.end(),
+				                     [](auto const& smd){ return smd.endgame_success==SuccessCode::Success; });
+			}
 
 			virtual ~ZeroDim() = default;
 /// setup functions
@@ -356,6 +410,22 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 			}
 
 
+			/**
+			\brief Use systems set up before, in place of those set up at construction, as from Prepared() of an algorithm of this type made from the same target system.
+
+			The random numbers in the start system, patches and homotopy are then those of the systems given.  The tracker's precision settings are made anew from the homotopy, so configure the tracker after.
+			*/
+			template <typename PreparedT>
+			void UsePrepared(PreparedT const& prepared)
+			{
+				SystemManagementPolicy::Prepared(prepared);
+				num_start_points_ = StartSystem().NumStartPoints();
+
+				tracker_.SetSystem(Homotopy());
+				tracker_.PrecisionSetup(PrecisionConfig(Homotopy()));
+			}
+
+
 
 			/**
 			Fills the tolerances and retrack settings from default values.
@@ -514,7 +584,9 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 			Finally, results are post-processed.
 
-			It is up to you to put the output somewhere.
+			If ZeroDimConfig::pipelined is set, the paths don't wait for each other at the endgame boundary.  See TrackPipelined.
+
+			It is up to you to put the output somewhere.  To write each path as it finishes, rather than waiting for them all, observe PathFinished, which is emitted once for each path whose endgame ran, when its results are final.  In a pipelined solve, that's once the path can't be re-tracked again.  Multiplicities are only known once every path is done.
 			*/
 			void Solve()
 			{
@@ -522,13 +594,20 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 				PreSolveSetup();
 
-				TrackBeforeEG();
+				if (this->template Get<ZeroDimConf>().pipelined)
+					TrackPipelined();
+				else
+				{
+					TrackBeforeEG();
 
-				EGBoundaryAction();
+					EGBoundaryAction();
 
-				TrackDuringEG();
+					TrackDuringEG();
+				}
 
 				PostEGAction();
+
+				worker_storage_.clear();
 			}
 
 
@@ -552,14 +631,101 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 			/**
 			\brief Get the solutions as computed at the endgame boundary
+
+			A pipelined solve frees each path's point at the boundary once the path is final and tracking is over, so these points are empty after one.  The other data are kept.
 			*/
 			const auto& EndgameBoundaryData() const
 			{
 				return solutions_at_endgame_boundary_;
 			}
 
+			/**
+			\brief Get the step counts, precisions, conditioning and times measured for each path.
+			*/
+			const auto& PathCosts() const
+			{
+				return path_costs_;
+			}
+
+			/**
+			\brief Get the model predicting how long endgames take, used to start the longest first when tracking with more than one thread.
+
+			It keeps learning across solves, which suits solving many similar systems, say in a parameter homotopy.  Clear it if the next system is unlike the previous ones.
+			*/
+			PathCostModel & GetEndgameCostModel()
+			{
+				return endgame_cost_model_;
+			}
+
 		private:
 
+			/**
+			\brief The start points of the start system, generated once before tracking.  Stands in for the start system where only its start points are wanted, such as in the midpath checker, so that threads needn't share the start system.
+			*/
+			struct StartPointCache
+			{
+				template<typename T>
+				Vec<T> const& StartPoint(unsigned long long index) const
+				{
+					static_assert(std::is_same<T,BaseComplexType>::value, "start points are generated in the algorithm's complex type");
+					return points[static_cast<SolnIndT>(index)];
+				}
+
+				SolnCont<Vec<BaseComplexType> > points;
+			};
+
+			/**
+			\brief The objects one thread tracks paths with.
+			*/
+			struct PathWorker
+			{
+				SystemType const& target;
+				TrackerType & tracker;
+				EndgameType & endgame;
+				tracking::FirstPrecisionRecorder<TrackerType> & first_prec_rec;
+				tracking::MinMaxPrecisionRecorder<TrackerType> & min_max_prec;
+				std::mutex & finished_paths; ///< held while telling observers a path finished, so they hear of one at a time
+			};
+
+			/**
+			\brief A thread's own homotopy and target system, with a tracker and endgame set up like the algorithm's.
+			*/
+			struct WorkerStorage
+			{
+				WorkerStorage(SystemType const& homotopy, SystemType const& target, TrackerType const& tracker, EndgameType const& endgame) :
+					homotopy_(Clone(homotopy)), target_(Clone(target)), tracker_(homotopy_), endgame_(tracker_, endgame.configuration_)
+				{
+					tracker_.Setup(tracker.GetPredictor(),
+					               tracker.TrackingTolerance(),
+					               tracker.InfiniteTruncationTolerance(),
+					               tracker.template Get<tracking::SteppingConfig>(),
+					               tracker.template Get<tracking::NewtonConfig>());
+					tracker_.PrecisionSetup(tracker.template Get<PrecisionConfig>());
+					tracker_.SetDivergenceDetection(tracker.DivergenceDetection(), tracker.DivergenceTargetTime());
+				}
+
+				SystemType homotopy_;
+				SystemType target_;
+				TrackerType tracker_;
+				EndgameType endgame_;
+				tracking::FirstPrecisionRecorder<TrackerType> first_prec_rec_;
+				tracking::MinMaxPrecisionRecorder<TrackerType> min_max_prec_;
+			};
+
+
+			/**
+			\brief The objects the worker with an index tracks with.  Worker 0 is this algorithm's own tracker and endgame, so observers attached to them see the paths it tracks.  The others are the copies made by WorkerSetup.
+			*/
+			PathWorker Worker(unsigned worker_index, std::mutex & finished_paths)
+			{
+				if (worker_index==0)
+					return PathWorker{TargetSystem(), GetTracker(), GetEndgame(), first_prec_rec_, min_max_prec_, finished_paths};
+
+				auto& storage = *worker_storage_[worker_index-1];
+				return PathWorker{storage.target_, storage.tracker_, storage.endgame_, storage.first_prec_rec_, storage.min_max_prec_, finished_paths};
+			}
+
+
 			/**
 			\brief Check that the solver functor is ready to go.
 			*/
@@ -577,10 +743,77 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 				solution_final_metadata_.resize(num_as_size_t);
 				solutions_at_endgame_boundary_.resize(num_as_size_t);
 				solutions_post_endgame_.resize(num_as_size_t);
+				path_costs_.assign(num_as_size_t, PathCost());
 
 				SetMidpathRetrackTol(this->template Get<Tolerances>().newton_before_endgame);
+
+				GenerateStartPoints();
+
+				DivergenceSetup();
+
+				WorkerSetup();
 			}
 
+
+			/**
+			\brief Have the tracker judge paths going to infinity before the endgame boundary as the endgame would, with the endgame's security settings, by their growth toward the target time.
+			*/
+			void DivergenceSetup()
+			{
+				auto const& security = GetEndgame().template Get<endgame::SecurityConfig>();
+
+				tracking::DivergenceConfig divergence;
+				divergence.early_divergence_detection = security.early_divergence_detection;
+				divergence.num_samples = GetEndgame().template Get<endgame::EndgameConfig>().num_sample_points;
+				divergence.min_divergence_rate = security.min_divergence_rate;
+				divergence.divergence_rate_tolerance = security.divergence_rate_tolerance;
+				divergence.divergence_min_norm = security.divergence_min_norm;
+
+				GetTracker().SetDivergenceDetection(divergence, this->template Get<ZeroDimConf>().target_time);
+			}
+
+
+			/**
+			\brief Generate every start point of the start system, before any thread starts tracking.
+
+			The start system shares its nodes with the homotopy, and generating a start point evaluates them, so it can't be done while the homotopy is being tracked on.  The points are generated in the initial ambient precision.
+			*/
+			void GenerateStartPoints()
+			{
+				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
+
+				start_points_.points.resize(static_cast<SolnIndT>(num_start_points_));
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+					start_points_.points[static_cast<SolnIndT>(ii)] = StartSystem().template StartPoint<BaseComplexType>(ii);
+			}
+
+
+			/**
+			\brief Make the trackers, endgames and systems for the threads other than the first, if tracking with more than one.
+
+			The first thread tracks with the algorithm's own tracker and endgame.  Trackers and systems keep state while tracking, so each other thread gets its own, cloned from the homotopy and target system, and set up like the algorithm's tracker and endgame.  Observers attached to the algorithm's tracker and endgame are not attached to the copies.
+			*/
+			void WorkerSetup()
+			{
+				worker_storage_.clear();
+
+				auto num_threads = this->template Get<ZeroDimConf>().num_threads;
+				if (num_threads==0)
+					num_threads = std::max(1u, std::thread::hardware_concurrency());
+				num_threads = static_cast<unsigned>(std::min<unsigned long long>(num_threads, num_start_points_));
+
+				if (num_threads < 2)
+					return;
+
+				// a fixed precision tracker takes its precision from the default when it's made
+				auto const previous_precision = DefaultPrecision();
+				DefaultPrecision(GetTracker().CurrentPrecision());
+				for (unsigned ii = 1; ii < num_threads; ++ii)
+					worker_storage_.push_back(std::make_shared<WorkerStorage>(Homotopy(), TargetSystem(), GetTracker(), GetEndgame()));
+				DefaultPrecision(previous_precision);
+			}
+
+
 			/**
 			\brief Track from the start point in time, from each start point of the start system, to the endgame boundary.
 
@@ -594,27 +827,125 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_before_endgame);
 
-				auto t_start = this->template Get<ZeroDimConf>().start_time;
-				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
-
+				std::vector<SolnIndT> paths;
+				paths.reserve(static_cast<SolnIndT>(num_start_points_));
 				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+					paths.push_back(static_cast<SolnIndT>(ii));
+
+				ForEachPath(paths, this->template Get<Tolerances>().newton_before_endgame,
+				            [this](PathWorker & worker, SolnIndT soln_ind){ TrackSinglePathBeforeEG(worker, soln_ind); });
+			}
+
+
+			/**
+			\brief Call a function for each of a set of paths, spreading them over the workers' threads.
+
+			Paths are handed out one at a time, in the order given, so that threads which get quick paths take more of them.  Each path writes only its own entries of the results, so the threads need no other coordination.  If tracking a path throws, the remaining paths are abandoned, and the exception rethrown here.
+
+			\param paths The indices of the paths.
+			\param tracking_tolerance The tolerance each worker's tracker should track with.
+			\param track_one The function to call, taking the worker and the index of the path.
+			*/
+			template<typename TrackOneT>
+			void ForEachPath(std::vector<SolnIndT> const& paths, NumErrorT const& tracking_tolerance, TrackOneT const& track_one)
+			{
+				std::atomic<size_t> next_path(0);
+				ForEachTask<SolnIndT>([&paths, &next_path](SolnIndT & soln_ind)
+				            {
+				            	auto ii = next_path++;
+				            	if (ii >= paths.size())
+				            		return false;
+				            	soln_ind = paths[ii];
+				            	return true;
+				            },
+				            [](SolnIndT){},
+				            tracking_tolerance, track_one);
+			}
+
+
+			/**
+			\brief Call a function for each task taken from a source, spreading them over the workers' threads.
+
+			Whichever thread is free next takes the next task from the source, so the source decides the order tasks start in.  If a task throws, the remaining tasks are abandoned, and the exception rethrown here.
+
+			\tparam TaskT What the source hands out.  The index of a path, or a stage of one.
+			\param next_task Sets its argument to the next task and returns true, or returns false if there are none left.  Called from all the threads at once.
+			\param done Called with each task after it has been run.  Called from all the threads at once.
+			\param tracking_tolerance The tolerance each worker's tracker should track with.
+			\param track_one The function to call, taking the worker and the task.
+			*/
+			template<typename TaskT, typename NextTaskT, typename DoneT, typename TrackOneT>
+			void ForEachTask(NextTaskT const& next_task, DoneT const& done, NumErrorT const& tracking_tolerance, TrackOneT const& track_one)
+			{
+				std::mutex finished_paths;
+
+				if (worker_storage_.empty())
 				{
-					TrackSinglePathBeforeEG(static_cast<SolnIndT>(ii));
+					auto worker = Worker(0, finished_paths);
+					worker.tracker.SetTrackingTolerance(tracking_tolerance);
+					TaskT task;
+					while (next_task(task))
+					{
+						track_one(worker, task);
+						done(task);
+					}
+					return;
 				}
-			}
 
+				auto const precision = DefaultPrecision();
+				auto const options = mpfr_float::thread_default_variable_precision_options();
+
+				std::atomic<bool> abandoned(false);
+				std::vector<std::exception_ptr> errors(worker_storage_.size()+1);
+
+				auto work = [&](unsigned worker_index)
+				{
+					DefaultPrecision(precision);
+					scoped_mpfr_precision_options_this_thread precision_options(options);
+
+					auto worker = Worker(worker_index, finished_paths);
+
+					try{
+						worker.tracker.SetTrackingTolerance(tracking_tolerance);
+						TaskT task;
+						while (!abandoned && next_task(task))
+						{
+							track_one(worker, task);
+							done(task);
+						}
+					}
+					catch (...)
+					{
+						errors[worker_index] = std::current_exception();
+						abandoned = true;
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 1; ii <= worker_storage_.size(); ++ii)
+					threads.emplace_back(work, ii);
+				work(0);
+				for (auto& t : threads)
+					t.join();
+
+				for (auto const& e : errors)
+					if (e)
+						std::rethrow_exception(e);
+			}
 
 
 			/**
 			 /brief Track a single path before we reach the endgame boundary.
 			*/
-			void TrackSinglePathBeforeEG(SolnIndT soln_ind)
+			void TrackSinglePathBeforeEG(PathWorker & worker, SolnIndT soln_ind)
 			{
+				auto& tracker = worker.tracker;
+
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						GetTracker().AddObserver(first_prec_rec_);
-						GetTracker().AddObserver(min_max_prec_);
+						tracker.AddObserver(worker.first_prec_rec);
+						tracker.AddObserver(worker.min_max_prec);
 					}
 
 					auto& smd = solution_final_metadata_[soln_ind];
@@ -625,29 +956,39 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
 				auto t_start = this->template Get<ZeroDimConf>().start_time;
 				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
-				auto start_point = StartSystem().template StartPoint<BaseComplexType>(soln_ind);
 
 				Vec<BaseComplexType> result;
-				auto tracking_success = GetTracker().TrackPath(result, t_start, t_endgame_boundary, start_point);
+				auto start_clock = std::chrono::steady_clock::now();
+				auto tracking_success = tracker.TrackPath(result, t_start, t_endgame_boundary, start_points_.points[soln_ind]);
+
+				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaDataT({ result, tracking_success, tracker.CurrentStepsize() });
 
-				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaDataT({ result, tracking_success, GetTracker().CurrentStepsize() });
+				auto& cost = path_costs_[soln_ind];
+				cost.seconds_before_endgame = std::chrono::duration<double>(std::chrono::steady_clock::now()-start_clock).count();
+				cost.num_steps = tracker.NumTotalStepsTaken();
+				cost.max_precision = tracker.CurrentPrecision();
+				cost.condition_number = tracker.LatestConditionNumber();
+				cost.stepsize = static_cast<NumErrorT>(tracker.CurrentStepsize());
 
 					smd.pre_endgame_success = tracking_success;
+					smd.is_finite = tracking_success!=SuccessCode::GoingToInfinity;
+					smd.divergence_rate = tracker.DivergenceRate();
 
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						if (first_prec_rec_.DidPrecisionIncrease())
+						if (worker.first_prec_rec.DidPrecisionIncrease())
 						{
 							smd.precision_changed = true;
-							smd.time_of_first_prec_increase = first_prec_rec_.TimeOfIncrease();
+							smd.time_of_first_prec_increase = worker.first_prec_rec.TimeOfIncrease();
 						}
 						else
-						GetTracker().RemoveObserver(first_prec_rec_);
-						GetTracker().RemoveObserver(min_max_prec_);
+						tracker.RemoveObserver(worker.first_prec_rec);
+						tracker.RemoveObserver(worker.min_max_prec);
 						using std::max;
 						smd.max_precision_used =
-							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
+							max(smd.max_precision_used, worker.min_max_prec.MaxPrecision());
+						cost.max_precision = worker.min_max_prec.MaxPrecision();
 					}
 
 
@@ -655,13 +996,13 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 			void EGBoundaryAction()
 			{
-				auto midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, StartSystem());
+				auto midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, start_points_);
 
 				unsigned num_resolve_attempts = 0;
 				while (!midcheckpassed && num_resolve_attempts < this->template Get<ZeroDimConf>().max_num_crossed_path_resolve_attempts)
 				{
 					MidpathResolve();
-					midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, StartSystem());
+					midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, start_points_);
 					num_resolve_attempts++;
 				}
 			}
@@ -671,16 +1012,23 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 			{
 				ShrinkMidpathTolerance();
 
+				std::vector<SolnIndT> paths;
 				for(auto const& v : midpath_.GetCrossedPaths())
 				{
 					if(v.rerun())
 					{
 						unsigned long long index = v.index();
-						auto soln_ind = static_cast<SolnIndT>(index);
-						TrackSinglePathBeforeEG(soln_ind);
+						paths.push_back(static_cast<SolnIndT>(index));
 					}
 				}
 
+				// a re-track costs about what the first track did, so start the longest first
+				if (!worker_storage_.empty() && this->template Get<ZeroDimConf>().longest_endgames_first)
+					std::stable_sort(paths.begin(), paths.end(), [this](SolnIndT a, SolnIndT b)
+					                 { return path_costs_[a].seconds_before_endgame > path_costs_[b].seconds_before_endgame; });
+
+				ForEachPath(paths, midpath_retrack_tolerance_,
+				            [this](PathWorker & worker, SolnIndT soln_ind){ TrackSinglePathBeforeEG(worker, soln_ind); });
 			}
 
 
@@ -697,6 +1045,7 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 
 				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_during_endgame);
 
+				std::vector<SolnIndT> paths;
 				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
 				{
 					auto soln_ind = static_cast<SolnIndT>(ii);
@@ -704,37 +1053,68 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 					if (solution_final_metadata_[soln_ind].pre_endgame_success != SuccessCode::Success)
 						continue;
 
-					TrackSinglePathDuringEG(soln_ind);
+					paths.push_back(soln_ind);
+				}
+
+				auto track_one = [this](PathWorker & worker, SolnIndT soln_ind)
+				{
+					TrackSinglePathDuringEG(worker, soln_ind);
+					EmitPathFinished(worker, soln_ind);
+				};
+
+				// with one thread, the order doesn't matter, so keep the deterministic index order
+				if (worker_storage_.empty() || !this->template Get<ZeroDimConf>().longest_endgames_first)
+				{
+					ForEachPath(paths, this->template Get<Tolerances>().newton_during_endgame, track_one);
+					for (auto const& soln_ind : paths)
+						endgame_cost_model_.Observe(path_costs_[soln_ind], path_costs_[soln_ind].seconds_during_endgame);
+					return;
 				}
+
+				LongestFirstPathQueue queue(path_costs_, endgame_cost_model_);
+				for (auto const& soln_ind : paths)
+					queue.Push(soln_ind);
+
+				ForEachTask<SolnIndT>([&queue](SolnIndT & soln_ind){ return queue.Pop(soln_ind); },
+				            [&queue](SolnIndT soln_ind){ queue.Done(soln_ind); },
+				            this->template Get<Tolerances>().newton_during_endgame, track_one);
 			}
 
 
-			void TrackSinglePathDuringEG(SolnIndT soln_ind)
+			/**
+			\brief Run the endgame for a path from the endgame boundary, and record its solution and metadata.
+			*/
+			void TrackSinglePathDuringEG(PathWorker & worker, SolnIndT soln_ind)
 			{
+				auto& tracker = worker.tracker;
+				auto& endgame = worker.endgame;
+				auto& target = worker.target;
 
 					auto& smd = solution_final_metadata_[soln_ind];
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
 						if (!smd.precision_changed)
-							GetTracker().AddObserver(first_prec_rec_);
-						GetTracker().AddObserver(min_max_prec_);
+							tracker.AddObserver(worker.first_prec_rec);
+						tracker.AddObserver(worker.min_max_prec);
 					}
 
 				const auto& bdry_point = solutions_at_endgame_boundary_[soln_ind].path_point;
 
 
-				GetTracker().SetStepSize(solutions_at_endgame_boundary_[soln_ind].last_used_stepsize);
-				GetTracker().ReinitializeInitialStepSize(false);
+				tracker.SetStepSize(solutions_at_endgame_boundary_[soln_ind].last_used_stepsize);
+				tracker.ReinitializeInitialStepSize(false);
 
 				DefaultPrecision(Precision(bdry_point));
 				// we make these fresh so they are in the correct precision to start.
 				BaseComplexType t_end = this->template Get<ZeroDimConf>().target_time;
 				BaseComplexType t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
 
-				auto eg_success = GetEndgame().Run(t_endgame_boundary, bdry_point, t_end);
+				auto start_clock = std::chrono::steady_clock::now();
+				auto eg_success = endgame.Run(t_endgame_boundary, bdry_point, t_end);
+				path_costs_[soln_ind].seconds_during_endgame = std::chrono::duration<double>(std::chrono::steady_clock::now()-start_clock).count();
 
-				solutions_post_endgame_[soln_ind] = GetEndgame().template FinalApproximation<BaseComplexType>();
+				solutions_post_endgame_[soln_ind] = endgame.template FinalApproximation<BaseComplexType>();
 
 
 					// finally, store the metadata as necessary
@@ -744,38 +1124,165 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 					{
 						if (!smd.precision_changed)
 						{
-							if (first_prec_rec_.DidPrecisionIncrease())
+							if (worker.first_prec_rec.DidPrecisionIncrease())
 							{
 								smd.precision_changed = true;
-								smd.time_of_first_prec_increase = first_prec_rec_.TimeOfIncrease();
+								smd.time_of_first_prec_increase = worker.first_prec_rec.TimeOfIncrease();
 							}
 						}
-						GetTracker().RemoveObserver(first_prec_rec_);
-						GetTracker().RemoveObserver(min_max_prec_);
+						tracker.RemoveObserver(worker.first_prec_rec);
+						tracker.RemoveObserver(worker.min_max_prec);
 						using std::max;
 						smd.max_precision_used =
-							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
+							max(smd.max_precision_used, worker.min_max_prec.MaxPrecision());
 					}
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						assert(Precision(solutions_post_endgame_[soln_ind])==Precision(GetEndgame().template FinalApproximation<BaseComplexType>()));
+						assert(Precision(solutions_post_endgame_[soln_ind])==Precision(endgame.template FinalApproximation<BaseComplexType>()));
 						DefaultPrecision(Precision(solutions_post_endgame_[soln_ind]));
-						TargetSystem().precision(Precision(solutions_post_endgame_[soln_ind]));
+						target.precision(Precision(solutions_post_endgame_[soln_ind]));
 					}
-					smd.function_residual = static_cast<NumErrorT>(TargetSystem().Eval(solutions_post_endgame_[soln_ind]).template lpNorm<Eigen::Infinity>());
-					smd.final_time_used = GetEndgame().LatestTime();
-					smd.condition_number = GetTracker().LatestConditionNumber();
-					smd.newton_residual = GetTracker().LatestNormOfStep();
+					smd.function_residual = static_cast<NumErrorT>(target.Eval(solutions_post_endgame_[soln_ind]).template lpNorm<Eigen::Infinity>());
+					smd.final_time_used = endgame.LatestTime();
+					smd.condition_number = tracker.LatestConditionNumber();
+					smd.newton_residual = tracker.LatestNormOfStep();
 
-					smd.accuracy_estimate = GetEndgame().ApproximateError();
+					smd.accuracy_estimate = endgame.ApproximateError();
 					smd.accuracy_estimate_user_coords =
-						static_cast<NumErrorT>( (TargetSystem().DehomogenizePoint(solutions_post_endgame_[soln_ind]) -
-						TargetSystem().DehomogenizePoint(GetEndgame().template PreviousApproximation<BaseComplexType>())).template lpNorm<Eigen::Infinity>() );
-					smd.cycle_num = GetEndgame().CycleNumber();
+						static_cast<NumErrorT>( (target.DehomogenizePoint(solutions_post_endgame_[soln_ind]) -
+						target.DehomogenizePoint(endgame.template PreviousApproximation<BaseComplexType>())).template lpNorm<Eigen::Infinity>() );
+					smd.cycle_num = endgame.CycleNumber();
+					smd.divergence_rate = endgame.DivergenceRate();
+					smd.is_finite = eg_success!=SuccessCode::GoingToInfinity;
 					// end metadata gathering
 			}
 
 
+			/**
+			\brief Tell observers a path finished.  Called once for each path whose endgame ran, once its results are final.
+			*/
+			void EmitPathFinished(PathWorker & worker, SolnIndT soln_ind)
+			{
+				std::lock_guard<std::mutex> lock(worker.finished_paths);
+				this->template Emit<PathFinished<ZeroDim>>(*this, soln_ind);
+			}
+
+
+
+			/**
+			\brief Track each path to the endgame boundary, check it for crossings, and run its endgame, without waiting for the other paths between stages.
+
+			Each path arriving at the boundary is checked against those arrived before it, and crossed paths are re-tracked with a tighter tolerance right away, up to the maximum number of crossed path resolve attempts for each path.  A path re-tracked after its endgame ran gets its endgame run again.  Tracking is handed out before endgames, so that most crossings are found before the crossed paths' endgames run.
+
+			This finds the same crossings as the phased solve, except that each path's re-tracks are counted separately, and the tolerance shrinks with each re-track of that path, rather than with each round of re-tracks of all crossed paths.
+
+			Once tracking is over, each path's start and boundary points are freed as its endgame finishes, so that the final solutions replace them rather than adding to them.
+			*/
+			void TrackPipelined()
+			{
+				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
+
+				auto const tolerance_before_endgame = this->template Get<Tolerances>().newton_before_endgame;
+				auto const tolerance_during_endgame = this->template Get<Tolerances>().newton_during_endgame;
+				auto const retrack_factor = this->template Get<AutoRetrack>().midpath_decrease_tolerance_factor;
+
+				// an endgame turns off reinitializing the stepsize on its worker's tracker, so each track to the boundary puts back the setting the solve started with, as does the end of the solve for this algorithm's tracker
+				auto const reinitialize_stepsize = GetTracker().ReinitializesInitialStepSize();
+
+				midpath_.StartIncremental();
+				PathPipeline pipeline(static_cast<SolnIndT>(num_start_points_), this->template Get<ZeroDimConf>().max_num_crossed_path_resolve_attempts, path_costs_, endgame_cost_model_);
+
+				auto run = [&](PathWorker & worker, PathPipeline::Task const& task)
+				{
+					try{
+						if (task.stage==PathPipeline::Stage::TrackToBoundary)
+						{
+							auto tolerance = tolerance_before_endgame;
+							for (unsigned ii = 0; ii < task.num_retracks; ++ii)
+								tolerance *= retrack_factor;
+							worker.tracker.SetTrackingTolerance(tolerance);
+							worker.tracker.ReinitializeInitialStepSize(reinitialize_stepsize);
+
+							solution_final_metadata_[task.path].endgame_success = SuccessCode::NeverStarted;
+							TrackSinglePathBeforeEG(worker, task.path);
+
+							PathsFinished(worker, pipeline.Finish(task, solution_final_metadata_[task.path].pre_endgame_success==SuccessCode::Success,
+							                                      [&](PathPipeline const& locked){ return FindRetracks(task.path, locked); }));
+						}
+						else
+						{
+							worker.tracker.SetTrackingTolerance(tolerance_during_endgame);
+							TrackSinglePathDuringEG(worker, task.path);
+							PathsFinished(worker, pipeline.Finish(task, false, [](PathPipeline const&){ return std::vector<SolnIndT>(); }));
+						}
+					}
+					catch (...)
+					{
+						pipeline.Abandon();
+						throw;
+					}
+				};
+
+				try{
+					ForEachTask<PathPipeline::Task>([&pipeline](PathPipeline::Task & task){ return pipeline.Next(task); },
+					                                [](PathPipeline::Task const&){},
+					                                tolerance_before_endgame, run);
+				}
+				catch (...)
+				{
+					GetTracker().ReinitializeInitialStepSize(reinitialize_stepsize);
+					throw;
+				}
+				GetTracker().ReinitializeInitialStepSize(reinitialize_stepsize);
+			}
+
+
+			/**
+			\brief Check a path just arrived at the endgame boundary for crossings with those arrived before it, and decide which of the crossed paths to re-track.
+
+			Called with the pipeline locked, which is what keeps the checker and the boundary data of arrived paths from changing underneath.
+			*/
+			std::vector<SolnIndT> FindRetracks(SolnIndT soln_ind, PathPipeline const& pipeline)
+			{
+				std::vector<SolnIndT> retracks;
+				if (solutions_at_endgame_boundary_[soln_ind].success_code != SuccessCode::Success)
+					return retracks;
+
+				auto crossed = midpath_.Arrive(soln_ind, solutions_at_endgame_boundary_, start_points_);
+				if (crossed.empty())
+					return retracks;
+
+				crossed.push_back(soln_ind);
+				for (auto const& path : crossed)
+					if (midpath_.ShouldRerun(path) && pipeline.CanRetrack(static_cast<SolnIndT>(path)))
+					{
+						midpath_.Depart(path);
+						retracks.push_back(static_cast<SolnIndT>(path));
+					}
+
+				return retracks;
+			}
+
+
+			/**
+			\brief Emit PathFinished for the paths of a pipelined solve which just became final, if their endgames ran, and free the start and boundary points of those no longer checked for crossings.
+
+			Neither is touched again, so this is done without the pipeline locked.
+			*/
+			void PathsFinished(PathWorker & worker, PathPipeline::Finished const& finished)
+			{
+				for (auto const& path : finished.final_paths)
+					if (solution_final_metadata_[path].endgame_success!=SuccessCode::NeverStarted)
+						EmitPathFinished(worker, path);
+
+				for (auto const& path : finished.checked_paths)
+				{
+					solutions_at_endgame_boundary_[path].path_point = Vec<BaseComplexType>();
+					start_points_.points[path] = Vec<BaseComplexType>();
+				}
+			}
+
+
 
 			void PostEGAction()
 			{
@@ -840,10 +1347,15 @@ std::ostream& operator<<(std::ostream & out, const EGBoundaryMetaData<NumT> & me
 			EndgameType endgame_;
 			MidpathType midpath_;
 
+			std::vector<std::shared_ptr<WorkerStorage>> worker_storage_; ///< per-thread trackers etc. for the threads other than the first, when tracking with more than one thread.  empty outside Solve(), and when tracking with one thread.
+
 
 
 			/// computed data
+			StartPointCache start_points_; ///< generated by PreSolveSetup, so that tracking never generates them
 			SolnCont< EGBoundaryMetaDataT > solutions_at_endgame_boundary_; // the BaseRealType is the last used stepsize
+			SolnCont<PathCost> path_costs_; ///< what was measured about each path, for scheduling
+			PathCostModel endgame_cost_model_; ///< predicts endgame times, learned from the endgames of all solves so far
 			SolnCont<Vec<BaseComplexType> > solutions_post_endgame_;
 			SolnCont<SolutionMetaDataT> solution_final_metadata_;
 
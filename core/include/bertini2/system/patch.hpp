@@ -459,6 +459,26 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief Get the sizes of the variable groups being patched, in order.
+		*/
+		std::vector<unsigned> const& VariableGroupSizes() const
+		{
+			return variable_group_sizes_;
+		}
+
+
+		/**
+		\brief Get the coefficients of one of the patch equations, at the highest precision available.
+
+		\param group The index of the patch equation, equivalently of the variable group it patches.
+		*/
+		Vec<mpfr_complex> const& Coefficients(unsigned group) const
+		{
+			return coefficients_highest_precision_[group];
+		}
+
+
 		friend std::ostream& operator<<(std::ostream & out, Patch const& p)
 		{
 			out << p.NumVariableGroups() << " variable groups being patched\n";
@@ -0,0 +1,250 @@
+//This file is part of Bertini 2.
+//
+//sparse_polynomial.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//sparse_polynomial.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with sparse_polynomial.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file sparse_polynomial.hpp
+
+\brief Provides the bertini::SparsePolynomialSystem class, a flat sparse representation of polynomial systems for fast evaluation.
+*/
+
+#ifndef BERTINI_SPARSE_POLYNOMIAL_HPP
+#define BERTINI_SPARSE_POLYNOMIAL_HPP
+
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <type_traits>
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/mpfr_extensions.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/function_tree/forward_declares.hpp"
+
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+
+namespace bertini {
+
+	class System; // a forward declaration, solving the circular inclusion problem
+
+	/**
+	 \class SparsePolynomialSystem
+
+	 The natural functions of a polynomial system, expanded into sums of terms, each a coefficient times a monomial.  The monomials are stored sparsely, as the indices and exponents of the variables actually appearing, all terms of all functions packed into flat arrays.
+
+	 Evaluation is one pass over the terms.  The powers of each variable, up to the highest appearing, are tabulated first, by repeated multiplication.  Then each term is formed from the table, and its partial derivatives from prefix and suffix products of its factors, so the function values, Jacobian, and time derivative all come out together, with no division.  This avoids the virtual calls and pointer-chasing of function trees, and the generic instructions of straight-line programs, for systems such as katsura-n and cyclic-n.
+
+	 The path variable, if any, is treated as one more variable, whose partial derivatives are the time derivatives.
+
+	 \note Only polynomial functions can be represented: sums, products, negations, non-negative integer powers of variables, and division by constants.  Construction throws on anything else.  Expansion can produce many terms for functions given in factored form, such as high powers of sums.
+
+	 Patches are not included; the System evaluates them itself, as with function trees.
+	 */
+	class SparsePolynomialSystem{
+
+	public:
+
+		SparsePolynomialSystem() = default;
+
+		/**
+		\brief Expand the natural functions of a system into sparse form.
+
+		\throws std::runtime_error if a function is not polynomial in the system's variables and path variable.
+		*/
+		explicit
+		SparsePolynomialSystem(System const& sys);
+
+
+		/**
+		 \brief Copy the values of the variables into the input space.
+
+		 \param variable_values The vector of current variable values.
+		 */
+		template<typename Derived>
+		void SetVariableValues(Eigen::MatrixBase<Derived> const& variable_values) const{
+			using NumT = typename Derived::Scalar;
+
+			auto& inputs = std::get<Vec<NumT>>(inputs_);
+			inputs.resize(num_variables_+1);
+			inputs.head(num_variables_) = variable_values;
+			IsEvaluated<NumT>() = false;
+		}
+
+		/**
+		 \brief Copy the current time value into the input space.
+
+		 \throws std::runtime_error if this doesn't have a path variable.
+		 */
+		template<typename ComplexT>
+		void SetPathVariable(ComplexT const& time) const{
+			if (!has_path_variable_)
+				throw std::runtime_error("setting path variable of a SparsePolynomialSystem which doesn't have one.");
+
+			auto& inputs = std::get<Vec<ComplexT>>(inputs_);
+			inputs.resize(num_variables_+1);
+			inputs(num_variables_) = time;
+			IsEvaluated<ComplexT>() = false;
+		}
+
+
+		/**
+		\brief Evaluate the functions, Jacobian and time derivative at the current input values, in one pass over the terms.
+		*/
+		template<typename NumT>
+		void Eval() const; // definition in the cpp, along with the instantiations
+
+
+		template<typename NumT>
+		void GetFuncValsInPlace(Vec<NumT> & result) const{
+			if (!IsEvaluated<NumT>())
+				Eval<NumT>();
+			result.head(num_functions_) = std::get<Vec<NumT>>(function_values_);
+		}
+
+		template<typename NumT>
+		void GetJacobianInPlace(Mat<NumT> & result) const{
+			if (!IsEvaluated<NumT>())
+				Eval<NumT>();
+			result.topRows(num_functions_) = std::get<Mat<NumT>>(jacobian_);
+		}
+
+		template<typename NumT>
+		void GetTimeDerivInPlace(Vec<NumT> & result) const{
+			if (!IsEvaluated<NumT>())
+				Eval<NumT>();
+			result.head(num_functions_) = std::get<Vec<NumT>>(time_derivatives_);
+		}
+
+
+		inline unsigned NumFunctions() const{ return num_functions_;}
+
+		inline unsigned NumVariables() const{ return num_variables_;}
+
+		/**
+		\brief The total number of terms, across all functions.
+		*/
+		inline size_t NumTerms() const{ return term_functions_.size();}
+
+		bool HavePathVariable() const {
+			return has_path_variable_;
+		}
+
+
+		inline
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+		/**
+		\brief Change the precision of the coefficients.
+
+		Rounds down from the coefficients as expanded.  Going above the precision at which the functions were expanded re-expands them.
+		*/
+		void precision(unsigned new_precision) const;
+
+
+	private:
+
+		/**
+		\brief Whether the outputs in a precision are up to date with the inputs and coefficients in that precision.
+		*/
+		template<typename NumT>
+		bool& IsEvaluated() const{
+			return std::get< std::is_same<NumT, dbl_complex>::value ? 0 : 1 >(is_evaluated_);
+		}
+
+		/**
+		\brief Expand the functions into terms, storing the structure of the terms only if asked, and the coefficients always.
+		*/
+		void Expand(bool store_structure) const;
+
+
+		unsigned num_functions_ = 0;
+		unsigned num_variables_ = 0; // not counting the path variable
+		bool has_path_variable_ = false;
+
+		// kept so that the coefficients can be re-expanded at higher precision
+		std::vector< std::shared_ptr<node::Node> > functions_;
+		std::vector< std::shared_ptr<node::Variable> > variables_; // the path variable last, if there is one
+
+		// the terms, all functions' together.  the factors of term ii are [term_begin_[ii], term_begin_[ii+1]) in the factor arrays.
+		mutable std::vector<size_t> term_functions_;
+		mutable std::vector<size_t> term_begin_;
+		mutable std::vector<size_t> factor_variables_;
+		mutable std::vector<int> factor_exponents_;
+
+		// where the powers of each variable start in the table of powers, which has max_degrees_[ii]+1 entries for variable ii.
+		mutable std::vector<size_t> power_begin_;
+		mutable std::vector<int> max_degrees_;
+		mutable size_t max_factors_ = 0;
+
+		mutable std::vector<mpfr_complex> true_coefficients_; // as expanded, at expanded_precision_
+		mutable unsigned expanded_precision_ = 16;
+		mutable std::tuple< std::vector<dbl_complex>, std::vector<mpfr_complex> > coefficients_;
+		mutable unsigned precision_ = 16;
+
+		mutable std::tuple< Vec<dbl_complex>, Vec<mpfr_complex> > inputs_;
+		mutable std::tuple< std::vector<dbl_complex>, std::vector<mpfr_complex> > powers_;
+		mutable std::tuple< std::vector<dbl_complex>, std::vector<mpfr_complex> > prefix_products_;
+
+		mutable std::tuple< Vec<dbl_complex>, Vec<mpfr_complex> > function_values_;
+		mutable std::tuple< Mat<dbl_complex>, Mat<mpfr_complex> > jacobian_;
+		mutable std::tuple< Vec<dbl_complex>, Vec<mpfr_complex> > time_derivatives_;
+		mutable std::tuple<bool, bool> is_evaluated_{false, false}; // for double, then multiple precision, kept separately as the function tree does
+
+
+		friend class boost::serialization::access;
+
+		template <typename Archive>
+		void save(Archive& ar, const unsigned version) const {
+			ar & num_functions_;
+			ar & num_variables_;
+			ar & has_path_variable_;
+			ar & functions_;
+			ar & variables_;
+			ar & precision_;
+		}
+
+		template <typename Archive>
+		void load(Archive& ar, const unsigned version) {
+			ar & num_functions_;
+			ar & num_variables_;
+			ar & has_path_variable_;
+			ar & functions_;
+			ar & variables_;
+			ar & precision_;
+
+			if (!functions_.empty())
+				Expand(true);
+		}
+
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
+	};
+
+} // namespace bertini
+
+#endif
@@ -34,11 +34,79 @@
 #include "bertini2/system/start_base.hpp"
 #include "bertini2/system/start/utility.hpp"
 
+#include <cstdint>
+
 namespace bertini 
 {
 	namespace start_system
 	{
 
+		/**
+		\brief Compact storage for the valid partitions of an m-homogeneous degree matrix.
+
+		Each partition assigns a variable group (a column of the degree matrix) to every function (a row).  The entries are bit-packed, using just enough bits to hold the largest column index, so a partition costs a few bytes rather than a heap-allocated vector apiece.
+
+		Indexing produces a fresh `Vec<int>`, so the container can be used as a read-only sequence of partitions.
+		*/
+		class PackedPartitions
+		{
+		public:
+			PackedPartitions() = default;
+
+			/**
+			\param length The number of entries in each partition, the number of rows of the degree matrix.
+			\param num_groups The number of values an entry can take, the number of columns of the degree matrix.
+			*/
+			PackedPartitions(size_t length, size_t num_groups);
+
+			/**
+			\brief Append a partition.
+
+			\throws std::runtime_error, if the partition is of the wrong length.
+			*/
+			void push_back(Vec<int> const& partition);
+
+			/**
+			\brief Append all the partitions from another container of the same shape, preserving order.
+			*/
+			void append(PackedPartitions const& other);
+
+			/**
+			\brief Unpack the partition with a given index.
+			*/
+			Vec<int> operator[](size_t index) const;
+
+			/**
+			\brief Get a single entry, the column chosen for a row, of a partition.
+			*/
+			int operator()(size_t index, size_t row) const;
+
+			size_t size() const
+			{
+				return size_;
+			}
+
+			bool empty() const
+			{
+				return size_==0;
+			}
+
+			void clear()
+			{
+				words_.clear();
+				size_ = 0;
+			}
+
+		private:
+			size_t length_ = 0; ///< The number of entries per partition.
+			unsigned bits_per_entry_ = 1; ///< The number of bits used to store one entry.
+			size_t words_per_partition_ = 0; ///< The number of 64-bit words used to store one partition.
+			size_t size_ = 0; ///< The number of partitions stored.
+			std::vector<std::uint64_t> words_;
+		};
+
+
+
 
 		/**
 		\brief The $m$-homogeneous start system for Numerical Algebraic Geometry
@@ -67,20 +135,77 @@ namespace bertini
 
 			/**
 			\brief Creates all valid partitions for multi-homogeneous start system to create start points.
+
+			The search is pruned using the sizes of the variable groups, and its subtrees are searched in parallel.
+
+			\param num_threads The number of threads to use.  0 means use as many as the hardware supports.
 			*/
-			void GenerateValidPartitions(System const& s);
+			void GenerateValidPartitions(System const& s, unsigned num_threads = 0);
 
 			/**
-			\brief Helper function that is used to find valid partitions in the degree matrix.
+			\brief Count the m-homogeneous Bezout number for a degree matrix, without enumerating its valid partitions.
+
+			This is a dynamic program over the rows of the degree matrix, whose state is the number of choices remaining in each column.  Its cost is polynomial in the number of rows for a fixed number of variable groups, rather than proportional to the number of partitions.
+
+			\param degree_matrix The degrees of each function (row) in each variable group (column).
+			\param group_sizes The number of variables in each variable group.  Each column must be chosen this many times.
+			\return The number of start points the m-homogeneous start system would have.  0 if there are no valid partitions.
+			\throws std::overflow_error, if the count does not fit in an unsigned long long.
 			*/
-			int ChooseColumnInRow(System const& s,Vec<int>& variable_group_counter, int row, int column);
+			static unsigned long long CountStartPoints(Mat<int> const& degree_matrix, std::vector<size_t> const& group_sizes);
 
 			/**
 			Get the number of start points for this m-homogeneous start system.  This is the Bezout bound for the target system.  Provided here for your convenience.
 			*/
 			unsigned long long NumStartPoints() const override;
 
-			unsigned long long NumStartPointsForPartition(Vec<int> partition) const;
+			unsigned long long NumStartPointsForPartition(Vec<int> const& partition) const;
+
+			/**
+			\brief The number of valid partitions of the degree matrix.
+			*/
+			size_t NumPartitions() const
+			{
+				return valid_partitions_.size();
+			}
+
+			/**
+			\brief Find the partition to which a start point index belongs.
+
+			Uses a binary search over the prefix sums of the number of start points per partition, so costs O(log P) for P partitions.
+
+			\param index The index of the start point, as passed to StartPoint(index).
+			\return The index of the partition generating that start point.
+			\throws std::out_of_range, if the index is not less than NumStartPoints().
+			*/
+			size_t PartitionContaining(unsigned long long index) const;
+
+			/**
+			\brief The index of the first start point generated by a partition.
+
+			Start points are numbered consecutively through the partitions, so the start points of partition ii have indices PartitionOffset(ii), ..., PartitionOffset(ii+1)-1.
+			*/
+			unsigned long long PartitionOffset(size_t partition_index) const
+			{
+				return partition_offsets_.at(partition_index);
+			}
+
+			/**
+			\brief Generate all the start points for a partition at once.
+
+			The linear system for a start point decouples into one block per variable group, so each block is factored once per choice of linear factors for its rows, and the factorization reused for every start point sharing that choice.  This is much cheaper than calling StartPoint(index) for each index in the partition.
+
+			The ii-th returned point is identical to StartPoint<T>(PartitionOffset(partition_index)+ii).  This method modifies no state, and is safe to call concurrently.
+
+			\tparam T The number type of the start points.  Either dbl or mpfr_complex.
+			\param partition_index Which partition to generate the start points of.
+			\return The start points, in index order.
+			*/
+			template<typename T>
+			std::vector<Vec<T>> StartPointsForPartition(size_t partition_index) const
+			{
+				return GenerateStartPointsForPartition(T(), partition_index);
+			}
 
 			MHomogeneous& operator*=(Nd const& n);
 
@@ -94,7 +219,7 @@ namespace bertini
 			/**
 			 \brief Partitions used for creating start points in the multi-homogeneous start system.
 			 */
-			std::deque< Vec<int> > valid_partitions_;
+			PackedPartitions valid_partitions_;
 
 
 		private:
@@ -118,9 +243,41 @@ namespace bertini
 			*/
 			template<typename T>
 			void GenerateStartPointT(Vec<T>& start_point, unsigned long long index) const;
-			
-			
 
+			std::vector<Vec<dbl>> GenerateStartPointsForPartition(dbl, size_t partition_index) const;
+
+			std::vector<Vec<mpfr_complex>> GenerateStartPointsForPartition(mpfr_complex, size_t partition_index) const;
+
+			/**
+			 A local version of GenerateStartPointsForPartition that can be templated
+			*/
+			template<typename T>
+			void GenerateStartPointsForPartitionT(std::vector<Vec<T>>& start_points, size_t partition_index) const;
+
+			/**
+			 \brief Solve the block of the start point's linear system belonging to one variable group, and write the result into the coordinates of that group.
+
+			 \param start_point The point to write into.
+			 \param group The variable group, a column of the degree matrix.
+			 \param rows The rows of the degree matrix (functions) for which the partition chose this group.
+			 \param factors The linear factor chosen in each of those rows.
+			*/
+			template<typename T>
+			void SolveGroupBlock(Vec<T>& start_point, size_t group, std::vector<size_t> const& rows, std::vector<size_t> const& factors) const;
+
+			/**
+			 \brief The number of linear factors to choose from in each row, for a partition.
+			*/
+			std::vector<size_t> PartitionDimensions(Vec<int> const& partition) const;
+
+			/**
+			 \brief Compute partition_offsets_ from valid_partitions_.
+
+			 \throws std::overflow_error, if the number of start points does not fit in an unsigned long long.
+			*/
+			void ComputePartitionOffsets();
+
+			std::vector<unsigned long long> partition_offsets_; ///< Prefix sums of the number of start points per partition.  Has one more entry than there are partitions, the last being the total number of start points.
 			
 			std::vector<unsigned long long> degrees_; ///< stores the degrees of the functions.
 			std::vector< VariableGroup > var_groups_;
@@ -139,6 +296,32 @@ namespace bertini
 			}
 
 		};
+
+
+
+		/**
+		\brief Compute the m-homogeneous Bezout number of a system, with respect to a proposed grouping of its variables.
+
+		The partitions of the degree matrix are counted, not enumerated, so this is cheap enough to use for comparing groupings.
+
+		\param s The target system.  Must be polynomial.
+		\param groups The proposed affine variable groups.
+		\return The number of paths the m-homogeneous start system would have.  0 if the grouping admits no valid partitions.
+		*/
+		unsigned long long MHomBezoutNumber(System const& s, std::vector<VariableGroup> const& groups);
+
+
+		/**
+		\brief Heuristically find a grouping of the affine variables of a system with a low m-homogeneous Bezout number.
+
+		A local search, whose steps move one variable into another or a new group, or merge two groups, while doing so lowers the m-homogeneous Bezout number.  It is run from both all variables in one group (the total degree) and every variable in its own group, and the better result kept.  The result is a local minimum, and need not be the best grouping.
+
+		\param s The target system.  Must be polynomial, and have only affine variable groups.
+		\return The variable groups found.  Declare these on the system before constructing the MHomogeneous start system.
+		\throws std::runtime_error, if the system has homogeneous variable groups or ungrouped variables.
+		*/
+		std::vector<VariableGroup> LowestMHomBezoutGrouping(System const& s);
+
 	}//end start_system namespace
 }//end bertini namespace
 
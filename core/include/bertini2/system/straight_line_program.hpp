@@ -46,6 +46,7 @@
 #include "bertini2/detail/visitor.hpp"
 
 #include <boost/serialization/utility.hpp>
+#include <boost/serialization/version.hpp>
 
 // code copied from Bertini1's file include/bertini.h
 
@@ -192,6 +193,8 @@ namespace bertini {
 
 	 Patches are just functions in this framework.  The variables appear at the front of the memory, then functions, then derivatives.  This should make copying data out easy, because it's all in one place.
 
+ If the system is patched and compiles its patches into the SLP (see System::SetCompilePatchesIntoSLP), the patch equations follow the natural functions, and their rows of the Jacobian and time derivative are included too.  The constant entries of those rows are stored directly in the output locations, so evaluation only computes the patch values themselves.
+
 	 In contrast to Bertini1 SLP's, we don't put all the numbers at the front -- they just get scattered through the SLP's memory.
 	 */
 	class StraightLineProgram{
@@ -247,10 +250,11 @@ namespace bertini {
 		 A struct encapsulating the numbers of things appearing in the SLP
 		 */
 		struct NumberOf{
-			size_t Functions{0};
+			size_t Functions{0}; // including patches, if compiled in
 			size_t Variables{0};
 			size_t Jacobian{0};
 			size_t TimeDeriv{0};
+			size_t Patches{0}; // the patch equations compiled in, counted among the Functions
 
 			friend class boost::serialization::access;
 
@@ -260,9 +264,26 @@ namespace bertini {
 				ar & Variables;
 				ar & Jacobian;
 				ar & TimeDeriv;
+				if (version >= 1)
+					ar & Patches;
+				else if (Archive::is_loading::value)
+					Patches = 0; // archives from before version 1 predate compiling patches into the SLP
 			}
 		};
 
+		/**
+		 \struct EvaluationContext
+
+		 The mutable state of one evaluation of a SLP: its memory banks, holding numbers, inputs, temporaries and outputs, and whether they hold current results.
+
+		 An SLP evaluated only through contexts is never written to, so any number of threads can share one SLP, each evaluating with its own context, instead of each needing a copy of the whole program.  Make one with MakeContext().  Changing the precision of the SLP invalidates its contexts; make new ones.
+		 */
+		struct EvaluationContext{
+			std::tuple< std::vector<dbl_complex>, std::vector<mpfr_complex> > Memory;
+			bool IsEvaluated{false};
+			unsigned WorkingPrecision{16};
+		};
+
 		/**
 		The constructor -- how to make a SLP from a System.
 		*/
@@ -355,15 +376,7 @@ namespace bertini {
 		 */
 		template<typename NumT>
 		void GetFuncValsInPlace(Vec<NumT> & result) const{
-			if (!is_evaluated_)
-				this->EvalFunctions<NumT>();
-
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
-
-			// copy content
-			for (int ii = 0; ii < number_of_.Functions; ++ii) {
-				result(ii) = memory[ii + output_locations_.Functions];
-			}
+			result.head(number_of_.Functions) = FuncValsView<NumT>();
 		}
 
 		/**
@@ -379,17 +392,7 @@ namespace bertini {
 
 		template<typename NumT>
 		void GetJacobianInPlace(Mat<NumT> & result) const{
-			if (!is_evaluated_)
-				this->EvalJacobian<NumT>();
-
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
-		
-			// copy content
-			for (int jj =0; jj < number_of_.Variables; ++jj) {
-				for (int ii = 0; ii < number_of_.Functions; ++ii) {
-					result(ii, jj) = memory[ii+jj*number_of_.Functions + output_locations_.Jacobian];
-				}
-			}
+			result.topRows(number_of_.Functions) = JacobianView<NumT>();
 		}
 
 		/**
@@ -405,15 +408,133 @@ namespace bertini {
 
 		template<typename NumT>
 		void GetTimeDerivInPlace(Vec<NumT> & result) const{
+			result.head(number_of_.Functions) = TimeDerivView<NumT>();
+		}
+
+
+		/**
+		\brief A read-only view of the function values, directly in the memory of the SLP.  Evaluates first if needed.
+
+		The view is invalidated by the next evaluation, so copy out of it if you need the values to persist.
+
+		\tparam NumT numeric type
+		 */
+		template<typename NumT>
+		Eigen::Map<const Vec<NumT>> FuncValsView() const{
+			if (!is_evaluated_)
+				this->EvalFunctions<NumT>();
+
+			auto& memory =  std::get<std::vector<NumT>>(memory_);
+			return Eigen::Map<const Vec<NumT>>(memory.data() + output_locations_.Functions, number_of_.Functions);
+		}
+
+		/**
+		\brief A read-only view of the Jacobian, directly in the memory of the SLP, where it is stored column-major.  Evaluates first if needed.
+
+		The view is invalidated by the next evaluation.  A matrix decomposition can be computed straight from it, without first copying into a matrix.
+
+		\tparam NumT numeric type
+		 */
+		template<typename NumT>
+		Eigen::Map<const Mat<NumT>> JacobianView() const{
+			if (!is_evaluated_)
+				this->EvalJacobian<NumT>();
+
+			auto& memory =  std::get<std::vector<NumT>>(memory_);
+			return Eigen::Map<const Mat<NumT>>(memory.data() + output_locations_.Jacobian, number_of_.Functions, number_of_.Variables);
+		}
+
+		/**
+		\brief A read-only view of the time derivatives, directly in the memory of the SLP.  Evaluates first if needed.
+
+		The view is invalidated by the next evaluation.
+
+		\tparam NumT numeric type
+		 */
+		template<typename NumT>
+		Eigen::Map<const Vec<NumT>> TimeDerivView() const{
 			if (!is_evaluated_)
 				this->EvalTimeDeriv<NumT>();
 
 			auto& memory =  std::get<std::vector<NumT>>(memory_);
-			// 1. make container, size correctly.
-			// 2. copy content
-			for (int ii = 0; ii < number_of_.Functions; ++ii) {
-				result(ii) = memory[ii + output_locations_.TimeDeriv];
+			return Eigen::Map<const Vec<NumT>>(memory.data() + output_locations_.TimeDeriv, number_of_.Functions);
+		}
+
+		/**
+		\brief Make a fresh context for evaluating this SLP without writing to it.  The numbers in the context are at the SLP's current precision.
+		*/
+		EvaluationContext MakeContext() const;
+
+		/**
+		\brief Evaluate the SLP into a context, leaving the SLP itself untouched.
+
+		\param context A context made by this SLP, at its current precision.
+		\param variable_values The values of the variables.
+		*/
+		template<typename Derived>
+		void Eval(EvaluationContext & context, Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+
+#ifndef BERTINI_DISABLE_PRECISION_CHECKS
+			if (!std::is_same<NumT,dbl_complex>::value && Precision(variable_values)!=this->precision_){
+				std::stringstream err_msg;
+				err_msg << "variable_values and SLP must be of same precision.  respective precisions: " << Precision(variable_values) << " " << this->precision_ << std::endl;
+				throw std::runtime_error(err_msg.str());
 			}
+#endif
+
+			auto& memory = ContextMemory<NumT>(context);
+
+			for (int ii = 0; ii < number_of_.Variables; ++ii)
+				memory[ii + input_locations_.Variables] = variable_values(ii);
+
+			EvalInMemory(memory);
+			context.IsEvaluated = true;
+		}
+
+		/**
+		\brief Evaluate the SLP into a context, with a value for the path variable, leaving the SLP itself untouched.
+
+		\param context A context made by this SLP, at its current precision.
+		\param variable_values The values of the variables.
+		\param time The value of the path variable.
+		*/
+		template<typename Derived, typename ComplexT>
+		void Eval(EvaluationContext & context, Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			static_assert(std::is_same<NumT, ComplexT>::value, "scalar types must be the same");
+
+			if (!this->HavePathVariable())
+				throw std::runtime_error("calling Eval with path variable, but this StraightLineProgram doesn't have one.");
+
+			ContextMemory<NumT>(context)[input_locations_.Time] = time;
+			Eval(context, variable_values);
+		}
+
+		/**
+		\brief A read-only view of the function values in a context.  The context must have been evaluated.
+		*/
+		template<typename NumT>
+		Eigen::Map<const Vec<NumT>> FuncValsView(EvaluationContext const& context) const{
+			return Eigen::Map<const Vec<NumT>>(EvaluatedContextMemory<NumT>(context).data() + output_locations_.Functions, number_of_.Functions);
+		}
+
+		/**
+		\brief A read-only view of the Jacobian in a context, stored column-major.  The context must have been evaluated.
+		*/
+		template<typename NumT>
+		Eigen::Map<const Mat<NumT>> JacobianView(EvaluationContext const& context) const{
+			return Eigen::Map<const Mat<NumT>>(EvaluatedContextMemory<NumT>(context).data() + output_locations_.Jacobian, number_of_.Functions, number_of_.Variables);
+		}
+
+		/**
+		\brief A read-only view of the time derivatives in a context.  The context must have been evaluated.
+		*/
+		template<typename NumT>
+		Eigen::Map<const Vec<NumT>> TimeDerivView(EvaluationContext const& context) const{
+			return Eigen::Map<const Vec<NumT>>(EvaluatedContextMemory<NumT>(context).data() + output_locations_.TimeDeriv, number_of_.Functions);
 		}
 
 		/**
@@ -458,6 +579,11 @@ namespace bertini {
 
 		inline unsigned NumVariables() const{ return number_of_.Variables;}
 
+		/**
+		\brief The number of patch equations compiled into the SLP.  These are counted among NumFunctions(), after the natural functions.
+		*/
+		inline unsigned NumPatches() const{ return number_of_.Patches;}
+
 
 		/**
 		\brief Get the current precision of the SLP.
@@ -595,6 +721,35 @@ namespace bertini {
 		template<typename NumT>
 		void CopyNumbersIntoMemory() const;
 
+		/**
+		 \brief Run the instructions on a bank of memory.  Eval and the context-taking Evals all come here.
+		 */
+		template<typename NumT>
+		void EvalInMemory(std::vector<NumT> & memory) const;
+
+		/**
+		 \brief Unpack the memory of a context, checking that it is in sync with this SLP.
+		 */
+		template<typename NumT>
+		std::vector<NumT>& ContextMemory(EvaluationContext & context) const{
+			auto& memory = std::get<std::vector<NumT>>(context.Memory);
+			if (memory.size()!=GetMemory<NumT>().size())
+				throw std::runtime_error("evaluation context was not made by this StraightLineProgram");
+#ifndef BERTINI_DISABLE_PRECISION_CHECKS
+			if (!std::is_same<NumT,dbl_complex>::value && context.WorkingPrecision!=this->precision_)
+				throw std::runtime_error("evaluation context and SLP are out-of-sync WRT precision; make a new context");
+#endif
+			context.IsEvaluated = false;
+			return memory;
+		}
+
+		template<typename NumT>
+		std::vector<NumT> const& EvaluatedContextMemory(EvaluationContext const& context) const{
+			if (!context.IsEvaluated)
+				throw std::runtime_error("viewing outputs of an evaluation context which has not been evaluated");
+			return std::get<std::vector<NumT>>(context.Memory);
+		}
+
 
 		mutable unsigned precision_ = 16; //< The current working number of digits
 		bool has_path_variable_ = false; //< Does this SLP have a path variable?
@@ -671,9 +826,11 @@ namespace bertini {
 			public Visitor<node::ArcTanOperator>,
 
 			public Visitor<node::special_number::Pi>,
-			public Visitor<node::special_number::E>
+			public Visitor<node::special_number::E>,
 
-			// also missing -- linears and difflinears.
+			// products of linears, as in m-homogeneous start systems
+			public Visitor<node::LinearProduct>,
+			public Visitor<node::DiffLinear>
 
 			// these abstract base types left out,
 
@@ -724,9 +881,54 @@ namespace bertini {
 
 			virtual void Visit(node::special_number::Pi const& n);
 			virtual void Visit(node::special_number::E const& n);
-			// missing -- linear and difflinear
+
+			// products of linears
+			virtual void Visit(node::LinearProduct const& n);
+			virtual void Visit(node::DiffLinear const& n);
 		private:
 
+			/**
+			 \brief Where the pieces of a compiled linear product live in memory.
+
+			 Linear products broken off the same source by differentiation share these, so each linear is evaluated once, and the products of all-but-one factors appearing in the derivative are formed from prefix and suffix products rather than from scratch.
+			*/
+			struct LinearProductLocations
+			{
+				std::vector<std::vector<size_t>> coefficients; ///< coefficients[factor][term], with the coefficient of the homogenizing variable last.
+				std::vector<size_t> linears; ///< The value of each linear factor.
+				std::vector<size_t> prefix; ///< prefix[ii] is the product of factors 0 through ii.  Empty until needed.
+				std::vector<size_t> suffix; ///< suffix[ii] is the product of factors ii through the last.  Empty until needed.
+				std::map<std::vector<size_t>, size_t> products; ///< The products of two or more factors already emitted, keyed on the factors.
+			};
+
+			/**
+			 \brief Compile each linear of a source linear product, if not already done.
+			*/
+			LinearProductLocations& CompileLinears(std::shared_ptr<const node::LinearProduct> const& source);
+
+			/**
+			 \brief Get the location of the product of some of the factors of a compiled linear product, emitting instructions for it as needed.
+			*/
+			size_t ProductOfLinears(LinearProductLocations& locations, std::vector<size_t> const& factors);
+
+			/**
+			 \brief Emit the instructions for the product of two or more of the factors of a compiled linear product, and get its location.  Called by ProductOfLinears, which reuses products already emitted.
+			*/
+			size_t MultiplyLinears(LinearProductLocations& locations, std::vector<size_t> const& factors);
+
+			/**
+			 \brief Get the location of a node, visiting it first if it has not yet been encountered.
+			*/
+			size_t LocationOf(Nd const& n);
+
+			/**
+			 \brief Compile the patch equations of a system into their output locations, after the natural functions.
+
+			 Their derivatives are constant, so are stored as numbers directly in the Jacobian and time derivative outputs.
+			*/
+			void CompilePatches(System const& sys);
+
+
 
 			/**
 			 \brief Provides a uniform interface for dealing with all numeric node types.
@@ -751,6 +953,7 @@ namespace bertini {
 			std::map<Nd, size_t> locations_encountered_nodes_; //< A registry of pointers-to-nodes and location in memory on where to find *their results*
 			std::map<IntT, size_t> locations_integers_;
 			std::map<Nd, size_t> locations_top_level_functions_and_derivatives_;
+			std::map<Nd, LinearProductLocations> linear_products_; //< compiled linears, keyed on the linear product they were broken off from.
 
 			SLP slp_under_construction_; //< the under-construction SLP.  will be returned at end of `compile`
 	};
@@ -759,6 +962,9 @@ namespace bertini {
 
 } // namespace bertini
 
+// version 1 added Patches to archives
+BOOST_CLASS_VERSION(bertini::StraightLineProgram::NumberOf, 1)
+
 
 
 
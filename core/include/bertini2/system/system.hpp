@@ -41,6 +41,7 @@
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/deque.hpp>
+#include <boost/serialization/version.hpp>
 #include <boost/type_index.hpp>
 
 #include "bertini2/mpfr_complex.hpp"
@@ -52,6 +53,7 @@
 #include "bertini2/system/patch.hpp"
 
 #include "bertini2/system/straight_line_program.hpp"
+#include "bertini2/system/sparse_polynomial.hpp"
 
 #include <boost/archive/binary_oarchive.hpp>
 	#include <boost/archive/binary_iarchive.hpp>
@@ -65,8 +67,9 @@ namespace bertini {
 	enum class EvalMethod
 	{
 		FunctionTree, // using virtual methods and recursion
-		SLP // using straight line programs
+		SLP, // using straight line programs
 		    // now!  20230714, Eindhoven, Netherlands
+		SparsePolynomial // expanded into flat arrays of terms.  polynomial systems only.
 	};
 
 	enum class DerivMethod
@@ -89,6 +92,13 @@ namespace bertini {
 	*/
 	bool DefaultAutoSimplify();
 
+	/**
+	\brief Get the default value for whether a patched system evaluated with an SLP should compile its patches into it.
+
+	False, so patched systems evaluate as they always have unless they opt in with System::SetCompilePatchesIntoSLP.
+	*/
+	bool DefaultCompilePatchesIntoSLP();
+
 	/**
 	\brief The fundamental polynomial system class for Bertini2.
 	
@@ -179,6 +189,7 @@ namespace bertini {
 					iter->Reset();
 				break;
 			case EvalMethod::SLP:
+			case EvalMethod::SparsePolynomial:
 				// nothing
 				break;
 			}	
@@ -212,6 +223,7 @@ namespace bertini {
 					break;
 				}
 				case EvalMethod::SLP:
+				case EvalMethod::SparsePolynomial:
 				{
 					// nothing to do, it's not a resetting kind of thing.
 					break;					
@@ -244,6 +256,7 @@ namespace bertini {
 					break;
 				}
 				case EvalMethod::SLP:
+				case EvalMethod::SparsePolynomial:
 				{
 					// nothing to do, it's not a resetting kind of thing.
 					break;					
@@ -286,16 +299,24 @@ namespace bertini {
 					for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
 						(*iter)->EvalInPlace<T>(function_values(counter));
 					}
+					break;
 				}
 
 				case EvalMethod::SLP:
 					{
 						slp_.GetFuncValsInPlace<T>(function_values);
+						break;
+					}
+
+				case EvalMethod::SparsePolynomial:
+					{
+						sparse_.GetFuncValsInPlace<T>(function_values);
+						break;
 					}
 			}
 
 
-			if (IsPatched())
+			if (IsPatched() && !PatchesAreInSLP())
 				patch_.EvalInPlace(function_values,
 									std::get<Vec<T> >(current_variable_values_)); // does a patch not have a caching mechanism?
 									// .segment(NumNaturalFunctions(),NumTotalVariableGroups())
@@ -508,9 +529,15 @@ namespace bertini {
 					this->slp_.GetJacobianInPlace<T>(J); // the variable values should have been copied into place elsewhere.  that's not this function's responsibility.
 					break;					
 				}
+
+				case EvalMethod::SparsePolynomial:
+				{
+					this->sparse_.GetJacobianInPlace<T>(J);
+					break;
+				}
 			}
 			
-			if (IsPatched())
+			if (IsPatched() && !PatchesAreInSLP())
 				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
 			
 		}
@@ -537,6 +564,57 @@ namespace bertini {
 			return J;
 		}
 
+
+
+		/**
+		\brief A read-only view of the function values of the system, at the previously set variable (and time) values.
+
+		When the system is evaluated by an SLP holding all of its functions, patches included, this is a view straight into the SLP's memory, and nothing is copied.  Otherwise, the values are evaluated into a buffer held by the system, and the view is of that.
+
+		The view is invalidated by the next evaluation of the system.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr_complex=bertini::mpfr_complex.
+		*/
+		template<typename T>
+		Eigen::Map<const Vec<T>> FunctionValuesView() const
+		{
+			if (!is_differentiated_)
+				Differentiate();
+
+			if (SLPHoldsWholeSystem())
+				return slp_.FuncValsView<T>();
+
+			auto& f = std::get<Vec<T>>(function_values_buffer_);
+			f.resize(NumTotalFunctions());
+			EvalInPlace(f);
+			return Eigen::Map<const Vec<T>>(f.data(), f.size());
+		}
+
+
+		/**
+		\brief A read-only view of the Jacobian of the system, at the previously set variable (and time) values.
+
+		When the system is evaluated by an SLP holding all of its functions, patches included, this is a view straight into the SLP's memory, where the Jacobian is stored column-major, and nothing is copied.  A decomposition can then be computed directly from it.  Otherwise, the Jacobian is evaluated into a buffer held by the system, and the view is of that.
+
+		The view is invalidated by the next evaluation of the system.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr_complex=bertini::mpfr_complex.
+		*/
+		template<typename T>
+		Eigen::Map<const Mat<T>> JacobianView() const
+		{
+			if (!is_differentiated_)
+				Differentiate();
+
+			if (SLPHoldsWholeSystem())
+				return slp_.JacobianView<T>();
+
+			auto& J = std::get<Mat<T>>(jacobian_buffer_);
+			J.resize(NumTotalFunctions(), NumVariables());
+			JacobianInPlace(J);
+			return Eigen::Map<const Mat<T>>(J.data(), J.rows(), J.cols());
+		}
+
 		
 
 		
@@ -797,10 +875,16 @@ namespace bertini {
 					this->slp_.GetTimeDerivInPlace(ds_dt); // the variable values should have been copied into place elsewhere.  that's not this function's responsibility.
 					break;					
 				}
+
+				case EvalMethod::SparsePolynomial:
+				{
+					this->sparse_.GetTimeDerivInPlace(ds_dt);
+					break;
+				}
 			}
 
 			// the patch doesn't move with time.  derivatives 0.
-			if (IsPatched())
+			if (IsPatched() && !PatchesAreInSLP())
 				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
 					ds_dt(ii+NumNaturalFunctions()) = T(0);
 			
@@ -811,6 +895,133 @@ namespace bertini {
 		
 		
 		
+		/**
+		\brief A read-only view of the time derivative of the system, at the previously set variable and time values.
+
+		When the system is evaluated by an SLP holding all of its functions, patches included, this is a view straight into the SLP's memory.  Otherwise, it is evaluated into a buffer held by the system, and the view is of that.
+
+		The view is invalidated by the next evaluation of the system.
+
+		\tparam T The number-type for return.  Probably dbl=std::complex<double>, or mpfr_complex=bertini::mpfr_complex.
+		\throws std::runtime error if the system does not have a path variable defined.
+		*/
+		template<typename T>
+		Eigen::Map<const Vec<T>> TimeDerivativeView() const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("computing time derivative of system with no path variable defined");
+
+			if (!is_differentiated_)
+				Differentiate();
+
+			if (SLPHoldsWholeSystem())
+				return slp_.TimeDerivView<T>();
+
+			auto& ds_dt = std::get<Vec<T>>(time_derivative_buffer_);
+			ds_dt.resize(NumTotalFunctions());
+			TimeDerivativeInPlace(ds_dt);
+			return Eigen::Map<const Vec<T>>(ds_dt.data(), ds_dt.size());
+		}
+
+
+
+		/**
+		\brief The mutable state of one evaluation of a system: the memory banks of its SLP, holding the current variable values, temporaries and outputs.
+		*/
+		using EvaluationContext = StraightLineProgram::EvaluationContext;
+
+		/**
+		\brief Whether this system can be evaluated through contexts, that is, whether it is evaluated by an SLP holding all of it, patches included.
+
+		Differentiates and compiles the system, if needed, to find out, so ask before sharing the system between threads.
+		*/
+		bool SupportsEvaluationContexts() const
+		{
+			if (!is_differentiated_)
+				Differentiate();
+
+			return SLPHoldsWholeSystem();
+		}
+
+		/**
+		\brief Make a context for evaluating this system without writing to it.
+
+		Evaluating through contexts leaves the system untouched, so any number of threads can share one system, each evaluating with its own lightweight context, instead of each needing a Clone of the whole system.  Make the contexts before sharing the system, since this differentiates and compiles it, if needed.  Changing the precision of the system invalidates its contexts.
+
+		\throws std::runtime_error if the system doesn't SupportsEvaluationContexts.  Function trees cache values in their nodes, so cannot be shared this way.
+		*/
+		EvaluationContext MakeEvaluationContext() const
+		{
+			if (!SupportsEvaluationContexts())
+				throw std::runtime_error("evaluation contexts require the system be evaluated by an SLP, with its patches compiled in");
+
+			return slp_.MakeContext();
+		}
+
+		/**
+		\brief Evaluate the system into a context, provided the system has no path variable defined.  The function values, Jacobian and so on are then viewed from the context.
+
+		\throws std::runtime_error if a path variable IS defined, or if the number of variables doesn't match.
+		*/
+		template<typename Derived>
+		void Evaluate(EvaluationContext & context, const Eigen::MatrixBase<Derived>& variable_values) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system, but number of variables doesn't match.");
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
+
+			slp_.Eval(context, variable_values);
+		}
+
+		/**
+		\brief Evaluate the system into a context, provided a path variable is defined for the system.
+
+		\throws std::runtime_error if a path variable is NOT defined, or if the number of variables doesn't match.
+		*/
+		template<typename Derived, typename T>
+		void Evaluate(EvaluationContext & context, const Eigen::MatrixBase<Derived>& variable_values, const T & path_variable_value) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system, but number of variables doesn't match.");
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+			slp_.Eval(context, variable_values, path_variable_value);
+		}
+
+		/**
+		\brief A read-only view of the function values in an evaluated context.
+		*/
+		template<typename T>
+		Eigen::Map<const Vec<T>> FunctionValuesView(EvaluationContext const& context) const
+		{
+			return slp_.FuncValsView<T>(context);
+		}
+
+		/**
+		\brief A read-only view of the Jacobian in an evaluated context.
+		*/
+		template<typename T>
+		Eigen::Map<const Mat<T>> JacobianView(EvaluationContext const& context) const
+		{
+			return slp_.JacobianView<T>(context);
+		}
+
+		/**
+		\brief A read-only view of the time derivative in an evaluated context.
+		*/
+		template<typename T>
+		Eigen::Map<const Vec<T>> TimeDerivativeView(EvaluationContext const& context) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("computing time derivative of system with no path variable defined");
+
+			return slp_.TimeDerivView<T>(context);
+		}
+
+
+
 		/**
 		\brief Compute the time-derivative of a system. 
 		
@@ -996,6 +1207,11 @@ namespace bertini {
 					slp_.SetVariableValues(new_values);
 					break;
 				}
+				case EvalMethod::SparsePolynomial:{
+					std::get<Vec<T> >(current_variable_values_) = new_values;
+					sparse_.SetVariableValues(new_values);
+					break;
+				}
 			} // switch
 
 			
@@ -1028,6 +1244,12 @@ namespace bertini {
 				case EvalMethod::SLP:{
 					path_variable_->set_current_value(new_value);
 					slp_.SetPathVariable(new_value);
+					break;
+				}
+				case EvalMethod::SparsePolynomial:{
+					path_variable_->set_current_value(new_value);
+					sparse_.SetPathVariable(new_value);
+					break;
 				}
 			}
 		}
@@ -1555,6 +1777,27 @@ namespace bertini {
 			return auto_simplify_;
 		}
 
+
+		/**
+		\brief Set whether the patches should be compiled into the straight line program, when evaluating using one.
+
+		If so, a single evaluation of the SLP fills in the values and Jacobian of the whole square system, patches included.  Otherwise, the patches are evaluated separately after the SLP.
+		*/
+		void SetCompilePatchesIntoSLP(bool val)
+		{
+			if (val != compile_patches_into_slp_)
+				is_differentiated_ = false; // so the SLP is recompiled
+			compile_patches_into_slp_ = val;
+		}
+
+		/**
+		\brief Query whether the patches are to be compiled into the straight line program.
+		*/
+		bool IsCompilingPatchesIntoSLP() const
+		{
+			return compile_patches_into_slp_;
+		}
+
 		/**
 		\brief Simplify the functions contained in the system.
 
@@ -1565,14 +1808,24 @@ namespace bertini {
 		/**
 		\brief Simplify the derivatives / jacobian / etc contained in the system.
 
+		All of them are simplified by one Simplifier, so subexpressions they share are simplified once.  The counts and timings are available from SimplificationStats afterward.
+
 		\note This may change any nodes on which the system depends.
 		*/
 		void SimplifyDerivatives() const;
 
+		/**
+		\brief Counts and timings from the most recent simplification of the derivatives.
+		*/
+		SimplificationStatistics const& SimplificationStats() const
+		{
+			return simplification_stats_;
+		}
+
 		/**
 		\brief Simplify as many aspects of the system as possible.  
 
-		\note This may change any nodes on which the system depends.
+		The system's functions and derivatives are given their simplified forms.  The nodes they were made of are left as they were, so expressions shared with other systems are unaffected.
 		*/
 		void Simplify();
 
@@ -1582,6 +1835,8 @@ namespace bertini {
 		 * */
 		void SetEvalMethod(EvalMethod method)
 		{
+			if (method != eval_method_)
+				is_differentiated_ = false; // whatever was prepared for the previous method is of no use to this one
 			eval_method_ = method;
 		}
 
@@ -1769,6 +2024,7 @@ namespace bertini {
 		mutable bool is_differentiated_ = false; ///< indicator for whether the jacobian tree has been populated.
 
 		mutable StraightLineProgram slp_; ///< The straight line program.  Is mutable since  it's a has-a, not is-a relationship.
+		mutable SparsePolynomialSystem sparse_; ///< The expanded form of the natural functions, when evaluating with EvalMethod::SparsePolynomial.
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
 
@@ -1786,6 +2042,31 @@ namespace bertini {
 
 		bool auto_simplify_ = DefaultAutoSimplify();
 
+		mutable SimplificationStatistics simplification_stats_; ///< from the most recent SimplifyDerivatives.  not serialized.
+
+		bool compile_patches_into_slp_ = DefaultCompilePatchesIntoSLP(); ///< whether the patches are part of the compiled SLP, when evaluating with one.
+
+
+		/**
+		\brief Whether the patches of the system are evaluated by the compiled SLP, instead of separately.
+		*/
+		bool PatchesAreInSLP() const
+		{
+			return eval_method_==EvalMethod::SLP && slp_.NumPatches()>0;
+		}
+
+		/**
+		\brief Whether the compiled SLP's outputs are the whole of the system's, so they can be viewed without copying.
+		*/
+		bool SLPHoldsWholeSystem() const
+		{
+			return eval_method_==EvalMethod::SLP && (!IsPatched() || slp_.NumPatches()>0);
+		}
+
+		mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > function_values_buffer_; ///< Where function values are put for FunctionValuesView, when they can't be viewed in the SLP.
+		mutable std::tuple< Mat<dbl>, Mat<mpfr_complex> > jacobian_buffer_; ///< Where the Jacobian is put for JacobianView, when it can't be viewed in the SLP.
+		mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > time_derivative_buffer_; ///< Where the time derivative is put for TimeDerivativeView, when it can't be viewed in the SLP.
+
 
 
 
@@ -1823,6 +2104,10 @@ namespace bertini {
 			ar & deriv_method_;
 
 			ar & auto_simplify_;
+			if (version >= 1)
+				ar & compile_patches_into_slp_;
+			else if (Archive::is_loading::value)
+				compile_patches_into_slp_ = false; // archives from before version 1 predate compiling patches into the SLP
 
 			// now for the cached / mutable things
 			ar & precision_;
@@ -1840,6 +2125,8 @@ namespace bertini {
 
 
 			ar & slp_; // does this need to be re-constructed after de-serialization?
+			if (version >= 1)
+				ar & sparse_;
 
 			ar & time_order_of_variable_groups_;
 
@@ -1894,6 +2181,9 @@ namespace bertini {
 	void Simplify(System & sys);
 }
 
+// version 1 added compile_patches_into_slp_ and sparse_ to archives
+BOOST_CLASS_VERSION(bertini::System, 1)
+
 
 
 
@@ -0,0 +1,377 @@
+//This file is part of Bertini 2.
+//
+//bertini2/trackers/amp_cost_model.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/trackers/amp_cost_model.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/trackers/amp_cost_model.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/trackers/amp_cost_model.hpp
+
+\brief The relative cost of arithmetic at each precision, used by adaptive precision tracking to choose precision and stepsize, and a benchmark measuring it for a system on the running machine.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <unistd.h>
+#endif
+
+#include "bertini2/mpfr_lu.hpp"
+#include "bertini2/system/system.hpp"
+#include "bertini2/io/system_cache.hpp"
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		 \brief Compute the cost function for arithmetic versus precision.
+
+		 From \cite AMP2, \f$C(P)\f$.  As currently implemented, this is
+		 \f$ 10.35 + 0.13 P \f$, where P is the precision.  These numbers are stale, and need to be recomputed.  Badly.  Please do this.
+
+		 This function tells you the relative cost of arithmetic at a given precision.  It is the cost an uncalibrated ArithmeticCostModel uses.  See CalibrateArithmeticCost to measure the cost for a system on the running machine.
+
+		 \param precision An integral number of digits -- then this gives the cost for arithmetic
+		 \return A double indicating how expensive arithmetic at a given precision is.  1 is the base-line for double-precision.
+		*/
+		inline
+		double ArithmeticCost(unsigned precision)
+		{
+			if (precision==DoublePrecision())
+				return 1;
+			else
+				return 10.35 + 0.13 * precision;
+		}
+
+
+
+		/**
+		 \brief The cost of a tracking step at each precision, relative to the cost in double precision.
+
+		 Uncalibrated, the cost is ArithmeticCost().  Calibrated, it is a table of measured costs at some multiple precisions, interpolated linearly between them, and extrapolated linearly from the last two beyond them.
+
+		 Written to and read from streams as a header line, then lines of precision and cost.
+		*/
+		class ArithmeticCostModel
+		{
+		public:
+
+			/**
+			 \brief The cost of a step at a precision, relative to double precision.
+			 */
+			double Cost(unsigned precision) const
+			{
+				if (precision==DoublePrecision())
+					return 1;
+
+				if (table_.empty())
+					return ArithmeticCost(precision);
+
+				auto above = table_.lower_bound(precision);
+				if (above!=table_.end() && above->first==precision)
+					return above->second;
+
+				if (above==table_.begin())
+					return above->second;
+
+				if (above==table_.end())
+				{
+					if (table_.size()==1)
+						return table_.begin()->second;
+					--above;
+				}
+
+				auto below = std::prev(above);
+				double slope = (above->second - below->second) / (double(above->first) - double(below->first));
+				return below->second + slope * (double(precision) - double(below->first));
+			}
+
+
+			/**
+			 \brief Record the measured cost of a step at a multiple precision, relative to double precision.
+			 */
+			void Set(unsigned precision, double cost)
+			{
+				table_[precision] = cost;
+			}
+
+			/**
+			 \brief Whether any costs have been measured.  If not, Cost() is ArithmeticCost().
+			 */
+			bool IsCalibrated() const
+			{
+				return !table_.empty();
+			}
+
+			std::map<unsigned, double> const& Table() const
+			{
+				return table_;
+			}
+
+			bool operator==(ArithmeticCostModel const& other) const
+			{
+				return table_==other.table_;
+			}
+
+			bool operator!=(ArithmeticCostModel const& other) const
+			{
+				return !(*this==other);
+			}
+
+		private:
+			std::map<unsigned, double> table_; // measured cost at multiple precisions, relative to double
+		};
+
+
+		inline
+		std::ostream& operator<<(std::ostream & out, ArithmeticCostModel const& model)
+		{
+			out << "arithmetic cost, relative to double precision\n";
+			auto initial_precision = out.precision();
+			for (auto const& entry : model.Table())
+				out << entry.first << " " << std::setprecision(17) << entry.second << "\n";
+			out.precision(initial_precision);
+			return out;
+		}
+
+		inline
+		std::istream& operator>>(std::istream & in, ArithmeticCostModel & model)
+		{
+			model = ArithmeticCostModel();
+
+			std::string header;
+			std::getline(in, header);
+
+			unsigned precision;
+			double cost;
+			while (in >> precision >> cost)
+				model.Set(precision, cost);
+
+			if (in.eof())
+				in.clear(std::ios::eofbit);
+			return in;
+		}
+
+
+
+		namespace detail{
+
+			/**
+			 Seconds per tracking step's worth of linear algebra at the current default precision: evaluating the function and Jacobian of the system at a random point, factoring the Jacobian and solving for a Newton step.
+			 */
+			template<typename ComplexType>
+			double SecondsPerEvaluateAndSolve(System const& sys, double min_seconds)
+			{
+				Vec<ComplexType> space = RandomOfUnits<ComplexType>(sys.NumVariables());
+				ComplexType time = RandomUnit<ComplexType>();
+				PivotedLU<ComplexType> lu;
+				Vec<ComplexType> step;
+
+				unsigned num_repetitions = 0;
+				auto start = std::chrono::steady_clock::now();
+				auto end = start;
+				do
+				{
+					if (sys.HavePathVariable())
+						sys.SetAndReset<ComplexType>(space, time);
+					else
+						sys.SetAndReset<ComplexType>(space);
+					lu.compute(sys.JacobianView<ComplexType>());
+					step = lu.solve(-sys.FunctionValuesView<ComplexType>());
+					++num_repetitions;
+					end = std::chrono::steady_clock::now();
+				}
+				while (std::chrono::duration<double>(end-start).count() < min_seconds);
+
+				return std::chrono::duration<double>(end-start).count() / num_repetitions;
+			}
+
+
+			/**
+			 Restores the default precision of this thread and the precision of a system when it goes out of scope, including by an exception.
+			 */
+			struct ScopedSystemAndDefaultPrecision
+			{
+				System const& sys;
+				unsigned saved_default_precision;
+				unsigned saved_system_precision;
+
+				ScopedSystemAndDefaultPrecision(System const& s) : sys(s), saved_default_precision(DefaultPrecision()), saved_system_precision(s.precision())
+				{}
+
+				~ScopedSystemAndDefaultPrecision()
+				{
+					DefaultPrecision(saved_default_precision);
+					sys.precision(saved_system_precision);
+				}
+
+				void reset(unsigned precision)
+				{
+					DefaultPrecision(precision);
+					sys.precision(precision);
+				}
+			};
+		}
+
+
+		/**
+		 \brief Measure the cost of tracking steps for a system on this machine, at a range of precisions, relative to double precision.
+
+		 Each measurement times evaluating the system and its derivatives, and factoring and solving with the Jacobian, which is the bulk of the work in a step, repeated for at least min_seconds.  Multiple precisions are measured from LowestMultiplePrecision() to max_precision, at about num_samples evenly spaced precisions, and interpolated between.
+
+		 The precision of the system and the default precision are restored afterward, also if a measurement throws.
+
+		 \param sys The system to be tracked, say a homotopy.  Must be square.
+		 \param max_precision The largest precision to measure.
+		 \param num_samples About how many multiple precisions to measure.
+		 \param min_seconds How long to repeat each measurement.
+		*/
+		inline
+		ArithmeticCostModel CalibrateArithmeticCost(System const& sys, unsigned max_precision, unsigned num_samples = 8, double min_seconds = 0.02)
+		{
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("can only calibrate arithmetic cost for square systems");
+
+			detail::ScopedSystemAndDefaultPrecision precisions(sys);
+
+			ArithmeticCostModel model;
+
+			precisions.reset(DoublePrecision());
+			const double seconds_double = detail::SecondsPerEvaluateAndSolve<dbl>(sys, min_seconds);
+
+			const unsigned lowest = LowestMultiplePrecision();
+			max_precision = std::max(max_precision, lowest);
+			unsigned spacing = std::max(PrecisionIncrement(), ((max_precision-lowest)/std::max(num_samples,1u) / PrecisionIncrement()) * PrecisionIncrement());
+
+			auto measure = [&](unsigned precision)
+			{
+				precisions.reset(precision);
+				model.Set(precision, detail::SecondsPerEvaluateAndSolve<mpfr_complex>(sys, min_seconds) / seconds_double);
+			};
+
+			for (unsigned precision = lowest; precision < max_precision; precision += spacing)
+				measure(precision);
+			measure(max_precision);
+
+			return model;
+		}
+
+
+		namespace detail{
+
+			/**
+			 The name of the running machine, or empty if it can't be had.
+			 */
+			inline
+			std::string HostName()
+			{
+#if defined(__unix__) || defined(__APPLE__)
+				char name[256] = {};
+				if (gethostname(name, sizeof(name)-1)==0)
+					return name;
+#endif
+				return {};
+			}
+		}
+
+
+		/**
+		 \brief The first line of an arithmetic cost cache file, identifying what the cost was measured for.
+
+		 The system is identified by SystemCache::Key of its variables and functions as text, so systems of the same size but with different functions have different keys.  Its derivatives aren't included, since they may not have been computed yet.  The machine is identified by its name, and the build by the compiler and the versions of Boost and MPFR, since any of them changes the cost.
+		*/
+		inline
+		std::string ArithmeticCostKey(System const& sys, unsigned max_precision)
+		{
+			std::stringstream system_text, build;
+			for (auto const& v : sys.Variables())
+				system_text << *v << " ";
+			system_text << "\n";
+			for (auto const& f : sys.GetNaturalFunctions())
+				system_text << *f << "\n";
+			if (sys.HavePathVariable())
+				system_text << "path variable " << *sys.GetPathVariable() << "\n";
+			system_text << sys.NumTotalFunctions() << " functions in all\n";
+			build << "to " << max_precision << " digits";
+
+			std::stringstream key;
+			key << "bertini2 arithmetic cost: system " << SystemCache::Key(system_text.str(), build.str())
+			    << " host " << detail::HostName()
+#ifdef __VERSION__
+			    << " compiler " << __VERSION__
+#endif
+			    << " boost " << BOOST_VERSION
+			    << " mpfr " << MPFR_VERSION_STRING;
+			return key.str();
+		}
+
+
+		/**
+		 \brief Read the arithmetic cost for a system from a cache file, or calibrate it and write the file.
+
+		 The cost depends on the machine and the system.  The first line of the file is ArithmeticCostKey, identifying both, and the file is recalibrated if it doesn't match, so a file shared between systems or machines is just overwritten.
+
+		 \param sys The system to be tracked.
+		 \param max_precision The largest precision to measure.
+		 \param cache_file Where to keep the cost.
+		*/
+		inline
+		ArithmeticCostModel CachedArithmeticCost(System const& sys, unsigned max_precision, std::string const& cache_file)
+		{
+			const auto key = ArithmeticCostKey(sys, max_precision);
+
+			{
+				std::ifstream in(cache_file);
+				std::string header;
+				if (in && std::getline(in, header) && header==key)
+				{
+					ArithmeticCostModel model;
+					in >> model;
+					if (model.IsCalibrated())
+						return model;
+				}
+			}
+
+			auto model = CalibrateArithmeticCost(sys, max_precision);
+
+			std::ofstream out(cache_file);
+			if (!out)
+				throw std::runtime_error("unable to open '" + cache_file + "' for writing the arithmetic cost");
+			out << key << "\n" << model;
+
+			return model;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
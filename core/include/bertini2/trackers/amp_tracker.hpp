@@ -89,31 +89,6 @@ namespace bertini{
 		}
 
 
-		/**
-		 \brief Compute the cost function for arithmetic versus precision.
-
-		 From \cite AMP2, \f$C(P)\f$.  As currently implemented, this is 
-		 \f$ 10.35 + 0.13 P \f$, where P is the precision.  These numbers are stale, and need to be recomputed.  Badly.  Please do this.
-		
-		 This function tells you the relative cost of arithmetic at a given precision. 
-
-		 \todo Recompute this cost function for boost::multiprecision::mpfr_float
-
-		 \param precision An integral number of digits -- then this gives the cost for arithmetic
-		 \return A double indicating how expensive arithmetic at a given precision is.  1 is the base-line for double-precision.  
-		*/
-		inline
-		double ArithmeticCost(unsigned precision)
-		{
-			if (precision==DoublePrecision())
-				return 1;
-			else
-				return 10.35 + 0.13 * precision;
-		}
-
-
-
-
 		/**
 		 \brief Compute a stepsize satisfying AMP Criterion B with a given precision
 
@@ -170,7 +145,7 @@ namespace bertini{
 		
 
 		/**
-		 \brief Compute precision and stepsize minimizing the ArithmeticCost() of tracking.
+		 \brief Compute precision and stepsize minimizing the cost of tracking.
 		 
 		 For a given range of precisions, an old stepsize, and a maximum stepsize, the Cost of tracking is computed, and a minimizer found.  
 		
@@ -186,8 +161,9 @@ namespace bertini{
 		 \param[in] digits_B The number of digits required, according to CriterionB from \cite AMP1, \cite AMP2
 		 \param[in] num_newton_iterations The number of allowed Newton corrector iterations.
 		 \param[in] predictor_order The order of the predictor being used.  This is the order itself, not the order of the error estimate.
+		 \param[in] cost_model The relative cost of a step at each precision.  Uncalibrated, this is ArithmeticCost().
 	
-		 \see ArithmeticCost
+		 \see ArithmeticCostModel, CalibrateArithmeticCost
 		*/
 		template<typename RealT>
 		void MinimizeTrackingCost(unsigned & new_precision, RealT & new_stepsize, 
@@ -195,19 +171,20 @@ namespace bertini{
 						  unsigned max_precision, RealT const& max_stepsize,
 						  unsigned digits_B,
 						  unsigned num_newton_iterations,
-						  unsigned predictor_order = 0)
+						  unsigned predictor_order = 0,
+						  ArithmeticCostModel const& cost_model = ArithmeticCostModel())
 		{
 			double min_cost = Eigen::NumTraits<double>::highest();
 			new_precision = MaxPrecisionAllowed()+1; // initialize to an impossible value.
 			new_stepsize = min_stepsize; // initialize to minimum permitted step size.
 
 			auto minimizer_routine = 
-				[&min_cost, &new_stepsize, &new_precision, &digits_B, num_newton_iterations, predictor_order, max_stepsize](unsigned p)
+				[&min_cost, &new_stepsize, &new_precision, &digits_B, num_newton_iterations, predictor_order, max_stepsize, &cost_model](unsigned p)
 				{
 					RealT candidate_stepsize = min(StepsizeSatisfyingCriterionB(p, digits_B, num_newton_iterations, predictor_order),
 					                              max_stepsize);
 					using std::abs;
-					double current_cost = ArithmeticCost(p) / abs(double(candidate_stepsize));
+					double current_cost = cost_model.Cost(p) / abs(double(candidate_stepsize));
 
 					if (current_cost < min_cost)
 					{
@@ -375,6 +352,24 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Measure the cost of steps at each precision for the tracked system on this machine, and use it to choose precision and stepsize.
+
+			Precisions up to the maximum precision of the adaptive precision config are measured.  Do this after PrecisionSetup, which would otherwise replace the measured cost.
+
+			\param cache_file If not empty, the cost is read from this file if it was measured for the same system, maximum precision, machine and build, and is otherwise measured and written to it.
+			*/
+			void CalibrateArithmeticCost(std::string const& cache_file = "")
+			{
+				auto AMP_config = Get<PrecConf>();
+				if (cache_file.empty())
+					AMP_config.arithmetic_cost = tracking::CalibrateArithmeticCost(GetSystem(), AMP_config.maximum_precision);
+				else
+					AMP_config.arithmetic_cost = CachedArithmeticCost(GetSystem(), AMP_config.maximum_precision, cache_file);
+				Set<PrecConf>(AMP_config);
+			}
+
+
 			const unsigned GetCurrentPrecision() const
 			{
 				return current_precision_;
@@ -437,7 +432,7 @@ namespace bertini{
 				         );
 				#endif
 
-				NotifyObservers(Initializing<AMPTracker,mpfr_complex>(*this,start_time, end_time, start_point));
+				Emit<Initializing<AMPTracker,mpfr_complex>>(*this,start_time, end_time, start_point);
 
 				initial_precision_ = Precision(start_point(0));
 				DefaultPrecision(initial_precision_);
@@ -491,6 +486,19 @@ namespace bertini{
 
 
 
+			/**
+			\brief Move the end time, keeping the highest-precision copy used when precision changes.
+
+			\param end_time The new time to which to track.
+			*/
+			void ResetEndTime(mpfr_complex const& end_time) const override
+			{
+				endtime_highest_precision_ = end_time;
+				endtime_ = endtime_highest_precision_;
+				endtime_.precision(current_precision_);
+			}
+
+
 			void ResetCounters() const override
 			{
 				Tracker::ResetCountersBase();
@@ -514,7 +522,7 @@ namespace bertini{
 					do {
 						if (current_precision_ > Get<PrecConf>().maximum_precision)
 						{
-							NotifyObservers(SingularStartPoint<EmitterType>(*this));
+							Emit<SingularStartPoint<EmitterType>>(*this);
 							return SuccessCode::SingularStartPoint;
 						}
 
@@ -538,7 +546,7 @@ namespace bertini{
 			*/
 			SuccessCode PreIterationCheck() const override
 			{
-				if (num_successful_steps_taken_ >= Get<Stepping>().max_num_steps)
+				if (NumSuccessfulStepsThisSide() >= Get<Stepping>().max_num_steps)
 					return SuccessCode::MaxNumStepsTaken;
 				if (current_stepsize_ < Get<Stepping>().min_step_size)
 					return SuccessCode::MinStepSizeReached;
@@ -558,7 +566,7 @@ namespace bertini{
 			{
 				if (preserve_precision_)
 					ChangePrecision(initial_precision_);
-				NotifyObservers(TrackingEnded<EmitterType>(*this));
+				Emit<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -627,7 +635,7 @@ namespace bertini{
 				assert(PrecisionSanityCheck<ComplexType>() && "precision sanity check failed.  some internal variable is not in correct precision");
 				#endif
 
-				NotifyObservers(NewStep<EmitterType>(*this));
+				Emit<NewStep<EmitterType>>(*this);
 
 				Vec<ComplexType>& predicted_space = std::get<Vec<ComplexType> >(temporary_space_); // this will be populated in the Predict step
 				Vec<ComplexType>& current_space = std::get<Vec<ComplexType> >(current_space_); // the thing we ultimately wish to update
@@ -641,25 +649,28 @@ namespace bertini{
 				SuccessCode predictor_code = Predict<ComplexType, RealType>(predicted_space, current_space, current_time, delta_t);
 				if (predictor_code==SuccessCode::MatrixSolveFailureFirstPartOfPrediction)
 				{
-					NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType>(*this));
+					Emit<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 					InitialMatrixSolveError();
 					return predictor_code;
 				}
 				else if (predictor_code==SuccessCode::MatrixSolveFailure)
 				{
-					NotifyObservers(PredictorMatrixSolveFailure<EmitterType>(*this));
+					Emit<PredictorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();// decrease stepsize, and adjust precision as necessary
 					return predictor_code;
 				}	
 				else if (predictor_code==SuccessCode::HigherPrecisionNecessary)
 				{	
-					NotifyObservers(PredictorHigherPrecisionNecessary<EmitterType>(*this));
+					Emit<PredictorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType>();
 					return predictor_code;
 				}
 
 
-				NotifyObservers(SuccessfulPredict<AMPTracker, ComplexType>(*this, predicted_space));
+				Emit<SuccessfulPredict<AMPTracker, ComplexType>>(*this, predicted_space);
+
+				// the predictor just estimated the norm of the inverse of the Jacobian at the start of the step, in this precision.  the corrector's first iteration is factored near there, so it uses that rather than making another estimate.  later iterations make their own.
+				corrector_->ShareNormJInverse(this->norm_J_inverse_);
 
 				Vec<ComplexType>& tentative_next_space = std::get<Vec<ComplexType> >(tentative_space_); // this will be populated in the Correct step
 
@@ -675,13 +686,13 @@ namespace bertini{
 
 				if (corrector_code==SuccessCode::MatrixSolveFailure || corrector_code==SuccessCode::FailedToConverge)
 				{
-					NotifyObservers(CorrectorMatrixSolveFailure<EmitterType>(*this));
+					Emit<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();
 					return corrector_code;
 				}
 				else if (corrector_code == SuccessCode::HigherPrecisionNecessary)
 				{
-					NotifyObservers(CorrectorHigherPrecisionNecessary<EmitterType>(*this));
+					Emit<CorrectorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType>();
 					return corrector_code;
 				}
@@ -691,7 +702,7 @@ namespace bertini{
 					return corrector_code;
 				}
 
-				NotifyObservers(SuccessfulCorrect<AMPTracker, ComplexType>(*this, tentative_next_space));
+				Emit<SuccessfulCorrect<AMPTracker, ComplexType>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -766,7 +777,8 @@ namespace bertini{
 							max_precision, max_stepsize,
 							DigitsB<ComplexType>(),
 							Get<NewtonConfig>().max_num_newton_iterations,
-							predictor_order_);
+							predictor_order_,
+							Get<PrecConf>().arithmetic_cost);
 
 
 				if ( (next_stepsize_ > current_stepsize_) || (next_precision_ < current_precision_) )
@@ -884,7 +896,8 @@ namespace bertini{
 							Get<PrecConf>().maximum_precision, max_stepsize,
 							digits_B,
 							Get<NewtonConfig>().max_num_newton_iterations,
-							predictor_order_);
+							predictor_order_,
+							Get<PrecConf>().arithmetic_cost);
 				}
 
 				UpdatePrecisionAndStepsize();
@@ -1020,7 +1033,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Tracker::IncrementBaseCountersSuccess();
-				NotifyObservers(SuccessfulStep<EmitterType>(*this));
+				Emit<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -1031,14 +1044,14 @@ namespace bertini{
 				Tracker::IncrementBaseCountersFail();
 				num_successful_steps_since_precision_decrease_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
-				NotifyObservers(FailedStep<EmitterType>(*this));
+				Emit<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				Emit<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 
@@ -1305,7 +1318,7 @@ namespace bertini{
 				if (new_precision==current_precision_) // no op
 					return SuccessCode::Success;
 
-				NotifyObservers(PrecisionChanged<EmitterType>(*this,current_precision_,new_precision));
+				Emit<PrecisionChanged<EmitterType>>(*this,current_precision_,new_precision);
 				
 
 				bool upsampling_needed = new_precision > current_precision_;
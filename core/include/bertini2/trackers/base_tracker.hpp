@@ -34,6 +34,10 @@
 #define BERTINI_BASE_TRACKER_HPP
 
 #include <algorithm>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
 //#include "bertini2/tracking/step.hpp"
 #include "bertini2/trackers/ode_predictors.hpp"
 #include "bertini2/trackers/newton_corrector.hpp"
@@ -218,6 +222,39 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Set whether, and how, to stop tracking paths which are going to infinity before they reach the path truncation threshold.
+
+			A path is judged to be going to infinity once the norm of its dehomogenized point grows like a fixed negative power of the distance to a target time, beyond the end time of the call to TrackPath.  Tracking then stops with SuccessCode::GoingToInfinity.
+
+			\param config When to judge a path divergent.
+			\param target_time The time paths approach, such as the target time of a solve tracking to an endgame boundary short of it.
+			*/
+			void SetDivergenceDetection(DivergenceConfig const& config, CT const& target_time)
+			{
+				divergence_ = config;
+				divergence_target_time_ = target_time;
+			}
+
+			DivergenceConfig const& DivergenceDetection() const
+			{
+				return divergence_;
+			}
+
+			CT const& DivergenceTargetTime() const
+			{
+				return divergence_target_time_;
+			}
+
+			/**
+			\brief The power of 1/|t-t0| at which the norm of the last path tracked was found to be growing, or 0 if it wasn't judged to be going to infinity.
+			*/
+			NumErrorT DivergenceRate() const
+			{
+				return divergence_rate_;
+			}
+
+
 			/**
 			\brief Track a start point through time, from a start time to a target time.
 
@@ -237,7 +274,7 @@ namespace bertini{
 				if (start_point.size()!=GetSystem().NumVariables())
 					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
 
-				
+				ResetDivergence();
 				
 				SuccessCode initialization_code = TrackerLoopInitialization(start_time, endtime, start_point);
 				if (initialization_code!=SuccessCode::Success)
@@ -246,41 +283,84 @@ namespace bertini{
 					return initialization_code;
 				}
 
-				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
-				while (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
-				{	
-					SuccessCode pre_iteration_code = PreIterationCheck();
-					if (pre_iteration_code!=SuccessCode::Success)
-					{
-						PostTrackCleanup();
-						return pre_iteration_code;
-					}
+				SuccessCode tracking_code = TrackToEndTime();
+				if (tracking_code!=SuccessCode::Success)
+				{
+					PostTrackCleanup();
+					return tracking_code;
+				}
 
-					using std::abs;
-					// compute the next delta_t
-					if (abs(endtime_-current_time_) < abs(current_stepsize_))
-						delta_t_ = endtime_-current_time_;
-					else
-						delta_t_ = current_stepsize_ * (endtime_ - current_time_)/abs(endtime_ - current_time_);
+				CopyFinalSolution(solution_at_endtime);
+				PostTrackCleanup();
+				return SuccessCode::Success;
+			}
 
 
-					step_success_code_ = TrackerIteration();
+			/**
+			\brief Track a start point along a contour in time, through a sequence of waypoints, recording the point at each.
 
-					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
-					{	
-						OnInfiniteTruncation();
-						PostTrackCleanup();
-						return SuccessCode::GoingToInfinity;
+			The path in time is the polygon from the start time through the waypoints in order, each side tracked as by TrackPath.  Unlike calling TrackPath once per side, the tracker is initialized once for the whole contour: the stepsize, precision and step counters carry over from one side to the next, so the stepsize adapted on one side isn't thrown away at the start of the next.  This is how the Cauchy endgame goes around its circles.
+
+			As for TrackPath, the maximum number of steps from the stepping settings applies to each side, not to the whole contour, though NumTotalStepsTaken counts the steps on all sides.
+
+			\param[out] samples The space values at the waypoints reached, in order.  All of them, unless tracking fails.  Each is in the precision the tracker was working in on reaching it.
+			\param start_time The time at which to start tracking.
+			\param waypoints The times to track through, in order.  The last is the end of the contour.
+			\param start_point The intial space values for tracking.
+			\param keep_current_stepsize Whether to start with the tracker's current stepsize, say one set by SetStepSize or adapted on a previous contour, rather than the initial stepsize from the stepping settings.
+			\return A success code indicating whether tracking was successful.  Will be SuccessCode::Success if every waypoint was reached.
+			*/
+			SuccessCode TrackContour(std::vector<Vec<CT>> & samples,
+									CT const& start_time, std::vector<CT> const& waypoints,
+									Vec<CT> const& start_point,
+									bool keep_current_stepsize = false
+									) const
+			{
+				if (start_point.size()!=GetSystem().NumVariables())
+					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
+				if (waypoints.empty())
+					throw std::runtime_error("contour to track must have at least one waypoint");
+
+				samples.resize(waypoints.size());
+				ResetDivergence();
+
+				using bertini::Precision;
+				const RT stepsize = current_stepsize_;
+
+				SuccessCode initialization_code = TrackerLoopInitialization(start_time, waypoints.front(), start_point);
+				if (initialization_code!=SuccessCode::Success)
+				{
+					samples.clear();
+					PostTrackCleanup();
+					return initialization_code;
+				}
+
+				if (keep_current_stepsize)
+				{
+					auto precision = Precision(current_stepsize_);
+					current_stepsize_ = stepsize;
+					Precision(current_stepsize_, precision);
+				}
+
+				for (unsigned ii = 0; ii < waypoints.size(); ++ii)
+				{
+					if (ii > 0)
+					{
+						ResetEndTime(waypoints[ii]);
+						num_successful_steps_before_side_ = num_successful_steps_taken_;
 					}
-					else if (step_success_code_==SuccessCode::Success)
-						OnStepSuccess();
-					else
-						OnStepFail();
 
-				}// re: while
+					SuccessCode tracking_code = TrackToEndTime();
+					if (tracking_code!=SuccessCode::Success)
+					{
+						samples.resize(ii);
+						PostTrackCleanup();
+						return tracking_code;
+					}
 
+					CopyFinalSolution(samples[ii]);
+				}
 
-				CopyFinalSolution(solution_at_endtime);
 				PostTrackCleanup();
 				return SuccessCode::Success;
 			}
@@ -405,6 +485,14 @@ namespace bertini{
 			{
 				reinitialize_stepsize_ = should_reinitialize_stepsize;
 			}
+
+			/**
+			\brief Whether the initial step size is reset to that of the stepping settings at the start of each path track.
+			*/
+			bool ReinitializesInitialStepSize() const
+			{
+				return reinitialize_stepsize_;
+			}
 			
 			virtual ~Tracker() = default;
 
@@ -420,6 +508,47 @@ namespace bertini{
 
 		private:
 
+			/**
+			\brief Step from the current time to the end time, as set by initialization or ResetEndTime.
+
+			\return Success if the end time was reached, and the reason for stopping otherwise.  Doesn't clean up after itself.
+			*/
+			SuccessCode TrackToEndTime() const
+			{
+				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
+				while (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
+				{	
+					SuccessCode pre_iteration_code = PreIterationCheck();
+					if (pre_iteration_code!=SuccessCode::Success)
+					{
+						return pre_iteration_code;
+					}
+
+					using std::abs;
+					// compute the next delta_t
+					if (abs(endtime_-current_time_) < abs(current_stepsize_))
+						delta_t_ = endtime_-current_time_;
+					else
+						delta_t_ = current_stepsize_ * (endtime_ - current_time_)/abs(endtime_ - current_time_);
+
+
+					step_success_code_ = TrackerIteration();
+
+					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
+					{	
+						OnInfiniteTruncation();
+						return SuccessCode::GoingToInfinity;
+					}
+					else if (step_success_code_==SuccessCode::Success)
+						OnStepSuccess();
+					else
+						OnStepFail();
+
+				}// re: while
+
+				return SuccessCode::Success;
+			}
+
 			// convert the base tracker into the derived type.
 			const D& AsDerived() const
 			{
@@ -435,6 +564,18 @@ namespace bertini{
 			*/
 			virtual
 			SuccessCode TrackerLoopInitialization(CT const& start_time, CT const& end_time, Vec<CT> const& start_point) const = 0;
+
+
+			/**
+			\brief Move the end time, to keep tracking from where the tracker is, without re-initializing it.
+
+			\param end_time The new time to which to track.
+			*/
+			virtual
+			void ResetEndTime(CT const& end_time) const
+			{
+				endtime_ = end_time;
+			}
 			
 
 			/**
@@ -474,13 +615,75 @@ namespace bertini{
 			template <typename ComplexType>
 			SuccessCode CheckGoingToInfinity() const
 			{
-				if (GetSystem().DehomogenizePoint(std::get<Vec<ComplexType> >(current_space_)).norm() > path_truncation_threshold_)
+				auto norm = GetSystem().DehomogenizePoint(std::get<Vec<ComplexType> >(current_space_)).norm();
+				if (norm > path_truncation_threshold_ || IsDiverging(static_cast<NumErrorT>(norm)))
 					return SuccessCode::GoingToInfinity;
 				else
 					return SuccessCode::Success;
 			}
 
 
+			void ResetDivergence() const
+			{
+				divergence_samples_.clear();
+				divergence_rate_ = 0;
+			}
+
+
+			/**
+			\brief Decide whether the path is going to infinity, from the growth of its norm toward the divergence target time.
+
+			The norm is sampled each time the distance to the target time has halved since the last sample.  Each consecutive pair of the latest samples estimates the power v in \f$|t-t_0|^{-v}\f$ as
+
+			\f[ \frac{\log(n_{k+1}/n_k)}{\log(|t_k-t_0|/|t_{k+1}-t_0|)}, \f]
+
+			and the path is judged divergent once these are all at least the minimum rate, agree to within the tolerance, and the latest norm exceeds the minimum norm.  Sampling at halvings keeps the estimates from being swamped by noise between nearby steps.  Paths to finite points give estimates decaying toward 0.
+
+			\param norm The norm of the dehomogenized current point.
+			*/
+			bool IsDiverging(NumErrorT norm) const
+			{
+				using std::abs;
+				using std::log;
+				using std::max;
+				using std::min;
+
+				if (!divergence_.early_divergence_detection)
+					return false;
+
+				auto distance = static_cast<NumErrorT>(abs(current_time_ - divergence_target_time_));
+				if (!(norm > 0) || !(distance > 0))
+					return false;
+
+				auto log_distance = log(distance);
+				if (!divergence_samples_.empty() && log_distance > divergence_samples_.back().first - log(NumErrorT(2)))
+					return false;
+
+				divergence_samples_.emplace_back(log_distance, log(norm));
+				if (divergence_samples_.size() > max(divergence_.num_samples, 2u))
+					divergence_samples_.pop_front();
+
+				if (divergence_samples_.size() < max(divergence_.num_samples, 2u) || norm < divergence_.divergence_min_norm)
+					return false;
+
+				NumErrorT min_rate = std::numeric_limits<NumErrorT>::infinity(), max_rate = -min_rate;
+				for (unsigned ii = 1; ii < divergence_samples_.size(); ++ii)
+				{
+					auto const& previous = divergence_samples_[ii-1];
+					auto const& latest = divergence_samples_[ii];
+					auto rate = (latest.second - previous.second) / (previous.first - latest.first);
+					min_rate = min(min_rate, rate);
+					max_rate = max(max_rate, rate);
+				}
+
+				if (!(min_rate >= divergence_.min_divergence_rate) || max_rate - min_rate > divergence_.divergence_rate_tolerance * max_rate)
+					return false;
+
+				divergence_rate_ = min_rate;
+				return true;
+			}
+
+
 
 			/**
 			\brief Function to be called before exiting the tracker loop.
@@ -508,6 +711,16 @@ namespace bertini{
 				num_failed_steps_taken_ = 0;
 				num_consecutive_failed_steps_ = 0;
 				num_total_steps_taken_ = 0;
+				num_successful_steps_before_side_ = 0;
+			}
+
+
+			/**
+			\brief The number of successful steps taken since the start of the path, or of the current side of a contour.  This is what the maximum number of steps limits.
+			*/
+			unsigned NumSuccessfulStepsThisSide() const
+			{
+				return num_successful_steps_taken_ - num_successful_steps_before_side_;
 			}
 
 
@@ -559,11 +772,16 @@ namespace bertini{
 			std::reference_wrapper<const System> tracked_system_; ///< Reference to the system being tracked.
 
 			bool infinite_path_truncation_ = true; /// Whether should check if the path is going to infinity while tracking.  On by default.
+			DivergenceConfig divergence_; ///< When to judge a path to be going to infinity before it reaches the truncation threshold.
+			CT divergence_target_time_ = CT(0); ///< The time paths approach, for judging divergence.
+			mutable std::deque<std::pair<NumErrorT,NumErrorT>> divergence_samples_; ///< The logs of the distance to the target time and of the norm, at the latest samples.
+			mutable NumErrorT divergence_rate_ = 0; ///< The power of 1/|t-t0| at which the norm of the path was found to be growing.
 			bool reinitialize_stepsize_ = true; ///< Whether should re-initialize the stepsize with each call to Trackpath.  On by default.
 
 			// tracking the numbers of things
 			mutable unsigned num_total_steps_taken_; ///< The number of steps taken, including failures and successes.
 			mutable unsigned num_successful_steps_taken_;  ///< The number of successful steps taken so far.
+			mutable unsigned num_successful_steps_before_side_; ///< The number of successful steps taken before the current side of a contour, or 0 when tracking a path.
 			mutable unsigned num_consecutive_successful_steps_; ///< The number of CONSECUTIVE successful steps taken in a row.
 			mutable unsigned num_consecutive_failed_steps_; ///< The number of CONSECUTIVE failed steps taken in a row. 
 			mutable unsigned num_failed_steps_taken_; ///< The total number of failed steps taken.
@@ -34,6 +34,7 @@
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/eigen_extensions.hpp"
 #include "bertini2/system/system.hpp"
+#include "bertini2/trackers/amp_cost_model.hpp"
 #include "bertini2/detail/typelist.hpp"
 
 #include "bertini2/common/config.hpp"
@@ -47,8 +48,9 @@ namespace tracking{
 	
 	enum class PrecisionType //E.2.1
 	{
-		Fixed,
-		Adaptive
+		Fixed, ///< double precision, Classic's mptype 0
+		Adaptive, ///< Classic's mptype 2
+		FixedMultiple ///< fixed multiple precision, Classic's mptype 1
 	};
 	
 
@@ -86,9 +88,9 @@ namespace tracking{
 		unsigned consecutive_successful_steps_before_stepsize_increase = 5; ///< What it says.  If you can come up with a better name, please suggest it.  StepsForIncrease
 
 		unsigned min_num_steps = 1; ///< The minimum number of steps allowed during tracking.
-		unsigned max_num_steps = 1e5; ///< The maximum number of steps allowed during tracking.  This is per call to TrackPath.  MaxNumberSteps
+		unsigned max_num_steps = 1e5; ///< The maximum number of steps allowed during tracking.  This is per call to TrackPath, and per side of a contour in TrackContour.  MaxNumberSteps
 
-		unsigned frequency_of_CN_estimation = 1; ///< Estimate the condition number every so many steps.  Eh.
+		unsigned frequency_of_CN_estimation = 4; ///< Estimate the norm of the inverse of the Jacobian, and so the condition number, every so many steps, reusing the latest estimate in between.  Each estimate costs at least three linear solves, more than the step itself.
 	};
 
 
@@ -97,6 +99,23 @@ namespace tracking{
 	{
 		unsigned max_num_newton_iterations = 2; //MaxNewtonIts
 		unsigned min_num_newton_iterations = 1;
+		bool mixed_precision_refinement = false; ///< In multiple precision, factor the Jacobian in double and recover the working precision by iterative refinement, factoring in full precision only if refinement stalls.
+		unsigned max_refinement_iterations = 20; ///< The most refinements of one Newton step before giving up on the double factorization.
+	};
+
+
+	/**
+	\brief When to stop tracking a path early, as going to infinity, from the growth of its norm as time nears a target time.
+
+	The norm is sampled each time the distance to the target time halves.  The rule is that of the endgames, see endgame::SecurityConfig, which ZeroDim copies these settings from.
+	*/
+	struct DivergenceConfig
+	{
+		bool early_divergence_detection = false; ///< Whether to check at all.  The tracker must also be told the target time.
+		unsigned num_samples = 3; ///< How many of the latest samples the growth rate is estimated from.
+		NumErrorT min_divergence_rate = NumErrorT(1)/NumErrorT(10); ///< The smallest power of 1/|t-t0| at which the norm must be growing.
+		NumErrorT divergence_rate_tolerance = NumErrorT(1)/NumErrorT(10); ///< How much estimates of that power from consecutive samples may differ, relative to the largest.
+		NumErrorT divergence_min_norm = NumErrorT(100); ///< The norm the latest sample must exceed.
 	};
 
 
@@ -173,6 +192,8 @@ namespace tracking{
 		unsigned consecutive_successful_steps_before_precision_decrease = 10;
 
 		unsigned max_num_precision_decreases = 10; ///< The maximum number of times precision can be lowered during tracking of a segment of path.
+
+		ArithmeticCostModel arithmetic_cost; ///< The relative cost of a step at each precision, used to choose precision and stepsize.  Uncalibrated, this is ArithmeticCost().  See CalibrateArithmeticCost.
 		
 
 		/**
@@ -75,6 +75,8 @@ namespace bertini {
 	class SuccessfulPredict : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = TrackingEvent<ObservedT>;
+
 		/**
 		\brief The constructor for a SuccessfulPredict Event.
 
@@ -105,6 +107,8 @@ namespace bertini {
 	class SuccessfulCorrect : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = TrackingEvent<ObservedT>;
+
 		/**
 		\brief The constructor for a SuccessfulCorrect Event.
 
@@ -141,6 +145,8 @@ namespace bertini {
 	class PrecisionChanged : public PrecisionEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = PrecisionEvent<ObservedT>;
+
 		/**
 		\brief The constructor for a PrecisionChanged Event.
 
@@ -178,6 +184,8 @@ namespace bertini {
 	class PrecisionIncreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = PrecisionChanged<ObservedT>;
+
 		/**
 		\brief The constructor for a PrecisionIncreased Event.
 
@@ -199,6 +207,8 @@ namespace bertini {
 	class PrecisionDecreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = PrecisionChanged<ObservedT>;
+
 		/**
 		\brief The constructor for a PrecisionDecreased Event.
 
@@ -297,6 +307,8 @@ namespace bertini {
 	class Initializing : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using ParentEvent = TrackingEvent<ObservedT>;
+
 
 		/**
 		\brief Constructor for an Initializing Event
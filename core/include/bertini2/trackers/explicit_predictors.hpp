@@ -40,7 +40,10 @@
 
 #include <boost/type_index.hpp>
 
+#include <optional>
+
 #include "bertini2/eigen_extensions.hpp"
+#include "bertini2/mpfr_lu.hpp"
 
 namespace bertini{
 	namespace tracking{
@@ -159,7 +162,7 @@ namespace bertini{
 				struct LUSelector<dbl>
 				{
 					template<typename N>
-					static Eigen::PartialPivLU<Mat<dbl>>& Run(N & n)
+					static PivotedLU<dbl>& Run(N & n)
 					{
 						return n.GetLU_d();
 					}
@@ -169,7 +172,7 @@ namespace bertini{
 				struct LUSelector<mpfr_complex>
 				{
 					template<typename N>
-					static Eigen::PartialPivLU<Mat<mpfr_complex>>& Run(N & n)
+					static PivotedLU<mpfr_complex>& Run(N & n)
 					{
 						return n.GetLU_mp();
 					}
@@ -359,12 +362,6 @@ namespace bertini{
 					numTotalFunctions_ = S.NumTotalFunctions();
 					numVariables_ = S.NumVariables();
 					// you cannot set K_ here, because s_ may not have been set
-					std::get< Mat<dbl> >(dh_dx_0_).resize(numTotalFunctions_, numVariables_);
-					std::get< Mat<mpfr_complex> >(dh_dx_0_).resize(numTotalFunctions_, numVariables_);
-					std::get< Mat<dbl> >(dh_dx_temp_).resize(numTotalFunctions_, numVariables_);
-					std::get< Mat<mpfr_complex> >(dh_dx_temp_).resize(numTotalFunctions_, numVariables_);
-					std::get< Vec<dbl> >(dh_dt_temp_).resize(numTotalFunctions_);
-					std::get< Vec<mpfr_complex> >(dh_dt_temp_).resize(numTotalFunctions_);
 
 					ResizeK();
 				}
@@ -395,10 +392,6 @@ namespace bertini{
 				{
 					Precision(std::get< Mat<mpfr_complex> >(K_),new_precision);
 
-					Precision(std::get< Vec<mpfr_complex> >(dh_dt_temp_),new_precision);
-					Precision(std::get< Mat<mpfr_complex> >(dh_dx_0_),new_precision);
-					Precision(std::get< Mat<mpfr_complex> >(dh_dx_temp_),new_precision);
-
 					Precision(std::get< Mat<mpfr_float> >(a_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_minus_bstar_),new_precision);
@@ -415,10 +408,6 @@ namespace bertini{
 				{
 					assert(current_precision_==DefaultPrecision());
 
-					Vec<mpfr_complex>& dhdttemp = std::get< Vec<mpfr_complex> >(dh_dt_temp_);
-					Mat<mpfr_complex>& dhdx0 = std::get< Mat<mpfr_complex> >(dh_dx_0_); 
-					Mat<mpfr_complex>& dhdxtemp = std::get< Mat<mpfr_complex> >(dh_dx_temp_); 
-
 					Mat<mpfr_float>& a = std::get< Mat<mpfr_float> >(a_); 
 					Vec<mpfr_float>& b = std::get< Vec<mpfr_float> >(b_); 
 					Vec<mpfr_float>& bstar = std::get< Vec<mpfr_float> >(b_minus_bstar_); 
@@ -426,10 +415,6 @@ namespace bertini{
 
 
 
-					assert(Precision(dhdttemp)==current_precision_);
-					assert(Precision(dhdx0)==current_precision_);
-					assert(Precision(dhdxtemp)==current_precision_);
-
 					assert(Precision(a)==current_precision_);
 					assert(Precision(b)==current_precision_);
 					if (uses_embedded_)
@@ -515,9 +500,7 @@ namespace bertini{
 				{
 
 					
-					auto success_code = Predict<ComplexType>(next_space, S, current_space, current_time, delta_t,
-										   condition_number_estimate, num_steps_since_last_condition_number_computation,
-										   frequency_of_CN_estimation, tracking_tolerance);
+					auto success_code = FullStep(next_space, S, current_space, current_time, delta_t);
 
 					SetNormsCond<ComplexType>(norm_J, norm_J_inverse, condition_number_estimate, num_steps_since_last_condition_number_computation, frequency_of_CN_estimation);
 					
@@ -652,23 +635,38 @@ namespace bertini{
 				////////////////////
 				
 				template <typename T>
-				Eigen::PartialPivLU<Mat<T>>& GetLU()
+				PivotedLU<T>& GetLU()
 				{
 					return LUSelector<T>::Run(*this);
 				}
 
 
-				Eigen::PartialPivLU<Mat<dbl>>& GetLU_d()
+				PivotedLU<dbl>& GetLU_d()
 				{
 					return LU_d_;
 				}
 
-				Eigen::PartialPivLU<Mat<mpfr_complex>>& GetLU_mp()
+				PivotedLU<mpfr_complex>& GetLU_mp()
 				{
 					assert(current_precision_==DefaultPrecision());
 					return LU_mp_[current_precision_];
 				}
 
+				/**
+				 \brief The latest estimate of the norm of the inverse of the Jacobian in a precision, if there is one yet.  Like the LU factorizations, these are kept per precision, so an estimate made in one is never passed off as one in another.
+				 */
+				template <typename T>
+				std::optional<NumErrorT>& LatestNormJInverse()
+				{
+					if constexpr (std::is_same<T,dbl>::value)
+						return norm_J_inverse_d_;
+					else
+					{
+						assert(current_precision_==DefaultPrecision());
+						return norm_J_inverse_mp_[current_precision_];
+					}
+				}
+
 				/**
 				 \brief Performs a full prediction step from current_time to current_time + delta_t
 				 
@@ -731,27 +729,27 @@ namespace bertini{
 				};
 
 				
+				/**
+				 \brief Set the norm of the Jacobian at the start of the step, and estimates of the norm of its inverse and its condition number.
+
+				 Both norms are 1-norms.  The norm of the inverse is estimated by Hager's method from the LU factorization of the first stage, every frequency_of_CN_estimation steps.  In between, the previous estimate in the same precision is reused, so most steps do no extra solves.
+				 */
 				template<typename ComplexType>
-				void SetNormsCond(NumErrorT & norm_J, NumErrorT & norm_J_inverse, NumErrorT & condition_number_estimate, unsigned num_steps_since_last_condition_number_computation, unsigned frequency_of_CN_estimation)
+				void SetNormsCond(NumErrorT & norm_J, NumErrorT & norm_J_inverse, NumErrorT & condition_number_estimate, unsigned & num_steps_since_last_condition_number_computation, unsigned frequency_of_CN_estimation)
 				{
-					// Calculate condition number and update if needed
-					Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
-					Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
+					norm_J = norm_J_0_;
 
-					// TODO this random vector should not be made fresh every time.  especiallyif the numeric type is mpfr_complex!
-					Vec<ComplexType> randy = RandomOfUnits<ComplexType>(numVariables_);
-					Vec<ComplexType> temp_soln = LUref.solve(randy);
-					
-					norm_J = NumErrorT(dhdxref.norm());
-					norm_J_inverse = NumErrorT(temp_soln.norm());
-					
-					if (num_steps_since_last_condition_number_computation >= frequency_of_CN_estimation)
+					auto& latest_norm_J_inverse = LatestNormJInverse<ComplexType>();
+					if (num_steps_since_last_condition_number_computation >= frequency_of_CN_estimation || !latest_norm_J_inverse)
 					{
-						condition_number_estimate = NumErrorT(norm_J * norm_J_inverse);
+						latest_norm_J_inverse = NumErrorT(InverseOneNormEstimate(GetLU<ComplexType>()));
 						num_steps_since_last_condition_number_computation = 1; // reset the counter to 1
 					}
 					else // no need to compute the condition number
 						num_steps_since_last_condition_number_computation++;
+
+					norm_J_inverse = *latest_norm_J_inverse;
+					condition_number_estimate = NumErrorT(norm_J * norm_J_inverse);
 				}
 				
 				
@@ -850,8 +848,7 @@ namespace bertini{
 
 					if(stage == 0)
 					{
-						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
-						Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
+						PivotedLU<ComplexType>& LUref = GetLU<ComplexType>();
 
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
@@ -859,24 +856,24 @@ namespace bertini{
 
 							assert(Precision(space)==current_precision_);
 							assert(Precision(time)==current_precision_);
-							assert(Precision(dhdxref)==current_precision_);
 							assert(Precision(K)==current_precision_);
 						}
 						S.SetAndReset<ComplexType>(space, time);
-						S.JacobianInPlace(dhdxref);
-						LUref = dhdxref.lu();
+
+						// factor straight from the system's evaluated Jacobian.  its norm is kept for AMP testing, as the view doesn't outlive the later stages.
+						auto dhdx = S.JacobianView<ComplexType>();
+						LUref.compute(dhdx);
+						norm_J_0_ = NumErrorT(OneNorm(dhdx));
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
-							assert(Precision(dhdxref)==current_precision_);
+							assert(Precision(dhdx)==current_precision_);
 							assert(Precision(LUref.matrixLU())==current_precision_);
 						}
 
 						if (LUPartialPivotDecompositionSuccessful(LUref.matrixLU())!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LUref.solve(-dhdtref);
+						K.col(stage) = LUref.solve(-S.TimeDerivativeView<ComplexType>());
 						
 						return SuccessCode::Success;
 						
@@ -885,16 +882,12 @@ namespace bertini{
 					{
 						S.SetAndReset<ComplexType>(space, time);
 
-						Mat<ComplexType>& dhdxtempref = std::get< Mat<ComplexType> >(dh_dx_temp_);
-						S.JacobianInPlace(dhdxtempref);
-						auto LU = dhdxtempref.lu();
+						PivotedLU<ComplexType> LU(S.JacobianView<ComplexType>());
 						
 						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailure;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LU.solve(-dhdtref);
+						K.col(stage) = LU.solve(-S.TimeDerivativeView<ComplexType>());
 						
 						return SuccessCode::Success;
 					}
@@ -1029,13 +1022,13 @@ namespace bertini{
 				mutable std::tuple< Mat<dbl>, Mat<mpfr_complex> > K_;  // All the stage variables.  Each column represents a different stage.
 				Predictor predictor_;  // Method for prediction
 				unsigned p_;  //Order of the prediction method
-				mutable std::tuple< Mat<dbl>, Mat<mpfr_complex> > dh_dx_0_;  // Jacobian for the initial stage.  Use for AMP testing
-				mutable std::tuple< Mat<dbl>, Mat<mpfr_complex> > dh_dx_temp_;  // Temporary jacobian for all other stages
-				mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > dh_dt_temp_;  // Temporary time derivative used for all stages
+				mutable NumErrorT norm_J_0_ = 0;  // 1-norm of the Jacobian for the initial stage.  Use for AMP testing
+				mutable std::optional<NumErrorT> norm_J_inverse_d_;  // The latest estimate of the 1-norm of the inverse of the Jacobian in double precision, kept between estimates
+				mutable std::map<unsigned,std::optional<NumErrorT>> norm_J_inverse_mp_;  // The same, for each multiple precision
 				// std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr_complex>> > LU_0_;  // LU from the intial stage used for AMP testing
 
-				mutable Eigen::PartialPivLU<Mat<dbl>> LU_d_;
-				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr_complex>>> LU_mp_;
+				mutable PivotedLU<dbl> LU_d_;
+				mutable std::map<unsigned,PivotedLU<mpfr_complex>> LU_mp_;
 				
 				
 				// Butcher Table (notation from https://en.wikipedia.org/wiki/List_of_Runge%E2%80%93Kutta_methods )
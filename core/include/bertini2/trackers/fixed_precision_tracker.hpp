@@ -109,7 +109,7 @@ namespace bertini{
 			*/
 			SuccessCode PreIterationCheck() const override
 			{
-				if (this->num_successful_steps_taken_ >= Get<Stepping>().max_num_steps)
+				if (this->NumSuccessfulStepsThisSide() >= Get<Stepping>().max_num_steps)
 					return SuccessCode::MaxNumStepsTaken;
 				if (this->current_stepsize_ < Get<Stepping>().min_step_size)
 					return SuccessCode::MinStepSizeReached;
@@ -128,7 +128,7 @@ namespace bertini{
 
 			void PostTrackCleanup() const override
 			{
-				this->NotifyObservers(TrackingEnded<EmitterType>(*this));
+				this->template Emit<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -168,7 +168,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
-				this->NotifyObservers(NewStep<EmitterType >(*this));
+				this->template Emit<NewStep<EmitterType >>(*this);
 
 				Vec<CT>& predicted_space = std::get<Vec<CT> >(this->temporary_space_); // this will be populated in the Predict step
 				Vec<CT>& current_space = std::get<Vec<CT> >(this->current_space_); // the thing we ultimately wish to update
@@ -179,7 +179,7 @@ namespace bertini{
 
 				if (predictor_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType >(*this));
+					this->template Emit<FirstStepPredictorMatrixSolveFailure<EmitterType >>(*this);
 
 					this->next_stepsize_ = RT(Get<Stepping>().step_size_fail_factor)*this->current_stepsize_;
 
@@ -188,7 +188,7 @@ namespace bertini{
 					return predictor_code;
 				}
 
-				this->NotifyObservers(SuccessfulPredict<EmitterType , CT>(*this, predicted_space));
+				this->template Emit<SuccessfulPredict<EmitterType , CT>>(*this, predicted_space);
 
 				Vec<CT>& tentative_next_space = std::get<Vec<CT> >(this->tentative_space_); // this will be populated in the Correct step
 
@@ -205,7 +205,7 @@ namespace bertini{
 				}
 				else if (corrector_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(CorrectorMatrixSolveFailure<EmitterType >(*this));
+					this->template Emit<CorrectorMatrixSolveFailure<EmitterType >>(*this);
 
 					this->next_stepsize_ = RT(Get<Stepping>().step_size_fail_factor)*this->current_stepsize_;
 					UpdateStepsize();
@@ -214,7 +214,7 @@ namespace bertini{
 				}
 
 				
-				this->NotifyObservers(SuccessfulCorrect<EmitterType , CT>(*this, tentative_next_space));
+				this->template Emit<SuccessfulCorrect<EmitterType , CT>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -259,7 +259,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Base::IncrementBaseCountersSuccess();
-				this->NotifyObservers(SuccessfulStep<EmitterType >(*this));
+				this->template Emit<SuccessfulStep<EmitterType >>(*this);
 			}
 
 			/**
@@ -269,14 +269,14 @@ namespace bertini{
 			{
 				Base::IncrementBaseCountersFail();
 				this->num_successful_steps_since_stepsize_increase_ = 0;
-				this->NotifyObservers(FailedStep<EmitterType >(*this));
+				this->template Emit<FailedStep<EmitterType >>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				this->NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				this->template Emit<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 			//////////////
@@ -452,7 +452,7 @@ namespace bertini{
 			                               BaseComplexType const& end_time,
 										   Vec<BaseComplexType> const& start_point) const override
 			{
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template Emit<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -537,7 +537,7 @@ namespace bertini{
 				}
 
 
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template Emit<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
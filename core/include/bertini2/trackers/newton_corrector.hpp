@@ -9,6 +9,12 @@
 #ifndef BERTINI_NEWTON_CORRECTOR_HPP
 #define BERTINI_NEWTON_CORRECTOR_HPP
 
+#include <cmath>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "bertini2/mpfr_lu.hpp"
 #include "bertini2/trackers/amp_criteria.hpp"
 #include "bertini2/trackers/config.hpp"
 #include "bertini2/system/system.hpp"
@@ -81,11 +87,9 @@ namespace bertini{
 				 */
 				void ChangePrecision(unsigned new_precision)
 				{
-					Precision(std::get< Vec<mpfr_complex> >(f_temp_), new_precision);
 					Precision(std::get< Vec<mpfr_complex> >(step_temp_), new_precision);
-					Precision(std::get< Mat<mpfr_complex> >(J_temp_), new_precision);
 
-					std::get< Eigen::PartialPivLU<Mat<mpfr_complex>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr_complex>>(numTotalFunctions_);
+					std::get< PivotedLU<mpfr_complex> >(LU_) = PivotedLU<mpfr_complex>(numTotalFunctions_);
 
 					current_precision_ = new_precision;				
 				}
@@ -95,6 +99,34 @@ namespace bertini{
 				{
 					return current_precision_;
 				}
+
+
+				/**
+				 \brief Use an estimate of the norm of the inverse of the Jacobian, say the predictor's, for the AMP criteria in the next call to Correct, instead of estimating it from the corrector's own factorization.
+
+				 The estimate is used for that one call only.  Without one, Correct estimates once, at its first iteration, and reuses that for its later ones.
+				 */
+				void ShareNormJInverse(NumErrorT norm_J_inverse)
+				{
+					shared_norm_J_inverse_ = norm_J_inverse;
+				}
+
+
+				/**
+				 \brief The number of multiple precision Newton steps for which mixed precision refinement failed, so that the Jacobian was factored in full precision.
+				 */
+				unsigned NumRefinementFallbacks() const
+				{
+					return num_refinement_fallbacks_;
+				}
+
+				/**
+				 \brief The number of refinements, each a residual in the working precision and a solve with the double factorization, over all multiple precision Newton steps so far.
+				 */
+				unsigned NumRefinements() const
+				{
+					return num_refinements_;
+				}
 				
 				/**
 				 \brief Change the system(number of total functions) that the predictor uses.
@@ -106,10 +138,6 @@ namespace bertini{
 				{
 					numTotalFunctions_ = S.NumTotalFunctions();
 					numVariables_ = S.NumVariables();
-					std::get< Mat<dbl> >(J_temp_).resize(numTotalFunctions_, numVariables_);
-					std::get< Mat<mpfr_complex> >(J_temp_).resize(numTotalFunctions_, numVariables_);
-					std::get< Vec<dbl> >(f_temp_).resize(numTotalFunctions_);
-					std::get< Vec<mpfr_complex> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr_complex> >(step_temp_).resize(numTotalFunctions_);
 				}
@@ -156,7 +184,7 @@ namespace bertini{
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, tracking_tolerance);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
@@ -209,26 +237,27 @@ namespace bertini{
 					#endif
 
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
+					auto norm_J_inverse_estimate = std::exchange(shared_norm_J_inverse_, std::nullopt);
 					
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, tracking_tolerance);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
 						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
 						if ( (step_ref.template lpNorm<Eigen::Infinity>() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
 						
-						NumErrorT norm_J_inverse(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						// the iterates stay close to the point the Jacobian was first factored at, so one estimate serves them all
+						if (!norm_J_inverse_estimate)
+							norm_J_inverse_estimate = NormJInverseEstimate<ComplexType>();
+						const NumErrorT& norm_J_inverse = *norm_J_inverse_estimate;
 
-						if (!amp::CriterionB<ComplexType>(NumErrorT(J_temp_ref.norm()), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, NumErrorT(step_ref.template lpNorm<Eigen::Infinity>()), AMP_config))
+						if (!amp::CriterionB<ComplexType>(norm_J_, norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, NumErrorT(step_ref.template lpNorm<Eigen::Infinity>()), AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
 						
 						if (!amp::CriterionC<ComplexType>(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
@@ -284,24 +313,23 @@ namespace bertini{
 					#endif
 					
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
+					auto norm_J_inverse_estimate = std::exchange(shared_norm_J_inverse_, std::nullopt);
 					
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, tracking_tolerance);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
 						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
-						
 						norm_delta_z = NumErrorT(step_ref.template lpNorm<Eigen::Infinity>());
-						norm_J = NumErrorT(J_temp_ref.norm());
-						norm_J_inverse = NumErrorT(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						norm_J = norm_J_;
+						if (!norm_J_inverse_estimate)
+							norm_J_inverse_estimate = NormJInverseEstimate<ComplexType>();
+						norm_J_inverse = *norm_J_inverse_estimate;
 						condition_number_estimate = NumErrorT(norm_J*norm_J_inverse);
 												
 						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
@@ -334,32 +362,173 @@ namespace bertini{
 				 \param S The system used in the computations
 				 \param current_space The space from the previous Newton iteration
 				 \param current_time The time from the previous Newton iteration
+				 \param tracking_tolerance The tolerance the Newton iterates are converging to, which bounds how accurately a refined step need be computed.
 				 
 				 */
 				
 				template<typename ComplexType, typename Derived>
 				SuccessCode EvalIterationStep(Vec<ComplexType> & newton_step,
 											  const System& S,
-											  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time)
+											  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time,
+											  NumErrorT const& tracking_tolerance)
 				{
-					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
-					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-					
-					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+					PivotedLU<ComplexType>& LU_ref = std::get< PivotedLU<ComplexType> >(LU_);
 
 					S.SetAndReset<ComplexType>(current_space, current_time);
-					S.EvalInPlace(f_temp_ref);
-					S.JacobianInPlace(J_temp_ref);
-					LU_ref = J_temp_ref.lu();
+
+					auto f = S.FunctionValuesView<ComplexType>();
+
+					// viewed once, since for systems not wholly in an SLP, each view evaluates the Jacobian again
+					auto J = S.JacobianView<ComplexType>();
+					norm_J_ = NumErrorT(OneNorm(J));
+
+					if constexpr (std::is_same<ComplexType, mpfr_complex>::value)
+					{
+						if (newton_config_.mixed_precision_refinement)
+						{
+							solved_by_refinement_ = RefinedSolve(newton_step, J, f, tracking_tolerance);
+							if (solved_by_refinement_)
+								return SuccessCode::Success;
+							++num_refinement_fallbacks_;
+						}
+					}
+					solved_by_refinement_ = false;
+
+					// factor straight from the system's evaluated Jacobian, rather than copying it out first
+					LU_ref.compute(J);
 					
 					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
 						return SuccessCode::MatrixSolveFailure;
 					
-					newton_step = LU_ref.solve(-f_temp_ref);
+					newton_step = LU_ref.solve(-f);
 					
 					return SuccessCode::Success;
 					
 				}
+
+
+
+				/**
+				 \brief Solve for the Newton step in multiple precision, using a factorization of the Jacobian in double precision.
+
+				 The Jacobian is rounded to double and factored once.  The step is then improved by iterative refinement: the residual of the linear system is computed in the working precision, and the correction solved for with the double factorization.  Each refinement gains roughly \f$16 - \log_{10} \kappa(J)\f$ digits, so as long as the Jacobian is not too ill-conditioned for doubles, a few O(n^2) residuals in multiple precision replace the O(n^3) multiple precision factorization.
+
+				 The residual is scaled by its norm before rounding, so that it stays within the range of double even when it is far smaller than the smallest double.
+
+				 Refinement stops once the step is known to a hundredth of the tracking tolerance, or to the working precision if that is coarser.  The iterate is accepted once its step is below the tolerance, so digits beyond that are never used, and a loose tolerance in high precision takes only a refinement or two.
+
+				 \return Whether refinement converged.  False if the rounded Jacobian is singular or out of range for doubles, or refinement stalled, in which case the caller should factor in full precision.
+
+				 \param[out] newton_step The computed step for Newton's method.
+				 \param J The Jacobian, in the working precision.
+				 \param f The function values, in the working precision.
+				 \param tracking_tolerance The tolerance the Newton iterates are converging to.
+				 */
+				template<typename DerivedJ, typename DerivedF>
+				bool RefinedSolve(Vec<mpfr_complex> & newton_step,
+				                  Eigen::MatrixBase<DerivedJ> const& J,
+				                  Eigen::MatrixBase<DerivedF> const& f,
+				                  NumErrorT const& tracking_tolerance)
+				{
+					using std::abs;
+					auto& LU_ref = std::get< Eigen::PartialPivLU<Mat<dbl>> >(LU_);
+
+					if (!RoundToDouble(jacobian_dbl_, J))
+						return false;
+
+					LU_ref.compute(jacobian_dbl_);
+					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
+						return false;
+
+					const auto relative_tolerance = Eigen::NumTraits<mpfr_real>::dummy_precision();
+					const mpfr_real absolute_tolerance(tracking_tolerance/100);
+
+					newton_step = Vec<mpfr_complex>::Zero(J.cols());
+					residual_ = -f;
+
+					mpfr_real previous_correction_norm(-1);
+					for (unsigned ii = 0; ii <= newton_config_.max_refinement_iterations; ++ii)
+					{
+						if (ii > 0)
+							residual_ = -f - J*newton_step;
+
+						mpfr_real scale = residual_.template lpNorm<Eigen::Infinity>();
+						if (scale==0)
+							return true;
+
+						residual_ *= mpfr_complex(1/scale);
+						if (!RoundToDouble(residual_dbl_, residual_))
+							return false;
+
+						correction_dbl_ = LU_ref.solve(residual_dbl_);
+						++num_refinements_;
+						for (unsigned jj = 0; jj < correction_dbl_.size(); ++jj)
+							newton_step(jj) += mpfr_complex(correction_dbl_(jj).real(), correction_dbl_(jj).imag()) * scale;
+
+						mpfr_real correction_norm = scale * correction_dbl_.template lpNorm<Eigen::Infinity>();
+						if (correction_norm <= absolute_tolerance || correction_norm <= relative_tolerance * newton_step.template lpNorm<Eigen::Infinity>())
+							return true;
+
+						if (previous_correction_norm >= 0 && correction_norm > previous_correction_norm/2)
+							return false; // not contracting, so the Jacobian is too ill-conditioned for doubles
+
+						previous_correction_norm = correction_norm;
+					}
+
+					return false;
+				}
+
+
+
+				/**
+				 \brief Round a multiple precision matrix to double.
+
+				 \return Whether every entry is finite in double.
+				 */
+				template<typename Derived>
+				static
+				bool RoundToDouble(Mat<dbl> & result, Eigen::MatrixBase<Derived> const& M)
+				{
+					using std::isfinite;
+					result.resize(M.rows(), M.cols());
+					for (unsigned ii = 0; ii < M.rows(); ++ii)
+						for (unsigned jj = 0; jj < M.cols(); ++jj)
+						{
+							result(ii,jj) = static_cast<dbl>(M(ii,jj));
+							if (!isfinite(result(ii,jj).real()) || !isfinite(result(ii,jj).imag()))
+								return false;
+						}
+					return true;
+				}
+
+				template<typename Derived>
+				static
+				bool RoundToDouble(Vec<dbl> & result, Eigen::MatrixBase<Derived> const& v)
+				{
+					using std::isfinite;
+					result.resize(v.size());
+					for (unsigned ii = 0; ii < v.size(); ++ii)
+					{
+						result(ii) = static_cast<dbl>(v(ii));
+						if (!isfinite(result(ii).real()) || !isfinite(result(ii).imag()))
+							return false;
+					}
+					return true;
+				}
+
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the Jacobian by Hager's method, from whichever factorization produced the latest Newton step.
+				 */
+				template<typename ComplexType>
+				NumErrorT NormJInverseEstimate() const
+				{
+					if (std::is_same<ComplexType, mpfr_complex>::value && solved_by_refinement_)
+						return NumErrorT(InverseOneNormEstimate(std::get< PivotedLU<dbl> >(LU_)));
+
+					return NumErrorT(InverseOneNormEstimate(std::get< PivotedLU<ComplexType> >(LU_)));
+				}
 				
 
 				
@@ -372,11 +541,18 @@ namespace bertini{
 				unsigned numTotalFunctions_; // Number of total functions for the current system
 				unsigned numVariables_;  // Number of variables for the current system
 				
-				std::tuple< Vec<dbl>, Vec<mpfr_complex> > f_temp_; // Variable to hold temporary evaluation of the system
 				std::tuple< Vec<dbl>, Vec<mpfr_complex> > step_temp_; // Variable to hold temporary evaluation of the newton step
-				std::tuple< Mat<dbl>, Mat<mpfr_complex> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
 				
-				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr_complex>> > LU_; // The LU factorization from the Newton iterates
+				std::tuple< PivotedLU<dbl>, PivotedLU<mpfr_complex> > LU_; // The LU factorization from the Newton iterates
+
+				NumErrorT norm_J_ = 0; // the 1-norm of the Jacobian at the latest Newton iterate, computed as it was factored
+				std::optional<NumErrorT> shared_norm_J_inverse_; // an estimate of the norm of the inverse of the Jacobian to use for the next correction, instead of making one
+				bool solved_by_refinement_ = false; // whether the latest multiple precision step came from the double factorization in LU_
+				unsigned num_refinement_fallbacks_ = 0; // how many times refinement failed, and the Jacobian was factored in full precision
+				unsigned num_refinements_ = 0; // how many refinements have been made, over all Newton steps
+				Mat<dbl> jacobian_dbl_; // the Jacobian, rounded to double for refinement
+				Vec<dbl> residual_dbl_, correction_dbl_; // scaled residual and its correction, in double
+				Vec<mpfr_complex> residual_; // residual of the linear system, in the working precision
 				
 				unsigned current_precision_;
 
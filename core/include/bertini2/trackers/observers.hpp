@@ -50,6 +50,14 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+		public:
+
+			FirstPrecisionRecorder()
+			{
+				this->template SubscribeTo<TrackingStarted<EmitterT>>();
+				this->template SubscribeTo<PrecisionChanged<EmitterT>>();
+			}
+
 			virtual void Observe(AnyEvent const& e) override
 			{
 				if(auto p = dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
@@ -114,6 +122,14 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+		public:
+
+			MinMaxPrecisionRecorder()
+			{
+				this->template SubscribeTo<PrecisionChanged<EmitterT>>();
+				this->template SubscribeTo<TrackingStarted<EmitterT>>();
+			}
+
 			virtual void Observe(AnyEvent const& e) override
 			{
 				if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
@@ -199,6 +215,13 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+		public:
+
+			AMPPathAccumulator()
+			{
+				this->template SubscribeTo<EventT<EmitterT>>();
+			}
+
 			virtual void Observe(AnyEvent const& e) override
 			{
 				const EventT<EmitterT>* p = dynamic_cast<const EventT<EmitterT>*>(&e);
@@ -345,6 +368,11 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+			StepFailScreenPrinter()
+			{
+				this->template SubscribeTo<FailedStep<EmitterT>>();
+			}
+
 			virtual void Observe(AnyEvent const& e) override
 			{
 				if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
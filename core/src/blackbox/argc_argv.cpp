@@ -26,11 +26,78 @@
 \brief Provides the methods for parsing the command-line arguments.
 */
 
+#include "bertini2/blackbox/argc_argv.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
 namespace bertini{
 
-void ParseArgcArgv(int argc, char** argv){
+namespace blackbox{
+
+std::string Usage()
+{
+	return
+		"usage: bertini2 [options] [input_file]\n"
+		"\n"
+		"Solves the system in a Bertini Classic input file, named 'input' if not given.\n"
+		"\n"
+		"options:\n"
+		"  -t, --threads N   track paths with N threads.  0, the default, uses as many as the hardware supports.\n"
+		"  -o, --output DIR  write main_data and raw_data into DIR, rather than the current directory.\n"
+		"  -c, --cache DIR   cache parsed and set up systems in DIR, rather than .bertini_cache, so later runs on the same input start faster.\n"
+		"      --no-cache    don't cache systems.\n"
+		"  -h, --help        print this message.\n";
+}
+
+} // namespace blackbox
+
 
+blackbox::ProgramOptions ParseArgcArgv(int argc, char** argv)
+{
+	blackbox::ProgramOptions options;
+
+	bool have_input_file = false;
+	for (int ii = 1; ii < argc; ++ii)
+	{
+		std::string arg(argv[ii]);
+
+		auto value = [&]()
+		{
+			if (ii+1 >= argc)
+				throw std::runtime_error("option '" + arg + "' requires a value");
+			return std::string(argv[++ii]);
+		};
+
+		if (arg=="-h" || arg=="--help")
+			options.print_help = true;
+		else if (arg=="-t" || arg=="--threads")
+		{
+			auto n = value();
+			std::stringstream converter(n);
+			long long num_threads;
+			if (!(converter >> num_threads) || !converter.eof() || num_threads < 0)
+				throw std::runtime_error("the number of threads must be a non-negative integer, not '" + n + "'");
+			options.num_threads = static_cast<unsigned>(num_threads);
+		}
+		else if (arg=="-o" || arg=="--output")
+			options.output_directory = value();
+		else if (arg=="-c" || arg=="--cache")
+			options.cache_directory = value();
+		else if (arg=="--no-cache")
+			options.cache_directory.clear();
+		else if (!arg.empty() && arg[0]=='-')
+			throw std::runtime_error("unknown option '" + arg + "'\n\n" + blackbox::Usage());
+		else if (!have_input_file)
+		{
+			options.input_file = arg;
+			have_input_file = true;
+		}
+		else
+			throw std::runtime_error("more than one input file given, '" + options.input_file.string() + "' and '" + arg + "'");
+	}
+
+	return options;
 } 
 
 }
-
@@ -4,19 +4,31 @@ int main(int argument_count, char** arguments)
 {	
 	using namespace bertini;
 
-	ParseArgcArgv(argument_count, arguments);
+	try{
+		auto options = ParseArgcArgv(argument_count, arguments);
+		if (options.print_help)
+		{
+			std::cout << blackbox::Usage();
+			return 0;
+		}
 
-	serial::Initialize();
-	parallel::Initialize();
+		serial::Initialize();
+		parallel::Initialize();
 
 
 
-	MainModeSwitch();
+		MainModeSwitch(options);
 
 
 
-	parallel::Finalize();
-	serial::Finalize();
+		parallel::Finalize();
+		serial::Finalize();
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "bertini2: " << e.what() << std::endl;
+		return 1;
+	}
 
 	return 0;
 }
@@ -26,11 +26,110 @@
 \brief Provides the main mode switch for the Bertini2 executable program.
 */
 
+#include "bertini2/blackbox/main_mode_switch.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <thread>
+
+#include "bertini2/blackbox/switches_zerodim.hpp"
+#include "bertini2/io/parsing/classic_utilities.hpp"
+#include "bertini2/io/parsing/fast_system_parser.hpp"
+#include "bertini2/io/system_cache.hpp"
+
 
 namespace bertini{
 
-	void MainModeSwitch()
+	namespace {
+
+		/**
+		\brief Open a file for writing, throwing if it can't be.
+		*/
+		std::ofstream OpenOutFile(Path const& path)
+		{
+			std::ofstream out(path.string());
+			if (!out)
+				throw std::runtime_error("unable to open '" + path.string() + "' for writing");
+			return out;
+		}
+
+
+		/**
+		\brief Choose the runtime types of a zero dim algorithm from the config section of an input file.
+		*/
+		blackbox::ZeroDimRT ZeroDimTypesFromConfig(std::string const& config)
+		{
+			blackbox::ZeroDimRT rt;
+			switch (parsing::classic::FillConfigStruct<tracking::PrecisionType>(config))
+			{
+				case tracking::PrecisionType::Fixed:
+					rt.tracker = blackbox::type::Tracker::FixedDouble;
+					break;
+				case tracking::PrecisionType::FixedMultiple:
+					throw std::runtime_error("fixed multiple precision (mptype: 1) is not supported yet, since the working precision isn't read from the config.  use double precision (mptype: 0) or adaptive precision (mptype: 2)");
+				case tracking::PrecisionType::Adaptive:
+					rt.tracker = blackbox::type::Tracker::Adaptive;
+					break;
+			}
+			return rt;
+		}
+	}
+
+
+	void MainModeSwitch(blackbox::ProgramOptions const& options)
 	{
-		
+		using Clock = std::chrono::steady_clock;
+		auto seconds = [](Clock::time_point a, Clock::time_point b){ return std::chrono::duration<double>(b-a).count(); };
+
+		auto num_threads = options.num_threads;
+		if (num_threads==0)
+			num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto start = Clock::now();
+
+		std::string config, input;
+		std::tie(config, input) = parsing::classic::SplitIntoConfigAndInput(options.input_file);
+
+		if (parsing::classic::FillConfigStruct<algorithm::classic::AlgoChoice>(config)!=algorithm::classic::AlgoChoice::ZeroDim)
+			throw std::runtime_error("only zero dimensional solves (tracktype: 0) are supported so far");
+
+		// the whole file goes into the keys, since the config decides how the systems are set up
+		auto parse = [&](){ return parsing::classic::FastSystemParser(num_threads).Parse(input); };
+		std::optional<SystemCache> cache;
+		if (!options.cache_directory.empty())
+			cache.emplace(options.cache_directory);
+
+		auto target = cache ? cache->GetOrBuild(SystemCache::KeyForFile(options.input_file, "target"), parse) : parse();
+		auto parsed = Clock::now();
+
+		auto solver = blackbox::MakeZeroDim(ZeroDimTypesFromConfig(config), target);
+		if (cache)
+			solver->UseCachedSystems(*cache, SystemCache::KeyForFile(options.input_file, "zero dim"));
+		solver->ApplyClassicConfig(config);
+		solver->SetNumThreads(num_threads);
+		auto set_up = Clock::now();
+
+		// raw_data is written path by path as the solve runs, and main_data after it
+		fs::create_directories(options.output_directory);
+		auto main_data = OpenOutFile(options.output_directory / "main_data");
+		auto raw_data = OpenOutFile(options.output_directory / "raw_data");
+		solver->RunWritingClassic(main_data, raw_data);
+		main_data.close();
+		raw_data.close();
+		auto solved = Clock::now();
+
+		auto const solve_seconds = seconds(set_up, solved);
+
+		std::cout << std::fixed << std::setprecision(3)
+		          << "paths tracked:    " << solver->NumPaths() << "\n"
+		          << "paths succeeded:  " << solver->NumSuccessfulPaths() << "\n"
+		          << "threads:          " << num_threads << "\n"
+		          << "parse time (s):   " << seconds(start, parsed) << "\n"
+		          << "setup time (s):   " << seconds(parsed, set_up) << "\n"
+		          << "solve time (s):   " << solve_seconds << "\n"
+		          << "total time (s):   " << seconds(start, solved) << "\n"
+		          << "paths per second: " << (solve_seconds > 0 ? solver->NumPaths()/solve_seconds : 0) << "\n";
 	}
 }
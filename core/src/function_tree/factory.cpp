@@ -0,0 +1,226 @@
+//This file is part of Bertini 2.
+//
+//b2/core/src/function_tree/factory.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2/core/src/function_tree/factory.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2/core/src/function_tree/factory.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//  silviana amethyst, university of wisconsin-eau claire
+
+
+#include "bertini2/function_tree.hpp"
+
+#include <functional>
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		template<typename T>
+		void HashCombine(size_t & seed, T const& value)
+		{
+			seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		}
+
+		/**
+		A double approximation of the value of an Integer, Rational or Float, for hashing.  Equal values hash equally, and the rare collisions are settled by comparing exactly.
+		*/
+		std::pair<double, double> ApproximateValue(std::shared_ptr<Node> const& n)
+		{
+			if (auto as_int = std::dynamic_pointer_cast<Integer>(n))
+				return {as_int->TrueValue().convert_to<double>(), 0};
+			if (auto as_rat = std::dynamic_pointer_cast<Rational>(n))
+				return {as_rat->TrueValueReal().convert_to<double>(), as_rat->TrueValueImag().convert_to<double>()};
+			auto const& v = std::dynamic_pointer_cast<Float>(n)->HighestPrecisionValue();
+			return {static_cast<double>(real(v)), static_cast<double>(imag(v))};
+		}
+
+		/**
+		Whether two Integers, Rationals or Floats of the same type have the same value.  Floats must have the same precision too.
+		*/
+		bool SameValue(std::shared_ptr<Node> const& a, std::shared_ptr<Node> const& b)
+		{
+			if (auto a_int = std::dynamic_pointer_cast<Integer>(a))
+				return a_int->TrueValue()==std::dynamic_pointer_cast<Integer>(b)->TrueValue();
+			if (auto a_rat = std::dynamic_pointer_cast<Rational>(a))
+			{
+				auto b_rat = std::dynamic_pointer_cast<Rational>(b);
+				return a_rat->TrueValueReal()==b_rat->TrueValueReal() && a_rat->TrueValueImag()==b_rat->TrueValueImag();
+			}
+			auto const& u = std::dynamic_pointer_cast<Float>(a)->HighestPrecisionValue();
+			auto const& v = std::dynamic_pointer_cast<Float>(b)->HighestPrecisionValue();
+			return u.precision()==v.precision() && u==v;
+		}
+
+	} // namespace
+
+
+
+	std::shared_ptr<UnaryOperator> WithOperand(std::shared_ptr<UnaryOperator> const& n, std::shared_ptr<Node> const& operand)
+	{
+		if (std::dynamic_pointer_cast<NegateOperator>(n))
+			return NegateOperator::Make(operand);
+		if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+			return IntegerPowerOperator::Make(operand, as_int_pow->exponent());
+		if (std::dynamic_pointer_cast<SqrtOperator>(n))
+			return SqrtOperator::Make(operand);
+		if (std::dynamic_pointer_cast<ExpOperator>(n))
+			return ExpOperator::Make(operand);
+		if (std::dynamic_pointer_cast<LogOperator>(n))
+			return LogOperator::Make(operand);
+		if (std::dynamic_pointer_cast<SinOperator>(n))
+			return SinOperator::Make(operand);
+		if (std::dynamic_pointer_cast<ArcSinOperator>(n))
+			return ArcSinOperator::Make(operand);
+		if (std::dynamic_pointer_cast<CosOperator>(n))
+			return CosOperator::Make(operand);
+		if (std::dynamic_pointer_cast<ArcCosOperator>(n))
+			return ArcCosOperator::Make(operand);
+		if (std::dynamic_pointer_cast<TanOperator>(n))
+			return TanOperator::Make(operand);
+		if (std::dynamic_pointer_cast<ArcTanOperator>(n))
+			return ArcTanOperator::Make(operand);
+		return nullptr;
+	}
+
+
+
+	bool NodeFactory::Key::operator==(Key const& other) const
+	{
+		if (type!=other.type || operands!=other.operands || flags!=other.flags || exponent!=other.exponent)
+			return false;
+		if (number && other.number)
+			return SameValue(number, other.number);
+		return !number && !other.number;
+	}
+
+
+	size_t NodeFactory::KeyHash::operator()(Key const& k) const
+	{
+		size_t seed = std::hash<std::type_index>{}(k.type);
+		for (auto operand : k.operands)
+			HashCombine(seed, operand);
+		HashCombine(seed, k.flags);
+		HashCombine(seed, k.exponent);
+		if (k.number)
+		{
+			auto value = ApproximateValue(k.number);
+			HashCombine(seed, value.first);
+			HashCombine(seed, value.second);
+		}
+		return seed;
+	}
+
+
+
+	std::shared_ptr<Node> NodeFactory::Intern(std::shared_ptr<Node> const& n)
+	{
+		if (!n)
+			return n;
+
+		auto found = seen_.find(n.get());
+		if (found != seen_.end())
+			return found->second.second;
+
+		auto by_identity = [&]()
+		{
+			seen_.emplace(n.get(), std::make_pair(n, n));
+			return n;
+		};
+
+		Key key{std::type_index(typeid(*n))};
+		auto interned = n; // n, or if the representatives of its operands differ from them, a copy of n on those
+
+		if (auto as_handle = std::dynamic_pointer_cast<Handle>(n))
+		{
+			as_handle->SetRoot(Intern(as_handle->EntryNode()));
+			return by_identity();
+		}
+		else if (auto as_unary = std::dynamic_pointer_cast<UnaryOperator>(n))
+		{
+			auto operand = Intern(as_unary->Operand());
+			if (operand!=as_unary->Operand())
+			{
+				interned = WithOperand(as_unary, operand);
+				if (!interned)
+					return by_identity();
+			}
+			key.operands.push_back(operand.get());
+
+			if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				key.exponent = as_int_pow->exponent();
+		}
+		else if (auto as_nary = std::dynamic_pointer_cast<NaryOperator>(n))
+		{
+			std::vector<std::shared_ptr<Node>> operands;
+			bool changed = false;
+			for (auto const& operand : as_nary->Operands())
+			{
+				operands.push_back(Intern(operand));
+				changed = changed || operands.back()!=operand;
+				key.operands.push_back(operands.back().get());
+			}
+
+			if (auto as_sum = std::dynamic_pointer_cast<SumOperator>(n))
+			{
+				key.flags = as_sum->GetSigns();
+				if (changed)
+				{
+					auto copy = SumOperator::Make();
+					copy->SetOperands(operands, key.flags);
+					interned = copy;
+				}
+			}
+			else if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(n))
+			{
+				key.flags = as_mult->GetMultOrDiv();
+				if (changed)
+				{
+					auto copy = MultOperator::Make();
+					copy->SetOperands(operands, key.flags);
+					interned = copy;
+				}
+			}
+			else if (changed)
+				return by_identity(); // a kind of operator which can't be copied
+		}
+		else if (auto as_pow = std::dynamic_pointer_cast<PowerOperator>(n))
+		{
+			auto base = Intern(as_pow->GetBase());
+			auto exponent = Intern(as_pow->GetExponent());
+			if (base!=as_pow->GetBase() || exponent!=as_pow->GetExponent())
+				interned = PowerOperator::Make(base, exponent);
+			key.operands.push_back(base.get());
+			key.operands.push_back(exponent.get());
+		}
+		else if (std::dynamic_pointer_cast<Float>(n) || std::dynamic_pointer_cast<Integer>(n) || std::dynamic_pointer_cast<Rational>(n))
+			key.number = n;
+		else if (!std::dynamic_pointer_cast<special_number::Pi>(n) && !std::dynamic_pointer_cast<special_number::E>(n))
+			return by_identity(); // variables, differentials, linear products, and anything else without a structure to compare
+
+		auto inserted = representatives_.emplace(std::move(key), interned);
+		auto const& representative = inserted.first->second;
+		seen_.emplace(n.get(), std::make_pair(n, representative));
+		if (interned!=n)
+			seen_.emplace(interned.get(), std::make_pair(interned, representative));
+		return representative;
+	}
+
+} // namespace node
+} // namespace bertini
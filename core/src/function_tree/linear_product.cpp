@@ -59,11 +59,15 @@ namespace  bertini {
 		
 		std::shared_ptr<Node> LinearProduct::Differentiate(std::shared_ptr<Variable> const& v) const
 		{
+			// with respect to a variable not appearing in the product, the derivative vanishes identically.
+			if (v && std::find(variables_.begin(), variables_.end(), v) == variables_.end() && v != hom_variable_)
+				return Zero();
+
 			std::shared_ptr<SumOperator> ret_sum;
 			std::vector<size_t> indices;  //Those factors that are not differentiated in one particular term of the differentiated result.
             
 			// First term of product rule
-			std::shared_ptr<MultOperator> temp_mult = MultOperator::Make(DiffLinear::Make(GetLinears(0)));
+			std::shared_ptr<MultOperator> temp_mult = MultOperator::Make(DiffLinear::Make(GetLinears(0), v));
 			for(int ii = 1; ii < num_factors_; ++ii)
 			{
 				indices.push_back(ii);  // Indices 1 to num_factors-1
@@ -76,7 +80,7 @@ namespace  bertini {
 			// Rest of the factors
 			for(int ii = 1; ii < num_factors_; ++ii)
 			{
-				temp_mult = MultOperator::Make(DiffLinear::Make(GetLinears(ii)));
+				temp_mult = MultOperator::Make(DiffLinear::Make(GetLinears(ii), v));
 				indices.clear();
 				for(int jj = 0; jj < num_factors_ ; ++jj)
 				{
@@ -330,7 +334,7 @@ namespace  bertini {
 				}
 				
 				LinearProduct temp(variables_, hom_variable_, temp_real, temp_imag, is_hom_vars_);
-				return LinearProduct::Make(temp);
+				return RecordSource(LinearProduct::Make(temp), {index});
 			}
 			else
 			{
@@ -342,7 +346,7 @@ namespace  bertini {
 				}
 				
 				LinearProduct temp(variables_, hom_variable_, temp_mpfr, is_hom_vars_);
-				return LinearProduct::Make(temp);
+				return RecordSource(LinearProduct::Make(temp), {index});
 
 			}
 			
@@ -366,7 +370,7 @@ namespace  bertini {
 				}
 				
 				LinearProduct temp(variables_, hom_variable_, temp_real, temp_imag, is_hom_vars_);
-				return LinearProduct::Make(temp);
+				return RecordSource(LinearProduct::Make(temp), indices);
 			}
 			else
 			{
@@ -381,13 +385,44 @@ namespace  bertini {
 				}
 				
 				LinearProduct temp(variables_, hom_variable_, temp_mpfr, is_hom_vars_);
-				return LinearProduct::Make(temp);
+				return RecordSource(LinearProduct::Make(temp), indices);
 			}
 			
 		}
 
 		
 		
+		std::shared_ptr<LinearProduct> LinearProduct::RecordSource(std::shared_ptr<LinearProduct> const& broken_off, std::vector<size_t> const& indices) const
+		{
+			// the copy made in GetLinears carries this product's provenance along, so reset it before recording our own.
+			broken_off->source_.reset();
+			broken_off->source_factors_.clear();
+
+			// a product not owned by a shared_ptr cannot be referred back to.
+			auto self = std::dynamic_pointer_cast<const LinearProduct>(Node::weak_from_this().lock());
+			if (!self)
+				return broken_off;
+
+			auto my_factors = SourceFactors();
+			broken_off->source_ = Source();
+			for (auto ii : indices)
+				broken_off->source_factors_.push_back(my_factors[ii]);
+
+			return broken_off;
+		}
+
+
+
+		std::shared_ptr<Node> LinearProduct::CoefficientAsNode(size_t factor, size_t term) const
+		{
+			if (is_rational_coeffs_)
+				return Rational::Make(coeffs_rat_real_(factor,term), coeffs_rat_imag_(factor,term));
+			else
+				return Float::Make(std::get<Mat<mpfr_complex>>(coeffs_)(factor,term));
+		}
+
+
+
 		void LinearProduct::print(std::ostream & target) const
 		{
 			auto& coeff_ref = std::get<Mat<dbl>>(coeffs_);
@@ -434,7 +469,7 @@ namespace  bertini {
 		//
 		////////////////////////////////////////
 		
-		DiffLinear::DiffLinear(std::shared_ptr<LinearProduct> const& linear)
+		DiffLinear::DiffLinear(std::shared_ptr<LinearProduct> const& linear, std::shared_ptr<Variable> const& diff_variable) : linear_(linear), diff_variable_(diff_variable)
 		{
 			// Set differentials of all variables in the linear
 			linear->GetVariables(variables_);
@@ -61,6 +61,55 @@ BOOST_CLASS_EXPORT_IMPLEMENT(bertini::node::ExpOperator)
 namespace bertini{
 namespace node{
 
+	thread_local DifferentiationMemo::Table* DifferentiationMemo::active_ = nullptr;
+
+	DifferentiationMemo::DifferentiationMemo()
+	{
+		if (!active_)
+		{
+			owned_ = std::make_unique<Table>();
+			active_ = owned_.get();
+		}
+	}
+
+	DifferentiationMemo::~DifferentiationMemo()
+	{
+		if (owned_)
+			active_ = nullptr;
+	}
+
+	std::shared_ptr<Node> DifferentiationMemo::Derivative(std::shared_ptr<Node> const& n, std::shared_ptr<Variable> const& v)
+	{
+		if (!active_)
+		{
+			DifferentiationMemo memo;
+			return Derivative(n, v);
+		}
+
+		Key key(n, v);
+		auto found = active_->find(key);
+		if (found != active_->end())
+			return found->second;
+
+		auto d = n->Differentiate(v);
+		active_->emplace(std::move(key), d);
+		return d;
+	}
+
+
+	bool IsZeroNumber(std::shared_ptr<Node> const& n)
+	{
+		auto as_number = std::dynamic_pointer_cast<Number>(n);
+		return as_number && as_number->Eval<dbl>()==dbl(0.0);
+	}
+
+	bool IsOneNumber(std::shared_ptr<Node> const& n)
+	{
+		auto as_number = std::dynamic_pointer_cast<Number>(n);
+		return as_number && as_number->Eval<dbl>()==dbl(1.0);
+	}
+
+
 	unsigned Node::ReduceDepth()
 	{
 		return 0;
@@ -154,6 +154,19 @@ unsigned SumOperator::ReduceSubMults()
 }
 
 
+void SumOperator::SetOperands(std::vector<std::shared_ptr<Node>> operands, std::vector<bool> signs)
+{
+	if (operands.size()!=signs.size())
+		throw std::runtime_error("setting operands of SumOperator, with a different number of signs than terms");
+	if (operands.empty())
+		throw std::runtime_error("setting operands of SumOperator to nothing");
+
+	using std::swap;
+	swap(operands_, operands);
+	swap(signs_, signs);
+}
+
+
 unsigned SumOperator::ReduceDepth()
 {
 	auto num_eliminated = ReduceSubSums() + ReduceSubMults();
@@ -191,27 +204,33 @@ std::shared_ptr<Node> SumOperator::Differentiate(std::shared_ptr<Variable> const
 {
 	unsigned int counter = 0;
 	std::shared_ptr<Node> ret_sum = Zero();
+	std::shared_ptr<Node> first_term;
 	for (int ii = 0; ii < operands_.size(); ++ii)
 	{
 		auto converted = std::dynamic_pointer_cast<Number>(operands_[ii]);
 		if (converted)
 			continue;
 		
-		auto temp_node = operands_[ii]->Differentiate(v);
-		converted = std::dynamic_pointer_cast<Number>(temp_node);
-		if (converted)
-			if (converted->Eval<dbl>()==dbl(0.0))
-				continue;
+		auto temp_node = DifferentiationMemo::Derivative(operands_[ii], v);
+		if (IsZeroNumber(temp_node))
+			continue;
 		
 		counter++;
 		if (counter==1)
+		{
+			first_term = temp_node;
 			ret_sum = SumOperator::Make(temp_node,signs_[ii]);
+		}
 		else
 			std::dynamic_pointer_cast<SumOperator>(ret_sum)->AddOperand(temp_node,signs_[ii]);
 		
 	}
+
+	// a sum of one added term is just that term, and handing it back directly keeps the derivative DAG shared.
+	if (counter==1 && std::dynamic_pointer_cast<SumOperator>(ret_sum)->signs_[0])
+		return first_term;
 	
-		return ret_sum;
+	return ret_sum;
 }
 
 int SumOperator::Degree(std::shared_ptr<Variable> const& v) const
@@ -473,7 +492,10 @@ void NegateOperator::print(std::ostream & target) const
 
 std::shared_ptr<Node> NegateOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 {
-	return NegateOperator::Make(operand_->Differentiate(v));
+	auto d = DifferentiationMemo::Derivative(operand_, v);
+	if (IsZeroNumber(d))
+		return Zero();
+	return NegateOperator::Make(d);
 }
 
 dbl NegateOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
@@ -677,6 +699,19 @@ unsigned MultOperator::ReduceSubMults()
 }
 
 
+void MultOperator::SetOperands(std::vector<std::shared_ptr<Node>> operands, std::vector<bool> mult_or_div)
+{
+	if (operands.size()!=mult_or_div.size())
+		throw std::runtime_error("setting operands of MultOperator, with a different number of mult/div flags than factors");
+	if (operands.empty())
+		throw std::runtime_error("setting operands of MultOperator to nothing");
+
+	using std::swap;
+	swap(operands_, operands);
+	swap(mult_or_div_, mult_or_div);
+}
+
+
 unsigned MultOperator::ReduceDepth()
 {
 	auto num_eliminated = ReduceSubSums() + ReduceSubMults();
@@ -721,40 +756,38 @@ std::shared_ptr<Node> MultOperator::Differentiate(std::shared_ptr<Variable> cons
 	// this loop implements the generic product rule, perhaps inefficiently.
 	for (int ii = 0; ii < operands_.size(); ++ii)
 	{
-		auto local_derivative = operands_[ii]->Differentiate(v);
+		auto local_derivative = DifferentiationMemo::Derivative(operands_[ii], v);
 		
-		// if the derivative of the current term is 0, then stop 
-		auto is_it_a_number = std::dynamic_pointer_cast<Float>(local_derivative);
-		if (is_it_a_number)
-			if (is_it_a_number->Eval<dbl>()==dbl(0.0))
-				continue;
+		// if the derivative of the current term is 0, then skip it
+		if (IsZeroNumber(local_derivative))
+			continue;
 		
 		// no, the term's derivative is not 0.  
 		
-		// create the product of the remaining terms
-		auto term_ii = MultOperator::Make(local_derivative);
+		// create the product of the remaining terms, against the current derivative.
+		// if the derivative of the term under consideration is equal to 1, it need not appear in the product.
+		auto term_ii = IsOneNumber(local_derivative) ? MultOperator::Make() : MultOperator::Make(local_derivative);
 		for (int jj = 0; jj < operands_.size(); ++jj)
 		{
 			if(jj != ii)
 				term_ii->AddOperand(operands_[jj],mult_or_div_[jj]);
 		}
 		
-		// and then either 1. multiply it against the current derivative, or 2. invoke the quotient rule.
-		if (is_it_a_number)
-			if (is_it_a_number->Eval<dbl>()==dbl(1.0))
-				continue;
-		
-		// if the derivative of the term under consideration is equal to 1, no need to go on.  already have the product we need.
-		
 		// if is division, need this for the quotient rule
 		if ( !(mult_or_div_[ii]) )
 			term_ii->AddOperand(pow(operands_[ii],2),false); // draw a line and square below
+
+		std::shared_ptr<Node> term = term_ii;
+		if (term_ii->NumOperands()==0)
+			term = One();
+		else if (term_ii->NumOperands()==1 && term_ii->mult_or_div_[0])
+			term = term_ii->operands_[0];
 		
 		term_counter++;
 		if (term_counter==1)
-			ret_sum = SumOperator::Make(term_ii,mult_or_div_[ii]);
+			ret_sum = SumOperator::Make(term,mult_or_div_[ii]);
 		else
-			std::dynamic_pointer_cast<SumOperator>(ret_sum)->AddOperand(term_ii,mult_or_div_[ii]);
+			std::dynamic_pointer_cast<SumOperator>(ret_sum)->AddOperand(term,mult_or_div_[ii]);
 	} // re: for ii
 	
 	return ret_sum;
@@ -954,8 +987,12 @@ void PowerOperator::print(std::ostream & target) const
 std::shared_ptr<Node> PowerOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 {
 	
+	auto d = DifferentiationMemo::Derivative(base_, v);
+	if (IsZeroNumber(d))
+		return Zero();
+
 	auto exp_minus_one = exponent_-1;
-	auto ret_mult = MultOperator::Make(base_->Differentiate(v));
+	auto ret_mult = MultOperator::Make(d);
 	ret_mult->AddOperand(exponent_);
 	ret_mult->AddOperand(PowerOperator::Make(base_, exp_minus_one));
 	return ret_mult;
@@ -1147,17 +1184,21 @@ std::shared_ptr<Node> IntegerPowerOperator::Differentiate(std::shared_ptr<Variab
 {
 	if (exponent_==0)
 		return Integer::Make(0);
-	else if (exponent_==1)
-		return operand_->Differentiate(v);
+
+	auto d = DifferentiationMemo::Derivative(operand_, v);
+	if (exponent_==1 || IsZeroNumber(d))
+		return d;
 	else if (exponent_==2){
 		auto M = MultOperator::Make(Integer::Make(2), operand_);
-		M->AddOperand(operand_->Differentiate(v));
+		if (!IsOneNumber(d))
+			M->AddOperand(d);
 		return M;
 	}
 	else{
 		auto M = MultOperator::Make(Integer::Make(exponent_),
 												IntegerPowerOperator::Make(operand_, exponent_-1) );
-		M->AddOperand(operand_->Differentiate(v));
+		if (!IsOneNumber(d))
+			M->AddOperand(d);
 		return M;
 	}
 }
@@ -1210,8 +1251,12 @@ void SqrtOperator::print(std::ostream & target) const
 
 std::shared_ptr<Node> SqrtOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 {
+	auto d = DifferentiationMemo::Derivative(operand_, v);
+	if (IsZeroNumber(d))
+		return Zero();
+
 	auto ret_mult = MultOperator::Make(PowerOperator::Make(operand_, Rational::Make(mpq_rational(-1,2),0)));
-	ret_mult->AddOperand(operand_->Differentiate(v));
+	ret_mult->AddOperand(d);
 	ret_mult->AddOperand(Rational::Make(mpq_rational(1,2),0));
 	return ret_mult;
 }
@@ -1293,7 +1338,10 @@ void ExpOperator::print(std::ostream & target) const
 
 std::shared_ptr<Node> ExpOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 {
-	return exp(operand_)*operand_->Differentiate(v);
+	auto d = DifferentiationMemo::Derivative(operand_, v);
+	if (IsZeroNumber(d))
+		return Zero();
+	return exp(operand_)*d;
 }
 
 
@@ -1368,7 +1416,10 @@ void LogOperator::print(std::ostream & target) const
 
 std::shared_ptr<Node> LogOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 {
-	return MultOperator::Make(operand_,false,operand_->Differentiate(v),true);
+	auto d = DifferentiationMemo::Derivative(operand_, v);
+	if (IsZeroNumber(d))
+		return Zero();
+	return MultOperator::Make(operand_,false,d,true);
 }
 
 
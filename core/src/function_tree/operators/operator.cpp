@@ -159,6 +159,11 @@ size_t NaryOperator::NumOperands() const
 	return operands_.size();
 }
 
+void NaryOperator::SetOperand(size_t index, std::shared_ptr<Node> n)
+{
+	operands_.at(index) = std::move(n);
+}
+
 std::shared_ptr<Node> NaryOperator::FirstOperand() const
 {
 	return operands_[0];
@@ -62,7 +62,10 @@ namespace node{
 	
 	std::shared_ptr<Node> SinOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return cos(operand_) * operand_->Differentiate(v);
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return cos(operand_) * d;
 	}
 
 	// Specific implementation of FreshEval for negate.
@@ -107,7 +110,10 @@ namespace node{
 
 	std::shared_ptr<Node> ArcSinOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return operand_->Differentiate(v)/sqrt(1-pow(operand_,2));
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return d/sqrt(1-pow(operand_,2));
 	}
 
 
@@ -153,7 +159,10 @@ namespace node{
 	
 	std::shared_ptr<Node> CosOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return -sin(operand_) * operand_->Differentiate(v);
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return -sin(operand_) * d;
 	}
 
 	dbl CosOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
@@ -199,7 +208,10 @@ namespace node{
 
 	std::shared_ptr<Node> ArcCosOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return -operand_->Differentiate(v)/sqrt(1-pow(operand_,2));
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return -d/sqrt(1-pow(operand_,2));
 	}
 
 	// Specific implementation of FreshEval for negate.
@@ -245,7 +257,10 @@ namespace node{
 
 	std::shared_ptr<Node> TanOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return operand_->Differentiate(v) /  pow(cos(operand_),2);
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return d /  pow(cos(operand_),2);
 	}
 
 	dbl TanOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
@@ -291,7 +306,10 @@ namespace node{
 
 	std::shared_ptr<Node> ArcTanOperator::Differentiate(std::shared_ptr<Variable> const& v) const
 	{
-		return operand_->Differentiate(v) / (1 + pow(operand_,2));
+		auto d = DifferentiationMemo::Derivative(operand_, v);
+		if (IsZeroNumber(d))
+			return Zero();
+		return d / (1 + pow(operand_,2));
 	}
 
 	dbl ArcTanOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
@@ -131,7 +131,8 @@ void Handle::EnsureNotEmpty() const
 
 std::shared_ptr<Node> Handle::Differentiate(std::shared_ptr<Variable> const& v) const
 {
-	return entry_node_->Differentiate(v);
+	DifferentiationMemo memo;
+	return DifferentiationMemo::Derivative(entry_node_, v);
 }
 
 /**
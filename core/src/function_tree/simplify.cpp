@@ -27,28 +27,890 @@
 
 
 #include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/function_tree.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <typeinfo>
 
 namespace bertini {
 
-unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n)
+using node::Node;
+using node::Integer;
+using node::Rational;
+using node::Float;
+using node::SumOperator;
+using node::MultOperator;
+using node::NegateOperator;
+using node::UnaryOperator;
+using node::NaryOperator;
+using node::PowerOperator;
+using node::IntegerPowerOperator;
+
+namespace {
+
+	using Nd = std::shared_ptr<Node>;
+
+	/**
+	A numeric constant, being folded from Number nodes.  Kept exactly, as a complex rational, as long as only Integers and Rationals have gone into it.  Once a Float does, it is carried in multiple precision, at the highest precision of anything that went into it.
+	*/
+	class Constant
+	{
+	public:
+
+		explicit
+		Constant(int value) : real_(value), imag_(0)
+		{}
+
+		/**
+		Whether a node is a number which can be folded.  Special numbers such as pi are left alone, since they can be evaluated at any precision.
+		*/
+		static
+		bool IsFoldable(Nd const& n)
+		{
+			return std::dynamic_pointer_cast<Integer>(n) || std::dynamic_pointer_cast<Rational>(n) || std::dynamic_pointer_cast<Float>(n);
+		}
+
+		/**
+		The value of a foldable node.
+		*/
+		static
+		Constant From(Nd const& n)
+		{
+			Constant c(0);
+			if (auto as_int = std::dynamic_pointer_cast<Integer>(n))
+				c.real_ = mpq_rational(as_int->TrueValue());
+			else if (auto as_rat = std::dynamic_pointer_cast<Rational>(n))
+			{
+				c.real_ = as_rat->TrueValueReal();
+				c.imag_ = as_rat->TrueValueImag();
+			}
+			else if (auto as_float = std::dynamic_pointer_cast<Float>(n))
+			{
+				c.exact_ = false;
+				c.approx_ = as_float->HighestPrecisionValue();
+			}
+			else
+				throw std::runtime_error("making a Constant from a node which is not an Integer, Rational, or Float");
+			return c;
+		}
+
+		void Add(Constant const& other, bool add_or_sub)
+		{
+			if (exact_ && other.exact_)
+			{
+				if (add_or_sub)
+				{
+					real_ += other.real_;
+					imag_ += other.imag_;
+				}
+				else
+				{
+					real_ -= other.real_;
+					imag_ -= other.imag_;
+				}
+				return;
+			}
+
+			auto prec = std::max(Precision(), other.Precision());
+			auto a = Approximate(prec);
+			auto b = other.Approximate(prec);
+			approx_ = add_or_sub ? mpfr_complex(a+b) : mpfr_complex(a-b);
+			exact_ = false;
+		}
+
+		/**
+		Multiply or divide this by another constant.  Division by zero is refused, leaving this unchanged.
+
+		\return Whether the operation was done.
+		*/
+		bool Multiply(Constant const& other, bool mult_or_div)
+		{
+			if (!mult_or_div && other.IsZero())
+				return false;
+
+			if (exact_ && other.exact_)
+			{
+				mpq_rational re, im;
+				if (mult_or_div)
+				{
+					re = real_*other.real_ - imag_*other.imag_;
+					im = real_*other.imag_ + imag_*other.real_;
+				}
+				else
+				{
+					mpq_rational denom = other.real_*other.real_ + other.imag_*other.imag_;
+					re = (real_*other.real_ + imag_*other.imag_)/denom;
+					im = (imag_*other.real_ - real_*other.imag_)/denom;
+				}
+				real_ = re;
+				imag_ = im;
+				return true;
+			}
+
+			auto prec = std::max(Precision(), other.Precision());
+			auto a = Approximate(prec);
+			auto b = other.Approximate(prec);
+			approx_ = mult_or_div ? mpfr_complex(a*b) : mpfr_complex(a/b);
+			exact_ = false;
+			return true;
+		}
+
+		void Negate()
+		{
+			if (exact_)
+			{
+				real_ = -real_;
+				imag_ = -imag_;
+			}
+			else
+				approx_ = -approx_;
+		}
+
+		bool IsZero() const
+		{
+			if (exact_)
+				return real_==0 && imag_==0;
+			return real(approx_)==0 && imag(approx_)==0;
+		}
+
+		bool IsOne() const
+		{
+			if (exact_)
+				return real_==1 && imag_==0;
+			return real(approx_)==1 && imag(approx_)==0;
+		}
+
+		/**
+		A node holding this value.  An Integer or Rational if exact, a Float otherwise.
+		*/
+		Nd MakeNode() const
+		{
+			if (!exact_)
+				return Float::Make(approx_);
+			if (imag_==0 && denominator(real_)==1)
+				return Integer::Make(mpz_int(numerator(real_)));
+			return Rational::Make(real_, imag_);
+		}
+
+	private:
+
+		unsigned Precision() const
+		{
+			return exact_ ? 0 : approx_.precision();
+		}
+
+		mpfr_complex Approximate(unsigned prec) const
+		{
+			if (exact_)
+				return mpfr_complex(mpfr_float(real_,prec), mpfr_float(imag_,prec));
+			return mpfr_complex(approx_, prec);
+		}
+
+		bool exact_ = true;
+		mpq_rational real_, imag_;
+		mpfr_complex approx_;
+	};
+
+
+
+	/**
+	The operands of a node, which must be simplified before it is.  Function handles, linear products and symbols have none, as far as simplification is concerned.
+	*/
+	std::vector<Nd> OperandsOf(Nd const& n)
+	{
+		if (auto as_nary = std::dynamic_pointer_cast<NaryOperator>(n))
+			return as_nary->Operands();
+		if (auto as_unary = std::dynamic_pointer_cast<UnaryOperator>(n))
+			return {as_unary->Operand()};
+		if (auto as_pow = std::dynamic_pointer_cast<PowerOperator>(n))
+			return {as_pow->GetBase(), as_pow->GetExponent()};
+		return {};
+	}
+
+
+	/**
+	Whether a node is a number known not to be zero, so that it can be cancelled against itself.  Foldable numbers are folded before they get this far, so this is for the special numbers.
+	*/
+	bool IsNonzeroConstant(Nd const& n)
+	{
+		return std::dynamic_pointer_cast<node::special_number::Pi>(n) || std::dynamic_pointer_cast<node::special_number::E>(n);
+	}
+
+} // namespace
+
+
+
+SimplificationStatistics& SimplificationStatistics::operator+=(SimplificationStatistics const& other)
+{
+	nodes_visited += other.nodes_visited;
+	rewrites += other.rewrites;
+	constants_folded += other.constants_folded;
+	terms_merged += other.terms_merged;
+	factors_merged += other.factors_merged;
+	elapsed += other.elapsed;
+	return *this;
+}
+
+std::ostream& operator<<(std::ostream& out, SimplificationStatistics const& s)
+{
+	out << "visited " << s.nodes_visited << " nodes, made " << s.rewrites << " rewrites (" << s.constants_folded << " constants folded, " << s.terms_merged << " terms merged, " << s.factors_merged << " factors merged) in " << s.elapsed.count() << " seconds";
+	return out;
+}
+
+
+
+
+
+std::shared_ptr<Node> Simplifier::Simplify(std::shared_ptr<Node> const& n)
+{
+	auto start = std::chrono::steady_clock::now();
+	auto result = Visit(n);
+	statistics_.elapsed += std::chrono::steady_clock::now() - start;
+	return result;
+}
+
+
+unsigned Simplifier::SimplifyInPlace(std::shared_ptr<Node> const& n)
+{
+	auto start = std::chrono::steady_clock::now();
+	auto rewrites_before = statistics_.rewrites;
+
+	auto result = Visit(n);
+
+	// the node itself has to stay, so it takes on what it can of its replacement.  sums and products can take on all of it.  nothing beneath it is changed.
+	if (result!=n)
+	{
+		if (auto as_sum = std::dynamic_pointer_cast<SumOperator>(n))
+		{
+			if (auto result_as_sum = std::dynamic_pointer_cast<SumOperator>(result))
+				as_sum->SetOperands(result_as_sum->Operands(), result_as_sum->GetSigns());
+			else
+				as_sum->SetOperands({result}, {true});
+		}
+		else if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(n))
+		{
+			if (auto result_as_mult = std::dynamic_pointer_cast<MultOperator>(result))
+				as_mult->SetOperands(result_as_mult->Operands(), result_as_mult->GetMultOrDiv());
+			else
+				as_mult->SetOperands({result}, {true});
+		}
+		else if (auto as_unary = std::dynamic_pointer_cast<UnaryOperator>(n))
+		{
+			auto result_as_unary = std::dynamic_pointer_cast<UnaryOperator>(result);
+			if (result_as_unary && typeid(*result_as_unary)==typeid(*as_unary))
+			{
+				as_unary->SetOperand(result_as_unary->Operand());
+				if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+					as_int_pow->set_exponent(std::dynamic_pointer_cast<IntegerPowerOperator>(result)->exponent());
+			}
+			else
+				as_unary->SetOperand(Simplified(as_unary->Operand()));
+		}
+		else if (auto as_pow = std::dynamic_pointer_cast<PowerOperator>(n))
+		{
+			if (auto result_as_pow = std::dynamic_pointer_cast<PowerOperator>(result))
+			{
+				as_pow->SetBase(result_as_pow->GetBase());
+				as_pow->SetExponent(result_as_pow->GetExponent());
+			}
+			else
+			{
+				as_pow->SetBase(Simplified(as_pow->GetBase()));
+				as_pow->SetExponent(Simplified(as_pow->GetExponent()));
+			}
+		}
+	}
+
+	statistics_.elapsed += std::chrono::steady_clock::now() - start;
+	return statistics_.rewrites - rewrites_before;
+}
+
+
+void Simplifier::Clear()
+{
+	simplified_.clear();
+	factory_.Clear();
+	statistics_ = SimplificationStatistics();
+}
+
+
+std::shared_ptr<Node> const& Simplifier::Simplified(std::shared_ptr<Node> const& n) const
+{
+	auto found = simplified_.find(n.get());
+	if (found==simplified_.end())
+		return n; // not visited, or already the result of simplification
+	return found->second.second;
+}
+
+
+
+std::shared_ptr<Node> Simplifier::Visit(std::shared_ptr<Node> const& n)
+{
+	// post-order, with an explicit worklist.  the flag says whether the operands have been pushed already.
+	std::vector< std::pair<Nd, bool> > worklist{ {n, false} };
+
+	while (!worklist.empty())
+	{
+		auto current = worklist.back();
+		worklist.pop_back();
+
+		if (simplified_.find(current.first.get())!=simplified_.end())
+			continue; // shared, and reached already by another path
+
+		if (!current.second)
+		{
+			worklist.emplace_back(current.first, true);
+			for (auto const& operand : OperandsOf(current.first))
+				if (simplified_.find(operand.get())==simplified_.end())
+					worklist.emplace_back(operand, false);
+			continue;
+		}
+
+		++statistics_.nodes_visited;
+		auto result = factory_.Intern(Rewrite(current.first));
+		if (result!=current.first)
+			++statistics_.rewrites;
+		simplified_.emplace(current.first.get(), std::make_pair(current.first, result));
+	}
+
+	return Simplified(n);
+}
+
+
+
+std::shared_ptr<Node> Simplifier::Rewrite(std::shared_ptr<Node> const& n)
+{
+	// n may be shared with trees which aren't being simplified, so it is left as it is.  if it simplifies, the result is another node.
+	auto simplified_operands = [this](std::shared_ptr<NaryOperator> const& nary)
+	{
+		std::vector<Nd> operands;
+		operands.reserve(nary->NumOperands());
+		for (auto const& operand : nary->Operands())
+			operands.push_back(Simplified(operand));
+		return operands;
+	};
+
+	if (auto as_sum = std::dynamic_pointer_cast<SumOperator>(n))
+		return RewriteSum(as_sum, simplified_operands(as_sum), as_sum->GetSigns());
+	if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(n))
+		return RewriteMult(as_mult, simplified_operands(as_mult), as_mult->GetMultOrDiv());
+
+	if (auto as_unary = std::dynamic_pointer_cast<UnaryOperator>(n))
+	{
+		auto const& simplified = Simplified(as_unary->Operand());
+		if (simplified==as_unary->Operand())
+			return RewriteUnary(as_unary);
+		if (auto copy = node::WithOperand(as_unary, simplified))
+			return RewriteUnary(copy);
+		return n; // a kind of operator which can't be copied, so can't be changed
+	}
+
+	if (auto as_pow = std::dynamic_pointer_cast<PowerOperator>(n))
+	{
+		auto const& base = Simplified(as_pow->GetBase());
+		auto const& exponent = Simplified(as_pow->GetExponent());
+		if (base==as_pow->GetBase() && exponent==as_pow->GetExponent())
+			return RewritePower(as_pow);
+		return RewritePower(PowerOperator::Make(base, exponent));
+	}
+
+	return n;
+}
+
+
+
+std::shared_ptr<Node> Simplifier::RewriteSum(std::shared_ptr<SumOperator> const& n, std::vector<Nd> const& operands, std::vector<bool> const& signs)
+{
+	// operands which are themselves sums are already simplified, so flattening one level flattens completely
+	std::vector<Nd> terms;
+	std::vector<bool> term_signs;
+	for (size_t ii=0; ii<operands.size(); ++ii)
+	{
+		if (auto as_sum = std::dynamic_pointer_cast<SumOperator>(operands[ii]))
+			for (size_t jj=0; jj<as_sum->NumOperands(); ++jj)
+			{
+				terms.push_back(as_sum->Operands()[jj]);
+				term_signs.push_back(as_sum->GetSigns()[jj]==signs[ii]);
+			}
+		else
+		{
+			terms.push_back(operands[ii]);
+			term_signs.push_back(signs[ii]);
+		}
+	}
+
+	// split each term into a numeric coefficient and the rest, its base.  terms with the same base are merged.
+	struct Group
+	{
+		Nd base;
+		Constant coefficient;
+		Nd term;
+		bool sign;
+		unsigned count;
+	};
+	std::vector<Group> groups;
+	std::unordered_map<const Node*, size_t> group_of_base;
+
+	Constant constant(0);
+	unsigned num_constants{0};
+	size_t constant_slot{0}; // the constant goes before the group with this index, where the first number was
+	Nd first_constant;
+	bool first_constant_sign{true};
+
+	for (size_t ii=0; ii<terms.size(); ++ii)
+	{
+		auto const& term = terms[ii];
+		if (Constant::IsFoldable(term))
+		{
+			if (num_constants==0)
+			{
+				constant_slot = groups.size();
+				first_constant = term;
+				first_constant_sign = term_signs[ii];
+			}
+			constant.Add(Constant::From(term), term_signs[ii]);
+			++num_constants;
+			continue;
+		}
+
+		Constant coefficient(term_signs[ii] ? 1 : -1);
+		Nd base = term;
+		if (auto as_neg = std::dynamic_pointer_cast<NegateOperator>(term))
+		{
+			coefficient.Negate();
+			base = as_neg->Operand();
+		}
+		else if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(term))
+		{
+			// a simplified product has at most one number in it
+			auto const& factors = as_mult->Operands();
+			auto const& mult_or_div = as_mult->GetMultOrDiv();
+			auto number = std::find_if(factors.begin(), factors.end(), Constant::IsFoldable);
+			if (number!=factors.end() && mult_or_div[number-factors.begin()] && factors.size()>1)
+			{
+				coefficient.Multiply(Constant::From(*number), true);
+
+				std::vector<Nd> rest;
+				std::vector<bool> rest_mult_or_div;
+				for (size_t jj=0; jj<factors.size(); ++jj)
+					if (factors.begin()+jj!=number)
+					{
+						rest.push_back(factors[jj]);
+						rest_mult_or_div.push_back(mult_or_div[jj]);
+					}
+
+				if (rest.size()==1 && rest_mult_or_div[0])
+					base = rest[0];
+				else
+				{
+					auto rest_product = MultOperator::Make();
+					rest_product->SetOperands(rest, rest_mult_or_div);
+					base = factory_.Intern(rest_product);
+				}
+			}
+		}
+
+		auto found = group_of_base.find(base.get());
+		if (found==group_of_base.end())
+		{
+			group_of_base.emplace(base.get(), groups.size());
+			groups.push_back(Group{base, coefficient, term, term_signs[ii], 1});
+		}
+		else
+		{
+			auto& group = groups[found->second];
+			group.coefficient.Add(coefficient, true);
+			++group.count;
+		}
+	}
+
+	std::vector<Nd> new_terms;
+	std::vector<bool> new_signs;
+
+	auto emit_constant = [&]()
+	{
+		if (num_constants==0 || constant.IsZero())
+			return;
+		if (num_constants==1)
+		{
+			new_terms.push_back(first_constant);
+			new_signs.push_back(first_constant_sign);
+		}
+		else
+		{
+			new_terms.push_back(constant.MakeNode());
+			new_signs.push_back(true);
+		}
+	};
+
+	for (size_t ii=0; ii<groups.size(); ++ii)
+	{
+		if (ii==constant_slot)
+			emit_constant();
+
+		auto const& group = groups[ii];
+		if (group.count==1)
+		{
+			new_terms.push_back(group.term);
+			new_signs.push_back(group.sign);
+			continue;
+		}
+
+		statistics_.terms_merged += group.count-1;
+
+		auto negated = group.coefficient;
+		negated.Negate();
+
+		if (group.coefficient.IsZero())
+			continue;
+		else if (group.coefficient.IsOne())
+		{
+			new_terms.push_back(group.base);
+			new_signs.push_back(true);
+		}
+		else if (negated.IsOne())
+		{
+			new_terms.push_back(group.base);
+			new_signs.push_back(false);
+		}
+		else
+		{
+			auto scaled = MultOperator::Make();
+			scaled->AddOperand(group.coefficient.MakeNode(), true);
+			if (auto base_as_mult = std::dynamic_pointer_cast<MultOperator>(group.base))
+				for (size_t jj=0; jj<base_as_mult->NumOperands(); ++jj)
+					scaled->AddOperand(base_as_mult->Operands()[jj], base_as_mult->GetMultOrDiv()[jj]);
+			else
+				scaled->AddOperand(group.base, true);
+			new_terms.push_back(factory_.Intern(scaled));
+			new_signs.push_back(true);
+		}
+	}
+	if (constant_slot==groups.size())
+		emit_constant();
+
+	if (num_constants>1)
+		statistics_.constants_folded += num_constants-1;
+
+	if (new_terms.empty())
+	{
+		new_terms.push_back(node::Zero());
+		new_signs.push_back(true);
+	}
+
+	// a sum of one term is that term, or its negation
+	if (new_terms.size()==1)
+	{
+		auto const& term = new_terms[0];
+		if (new_signs[0])
+			return term;
+		if (Constant::IsFoldable(term))
+		{
+			auto negated = Constant::From(term);
+			negated.Negate();
+			++statistics_.constants_folded;
+			return negated.MakeNode();
+		}
+		if (auto as_neg = std::dynamic_pointer_cast<NegateOperator>(term))
+			return as_neg->Operand();
+		return NegateOperator::Make(term);
+	}
+
+	if (new_terms==n->Operands() && new_signs==n->GetSigns())
+		return n;
+
+	auto result = SumOperator::Make();
+	result->SetOperands(new_terms, new_signs);
+	return result;
+}
+
+
+
+std::shared_ptr<Node> Simplifier::RewriteMult(std::shared_ptr<MultOperator> const& n, std::vector<Nd> const& operands, std::vector<bool> const& mult_or_div)
+{
+	// flatten products, and pull negations out into the numeric factor
+	std::vector<Nd> factors;
+	std::vector<bool> factor_mult_or_div;
+	unsigned num_negations{0};
+	for (size_t ii=0; ii<operands.size(); ++ii)
+	{
+		if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(operands[ii]))
+			for (size_t jj=0; jj<as_mult->NumOperands(); ++jj)
+			{
+				factors.push_back(as_mult->Operands()[jj]);
+				factor_mult_or_div.push_back(as_mult->GetMultOrDiv()[jj]==mult_or_div[ii]);
+			}
+		else if (auto as_neg = std::dynamic_pointer_cast<NegateOperator>(operands[ii]))
+		{
+			++num_negations;
+			factors.push_back(as_neg->Operand());
+			factor_mult_or_div.push_back(mult_or_div[ii]);
+		}
+		else
+		{
+			factors.push_back(operands[ii]);
+			factor_mult_or_div.push_back(mult_or_div[ii]);
+		}
+	}
+
+	// split each factor into a base and an integer exponent.  factors with the same base are merged, but only those in the numerator with each other, and those in the denominator with each other.  cancelling x/x would remove x=0 from the domain, so only nonzero constants are cancelled.
+	struct Group
+	{
+		Nd base;
+		int exponent;
+		Nd factor;
+		bool mult_or_div;
+		unsigned count;
+	};
+	std::vector<Group> groups;
+	std::map<std::pair<const Node*, bool>, size_t> group_of_base;
+
+	Constant constant(num_negations%2 ? -1 : 1);
+	unsigned num_constants{0};
+	size_t constant_slot{0};
+	Nd first_constant;
+	bool first_constant_mult_or_div{true};
+
+	if (num_negations>0)
+		constant_slot = 0;
+
+	for (size_t ii=0; ii<factors.size(); ++ii)
+	{
+		auto const& factor = factors[ii];
+		if (Constant::IsFoldable(factor) && constant.Multiply(Constant::From(factor), factor_mult_or_div[ii]))
+		{
+			if (num_constants==0)
+			{
+				if (num_negations==0)
+					constant_slot = groups.size();
+				first_constant = factor;
+				first_constant_mult_or_div = factor_mult_or_div[ii];
+			}
+			++num_constants;
+			continue;
+		}
+
+		// division by a zero number is left alone, as an ordinary factor
+
+		Nd base = factor;
+		int exponent = 1;
+		if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(factor))
+		{
+			base = as_int_pow->Operand();
+			exponent = as_int_pow->exponent();
+		}
+		if (!factor_mult_or_div[ii])
+			exponent = -exponent;
+
+		std::pair<const Node*, bool> key(base.get(), exponent>0 || IsNonzeroConstant(base));
+		auto found = group_of_base.find(key);
+		if (found==group_of_base.end())
+		{
+			group_of_base.emplace(key, groups.size());
+			groups.push_back(Group{base, exponent, factor, factor_mult_or_div[ii], 1});
+		}
+		else
+		{
+			auto& group = groups[found->second];
+			group.exponent += exponent;
+			++group.count;
+		}
+	}
+
+	if (num_constants>1)
+		statistics_.constants_folded += num_constants-1;
+
+	// anything times zero is zero
+	if (constant.IsZero())
+		return node::Zero();
+
+	std::vector<Nd> new_factors;
+	std::vector<bool> new_mult_or_div;
+
+	auto emit_constant = [&]()
+	{
+		if (constant.IsOne())
+			return;
+		if (num_constants==1 && num_negations==0)
+		{
+			new_factors.push_back(first_constant);
+			new_mult_or_div.push_back(first_constant_mult_or_div);
+		}
+		else
+		{
+			new_factors.push_back(constant.MakeNode());
+			new_mult_or_div.push_back(true);
+		}
+	};
+
+	for (size_t ii=0; ii<groups.size(); ++ii)
+	{
+		if (ii==constant_slot)
+			emit_constant();
+
+		auto const& group = groups[ii];
+		if (group.count==1)
+		{
+			new_factors.push_back(group.factor);
+			new_mult_or_div.push_back(group.mult_or_div);
+			continue;
+		}
+
+		statistics_.factors_merged += group.count-1;
+
+		if (group.exponent==0)
+			continue;
+		else if (group.exponent==1 || group.exponent==-1)
+			new_factors.push_back(group.base);
+		else
+			new_factors.push_back(factory_.Intern(IntegerPowerOperator::Make(group.base, std::abs(group.exponent))));
+		new_mult_or_div.push_back(group.exponent>0);
+	}
+	if (constant_slot==groups.size())
+		emit_constant();
+
+	if (new_factors.empty())
+	{
+		new_factors.push_back(node::One());
+		new_mult_or_div.push_back(true);
+	}
+
+	// a product of one factor is that factor
+	if (new_factors.size()==1 && new_mult_or_div[0])
+		return new_factors[0];
+
+	if (new_factors==n->Operands() && new_mult_or_div==n->GetMultOrDiv())
+		return n;
+
+	auto result = MultOperator::Make();
+	result->SetOperands(new_factors, new_mult_or_div);
+	return result;
+}
+
+
+
+std::shared_ptr<Node> Simplifier::RewriteUnary(std::shared_ptr<UnaryOperator> const& n)
+{
+	auto const& operand = n->Operand();
+
+	if (std::dynamic_pointer_cast<NegateOperator>(n))
+	{
+		if (Constant::IsFoldable(operand))
+		{
+			auto negated = Constant::From(operand);
+			negated.Negate();
+			++statistics_.constants_folded;
+			return negated.MakeNode();
+		}
+		if (auto as_neg = std::dynamic_pointer_cast<NegateOperator>(operand))
+			return as_neg->Operand();
+		return n;
+	}
+
+	if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+	{
+		auto exponent = as_int_pow->exponent();
+		if (exponent==0)
+			return node::One();
+		if (exponent==1)
+			return operand;
+
+		if (Constant::IsFoldable(operand))
+		{
+			auto base = Constant::From(operand);
+			Constant result(1);
+			bool ok = true;
+			for (int ii=0; ii<std::abs(exponent) && ok; ++ii)
+				ok = result.Multiply(base, exponent>0);
+			if (ok)
+			{
+				++statistics_.constants_folded;
+				return result.MakeNode();
+			}
+		}
+
+		// (x^a)^b = x^(ab) for integers a and b, unless both are negative, which would remove x=0 from the domain
+		auto inner = std::dynamic_pointer_cast<IntegerPowerOperator>(operand);
+		if (inner && (inner->exponent()>0 || exponent>0 || IsNonzeroConstant(inner->Operand())))
+		{
+			++statistics_.factors_merged;
+			auto combined = inner->exponent()*exponent;
+			if (combined==1)
+				return inner->Operand();
+			return IntegerPowerOperator::Make(inner->Operand(), combined);
+		}
+		return n;
+	}
+
+	// the elementary functions, at the numbers where they are trivial
+	if (Constant::IsFoldable(operand))
+	{
+		auto value = Constant::From(operand);
+		if (value.IsZero())
+		{
+			if (std::dynamic_pointer_cast<node::SqrtOperator>(n) || std::dynamic_pointer_cast<node::SinOperator>(n) || std::dynamic_pointer_cast<node::TanOperator>(n) || std::dynamic_pointer_cast<node::ArcSinOperator>(n) || std::dynamic_pointer_cast<node::ArcTanOperator>(n))
+			{
+				++statistics_.constants_folded;
+				return node::Zero();
+			}
+			if (std::dynamic_pointer_cast<node::CosOperator>(n) || std::dynamic_pointer_cast<node::ExpOperator>(n))
+			{
+				++statistics_.constants_folded;
+				return node::One();
+			}
+		}
+		else if (value.IsOne() && std::dynamic_pointer_cast<node::LogOperator>(n))
+		{
+			++statistics_.constants_folded;
+			return node::Zero();
+		}
+	}
+
+	return n;
+}
+
+
+
+std::shared_ptr<Node> Simplifier::RewritePower(std::shared_ptr<PowerOperator> const& n)
 {
-	unsigned num_reductions = 0;
-	unsigned num_ones = 0;
-	unsigned num_zeros = 0;
+	auto const& exponent = n->GetExponent();
+	if (!Constant::IsFoldable(exponent))
+		return n;
 
-	num_reductions = n->ReduceDepth();
-	num_ones = n->EliminateOnes();
-	num_zeros = n->EliminateZeros();
+	auto value = Constant::From(exponent);
+	if (value.IsZero())
+		return node::One();
+	if (value.IsOne())
+		return n->GetBase();
 
-	unsigned num_rounds{0};
-	while (num_reductions || num_ones || num_zeros)
+	// an integer power is cheaper to evaluate, and can be merged with others
+	if (auto as_int = std::dynamic_pointer_cast<Integer>(exponent))
 	{
-		++num_rounds;
-		num_reductions = n->ReduceDepth();
-		num_ones = n->EliminateOnes();
-		num_zeros = n->EliminateZeros();
+		auto const& k = as_int->TrueValue();
+		if (abs(k) <= std::numeric_limits<int>::max())
+			return RewriteUnary(IntegerPowerOperator::Make(n->GetBase(), k.convert_to<int>()));
 	}
-	return num_rounds;
+
+	return n;
+}
+
+
+
+unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n)
+{
+	Simplifier s;
+	return s.SimplifyInPlace(n);
+}
+
+
+unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n, SimplificationStatistics & stats)
+{
+	Simplifier s;
+	auto num_rewrites = s.SimplifyInPlace(n);
+	stats += s.Statistics();
+	return num_rewrites;
 }
 
 } // namespace bertini
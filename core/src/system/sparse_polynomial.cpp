@@ -0,0 +1,402 @@
+//This file is part of Bertini 2.
+//
+//sparse_polynomial.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//sparse_polynomial.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with sparse_polynomial.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+#include "bertini2/system/sparse_polynomial.hpp"
+#include "bertini2/system/system.hpp"
+
+
+namespace bertini{
+	using namespace bertini::node;
+
+	namespace {
+
+		// a polynomial in the middle of expansion: dense exponent vectors, to coefficients.  the empty polynomial is zero.  the ordering of the map makes expansion deterministic, so re-expanding at another precision gives the same terms in the same order.
+		using Exponents = std::vector<int>;
+		using Polynomial = std::map<Exponents, mpfr_complex>;
+
+		class Expander
+		{
+		public:
+			Expander(std::vector< std::shared_ptr<Variable> > const& variables, unsigned precision) : precision_(precision)
+			{
+				for (size_t ii = 0; ii < variables.size(); ++ii)
+					indices_[variables[ii].get()] = ii;
+				num_variables_ = variables.size();
+			}
+
+			Polynomial const& Expand(std::shared_ptr<Node> const& n)
+			{
+				auto found = expanded_.find(n.get());
+				if (found != expanded_.end())
+					return found->second;
+
+				return expanded_.emplace(n.get(), ExpandFresh(n)).first->second;
+			}
+
+		private:
+
+			Polynomial Constant(mpfr_complex c) const
+			{
+				Precision(c, precision_);
+				return Polynomial{{Exponents(num_variables_, 0), c}};
+			}
+
+			Polynomial Monomial(size_t index) const
+			{
+				mpfr_complex one(1);
+				Precision(one, precision_);
+
+				Exponents e(num_variables_, 0);
+				e[index] = 1;
+				return Polynomial{{e, one}};
+			}
+
+			static void AddInto(Polynomial & a, Polynomial const& b, bool add)
+			{
+				for (auto const& term : b)
+				{
+					auto found = a.find(term.first);
+					if (found == a.end())
+						a.emplace(term.first, add ? term.second : -term.second);
+					else if (add)
+						found->second += term.second;
+					else
+						found->second -= term.second;
+				}
+			}
+
+			static Polynomial Multiply(Polynomial const& a, Polynomial const& b)
+			{
+				Polynomial result;
+				for (auto const& s : a)
+					for (auto const& t : b)
+					{
+						Exponents e(s.first);
+						for (size_t ii = 0; ii < e.size(); ++ii)
+							e[ii] += t.first[ii];
+
+						auto found = result.find(e);
+						if (found == result.end())
+							result.emplace(std::move(e), s.second*t.second);
+						else
+							found->second += s.second*t.second;
+					}
+				return result;
+			}
+
+			Polynomial Power(Polynomial const& a, long exponent) const
+			{
+				Polynomial result = Constant(mpfr_complex(1));
+				Polynomial base(a);
+				while (exponent > 0)
+				{
+					if (exponent & 1)
+						result = Multiply(result, base);
+					exponent >>= 1;
+					if (exponent > 0)
+						base = Multiply(base, base);
+				}
+				return result;
+			}
+
+			static bool IsConstant(Polynomial const& a)
+			{
+				return a.size()==1 && std::all_of(a.begin()->first.begin(), a.begin()->first.end(), [](int e){return e==0;});
+			}
+
+			[[noreturn]] static void NotPolynomial(std::shared_ptr<Node> const& n)
+			{
+				std::stringstream err_msg;
+				err_msg << "cannot represent node " << n << " as a sparse polynomial";
+				throw std::runtime_error(err_msg.str());
+			}
+
+			Polynomial ExpandFresh(std::shared_ptr<Node> const& n)
+			{
+				if (auto as_variable = std::dynamic_pointer_cast<Variable>(n))
+				{
+					auto found = indices_.find(as_variable.get());
+					if (found == indices_.end())
+						NotPolynomial(n);
+					return Monomial(found->second);
+				}
+				else if (auto as_number = std::dynamic_pointer_cast<Number>(n))
+					return Constant(as_number->Eval<mpfr_complex>());
+				else if (auto as_handle = std::dynamic_pointer_cast<Handle>(n))
+					return Expand(as_handle->EntryNode());
+				else if (auto as_sum = std::dynamic_pointer_cast<SumOperator>(n))
+				{
+					Polynomial result; // empty is zero.  starting from an explicit zero would leave a zero constant term in every sum.
+					auto const& signs = as_sum->GetSigns();
+					for (size_t ii = 0; ii < as_sum->NumOperands(); ++ii)
+						AddInto(result, Expand(as_sum->Operands()[ii]), signs[ii]);
+					return result;
+				}
+				else if (auto as_mult = std::dynamic_pointer_cast<MultOperator>(n))
+				{
+					Polynomial result = Constant(mpfr_complex(1));
+					auto const& mult_or_div = as_mult->GetMultOrDiv();
+					for (size_t ii = 0; ii < as_mult->NumOperands(); ++ii)
+					{
+						auto const& factor = Expand(as_mult->Operands()[ii]);
+						if (mult_or_div[ii])
+							result = Multiply(result, factor);
+						else if (IsConstant(factor))
+							result = Multiply(result, Constant(mpfr_complex(1)/factor.begin()->second));
+						else
+							NotPolynomial(n);
+					}
+					return result;
+				}
+				else if (auto as_negate = std::dynamic_pointer_cast<NegateOperator>(n))
+				{
+					Polynomial result;
+					AddInto(result, Expand(as_negate->Operand()), false);
+					return result;
+				}
+				else if (auto as_int_pow = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				{
+					if (as_int_pow->exponent() < 0)
+						NotPolynomial(n);
+					return Power(Expand(as_int_pow->Operand()), as_int_pow->exponent());
+				}
+				else if (auto as_pow = std::dynamic_pointer_cast<PowerOperator>(n))
+				{
+					auto const& exponent = Expand(as_pow->GetExponent());
+					if (!IsConstant(exponent))
+						NotPolynomial(n);
+
+					auto const& e = exponent.begin()->second;
+					if (imag(e)!=0 || real(e)<0 || real(e)!=floor(real(e)))
+						NotPolynomial(n);
+					return Power(Expand(as_pow->GetBase()), static_cast<long>(real(e)));
+				}
+				else if (auto as_linprod = std::dynamic_pointer_cast<LinearProduct>(n))
+				{
+					VariableGroup vars;
+					as_linprod->GetVariables(vars);
+					std::shared_ptr<Node> hom_var;
+					as_linprod->GetHomVariable(hom_var);
+
+					Polynomial result = Constant(mpfr_complex(1));
+					for (size_t ii = 0; ii < as_linprod->NumFactors(); ++ii)
+					{
+						Polynomial linear;
+						for (size_t jj = 0; jj <= as_linprod->NumVariables(); ++jj)
+						{
+							auto const& term = jj < as_linprod->NumVariables() ? Expand(vars[jj]) : Expand(hom_var);
+							AddInto(linear, Multiply(Constant(as_linprod->CoefficientAsNode(ii,jj)->Eval<mpfr_complex>()), term), true);
+						}
+						result = Multiply(result, linear);
+					}
+					return result;
+				}
+
+				NotPolynomial(n);
+			}
+
+			unsigned precision_;
+			size_t num_variables_;
+			std::unordered_map<const Node*, size_t> indices_;
+			std::unordered_map<const Node*, Polynomial> expanded_; // memoized, so subfunctions are expanded once
+		};
+
+	} // namespace
+
+
+
+	SparsePolynomialSystem::SparsePolynomialSystem(System const& sys)
+	{
+		num_functions_ = sys.NumNaturalFunctions();
+		num_variables_ = sys.NumVariables();
+		has_path_variable_ = sys.HavePathVariable();
+		precision_ = sys.precision();
+
+		for (unsigned ii = 0; ii < num_functions_; ++ii)
+			functions_.push_back(sys.Function(ii));
+
+		variables_ = sys.Variables();
+		if (has_path_variable_)
+			variables_.push_back(sys.GetPathVariable());
+
+		Expand(true);
+	}
+
+
+
+	void SparsePolynomialSystem::Expand(bool store_structure) const
+	{
+		Expander expander(variables_, precision_);
+
+		if (store_structure)
+		{
+			term_functions_.clear();
+			term_begin_.assign(1, 0);
+			factor_variables_.clear();
+			factor_exponents_.clear();
+			max_degrees_.assign(num_variables_+1, 0);
+			max_factors_ = 0;
+		}
+		true_coefficients_.clear();
+
+		for (size_t ff = 0; ff < functions_.size(); ++ff)
+		{
+			for (auto const& term : expander.Expand(functions_[ff]))
+			{
+				true_coefficients_.push_back(term.second);
+
+				if (!store_structure)
+					continue;
+
+				term_functions_.push_back(ff);
+				size_t num_factors = 0;
+				for (size_t vv = 0; vv < term.first.size(); ++vv)
+					if (term.first[vv] > 0)
+					{
+						factor_variables_.push_back(vv);
+						factor_exponents_.push_back(term.first[vv]);
+						max_degrees_[vv] = std::max(max_degrees_[vv], term.first[vv]);
+						++num_factors;
+					}
+				term_begin_.push_back(factor_variables_.size());
+				max_factors_ = std::max(max_factors_, num_factors);
+			}
+		}
+
+		if (true_coefficients_.size()!=term_functions_.size())
+			throw std::runtime_error("re-expansion of SparsePolynomialSystem produced a different number of terms");
+
+		if (store_structure)
+		{
+			power_begin_.assign(num_variables_+2, 0);
+			for (size_t vv = 0; vv <= num_variables_; ++vv)
+				power_begin_[vv+1] = power_begin_[vv] + max_degrees_[vv] + 1;
+		}
+
+		expanded_precision_ = precision_;
+
+		auto& coeffs_d = std::get<std::vector<dbl_complex>>(coefficients_);
+		auto& coeffs_mp = std::get<std::vector<mpfr_complex>>(coefficients_);
+		coeffs_d.resize(true_coefficients_.size());
+		coeffs_mp = true_coefficients_;
+		for (size_t ii = 0; ii < true_coefficients_.size(); ++ii)
+			coeffs_d[ii] = dbl_complex(static_cast<double>(real(true_coefficients_[ii])), static_cast<double>(imag(true_coefficients_[ii])));
+
+		IsEvaluated<dbl_complex>() = false;
+		IsEvaluated<mpfr_complex>() = false;
+	}
+
+
+
+	void SparsePolynomialSystem::precision(unsigned new_precision) const
+	{
+		if (new_precision==precision_)
+			return;
+
+		precision_ = new_precision;
+		if (new_precision > expanded_precision_)
+			Expand(false);
+		else
+		{
+			auto& coeffs_mp = std::get<std::vector<mpfr_complex>>(coefficients_);
+			coeffs_mp = true_coefficients_;
+			for (auto& c : coeffs_mp)
+				Precision(c, new_precision);
+		}
+
+		IsEvaluated<mpfr_complex>() = false; // the double coefficients are unchanged
+	}
+
+
+
+	template<typename NumT>
+	void SparsePolynomialSystem::Eval() const
+	{
+		auto const& inputs = std::get<Vec<NumT>>(inputs_);
+		if (inputs.size()!=num_variables_+1)
+			throw std::runtime_error("evaluating SparsePolynomialSystem before setting its variable values");
+
+		auto const& coefficients = std::get<std::vector<NumT>>(coefficients_);
+		auto& powers = std::get<std::vector<NumT>>(powers_);
+		auto& prefix = std::get<std::vector<NumT>>(prefix_products_);
+		auto& f = std::get<Vec<NumT>>(function_values_);
+		auto& J = std::get<Mat<NumT>>(jacobian_);
+		auto& dt = std::get<Vec<NumT>>(time_derivatives_);
+
+		// the table of powers of each variable, by repeated multiplication
+		powers.resize(power_begin_.back());
+		for (size_t vv = 0; vv <= num_variables_; ++vv)
+		{
+			auto* p = powers.data() + power_begin_[vv];
+			p[0] = NumT(1);
+			for (int kk = 1; kk <= max_degrees_[vv]; ++kk)
+				p[kk] = p[kk-1]*inputs(vv);
+		}
+
+		f.setZero(num_functions_);
+		J.setZero(num_functions_, num_variables_);
+		dt.setZero(num_functions_);
+		prefix.resize(max_factors_+1);
+
+		// one pass over the terms.  prefix[k] is the coefficient times the first k factors; the suffix is the product of those after the one being differentiated.
+		for (size_t tt = 0; tt < term_functions_.size(); ++tt)
+		{
+			auto const begin = term_begin_[tt];
+			auto const num_factors = term_begin_[tt+1] - begin;
+			auto const ff = term_functions_[tt];
+
+			prefix[0] = coefficients[tt];
+			for (size_t kk = 0; kk < num_factors; ++kk)
+				prefix[kk+1] = prefix[kk] * powers[power_begin_[factor_variables_[begin+kk]] + factor_exponents_[begin+kk]];
+
+			f(ff) += prefix[num_factors];
+
+			NumT suffix(1);
+			for (size_t kk = num_factors; kk-- > 0; )
+			{
+				auto const vv = factor_variables_[begin+kk];
+				auto const e = factor_exponents_[begin+kk];
+				auto const* p = powers.data() + power_begin_[vv];
+
+				NumT partial = prefix[kk] * suffix * p[e-1] * NumT(e);
+				if (vv < num_variables_)
+					J(ff, vv) += partial;
+				else
+					dt(ff) += partial;
+
+				suffix *= p[e];
+			}
+		}
+
+		IsEvaluated<NumT>() = true;
+	}
+
+	template void SparsePolynomialSystem::Eval<dbl_complex>() const;
+	template void SparsePolynomialSystem::Eval<mpfr_complex>() const;
+
+} // namespace bertini
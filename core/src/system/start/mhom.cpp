@@ -26,6 +26,12 @@
 
 #include "bertini2/system/start/mhom.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <thread>
+
 
 BOOST_CLASS_EXPORT(bertini::start_system::MHomogeneous);
 
@@ -37,6 +43,177 @@ namespace bertini
 	namespace start_system 
 	{
 
+		namespace {
+
+			/**
+			\brief Depth-first search for the valid partitions of a degree matrix, pruned by counting.
+
+			The search never modifies itself, so one instance can be shared among threads searching different branches.
+			*/
+			class PartitionSearch
+			{
+			public:
+
+				/**
+				\brief A partially-chosen partition, together with the number of choices still needed in each column.
+				*/
+				struct Branch
+				{
+					Vec<int> partition;
+					std::vector<size_t> remaining;
+				};
+
+				PartitionSearch(Mat<int> const& degree_matrix, std::vector<VariableGroup> const& groups) : degree_matrix_(degree_matrix)
+				{
+					for (auto const& g : groups)
+						group_sizes_.push_back(g.size());
+
+					nonzero_rows_below_.assign(degree_matrix.rows()+1, std::vector<size_t>(degree_matrix.cols(), 0));
+					for (int row = degree_matrix.rows()-1; row >= 0; --row)
+						for (int col = 0; col < degree_matrix.cols(); ++col)
+							nonzero_rows_below_[row][col] = nonzero_rows_below_[row+1][col] + (degree_matrix(row,col)!=0 ? 1 : 0);
+				}
+
+				/**
+				\brief The branch with no choices made yet.
+				*/
+				Branch Root() const
+				{
+					return Branch{-1*Vec<int>::Ones(degree_matrix_.rows()), group_sizes_};
+				}
+
+				/**
+				\brief Can the remaining choices possibly be made using rows from `row` on?
+				*/
+				bool Feasible(std::vector<size_t> const& remaining, int row) const
+				{
+					for (size_t col = 0; col < remaining.size(); ++col)
+						if (remaining[col] > nonzero_rows_below_[row][col])
+							return false;
+					return true;
+				}
+
+				/**
+				\brief Append the feasible children of a branch, by choosing a column in `row`, in left to right order.
+				*/
+				void Expand(Branch const& b, int row, std::vector<Branch>& children) const
+				{
+					for (int col = 0; col < degree_matrix_.cols(); ++col)
+					{
+						if (degree_matrix_(row,col)==0 || b.remaining[col]==0)
+							continue;
+
+						Branch child = b;
+						child.partition(row) = col;
+						--child.remaining[col];
+						if (Feasible(child.remaining, row+1))
+							children.push_back(std::move(child));
+					}
+				}
+
+				/**
+				\brief Find all the valid partitions extending a branch whose choices are made for the rows before `row`.
+
+				The branch is used as scratch space, and is restored before returning.
+				*/
+				void Enumerate(Branch& b, int row, PackedPartitions& found) const
+				{
+					if (row == degree_matrix_.rows())
+					{
+						found.push_back(b.partition);
+						return;
+					}
+
+					for (int col = 0; col < degree_matrix_.cols(); ++col)
+					{
+						if (degree_matrix_(row,col)==0 || b.remaining[col]==0)
+							continue;
+
+						--b.remaining[col];
+						if (Feasible(b.remaining, row+1))
+						{
+							b.partition(row) = col;
+							Enumerate(b, row+1, found);
+						}
+						++b.remaining[col];
+					}
+					b.partition(row) = -1;
+				}
+
+			private:
+				Mat<int> const& degree_matrix_;
+				std::vector<size_t> group_sizes_; ///< The number of times each column must be chosen.
+				std::vector< std::vector<size_t> > nonzero_rows_below_; ///< The number of rows at or below a row with positive degree in a column.  Indexed by row, then column.
+			};
+
+		} // anonymous namespace
+
+
+
+		PackedPartitions::PackedPartitions(size_t length, size_t num_groups) : length_(length)
+		{
+			while ((std::uint64_t(1) << bits_per_entry_) < num_groups)
+				++bits_per_entry_;
+			words_per_partition_ = (length_*bits_per_entry_ + 63) / 64;
+		}
+
+
+		void PackedPartitions::push_back(Vec<int> const& partition)
+		{
+			if (static_cast<size_t>(partition.size()) != length_)
+				throw std::runtime_error("attempting to store partition of incorrect length");
+
+			auto base = words_.size();
+			words_.resize(base + words_per_partition_, 0);
+			for (size_t ii = 0; ii < length_; ++ii)
+			{
+				auto bit = ii*bits_per_entry_;
+				auto word = base + bit/64;
+				auto offset = bit%64;
+				auto value = static_cast<std::uint64_t>(partition(ii));
+
+				words_[word] |= value << offset;
+				if (offset + bits_per_entry_ > 64)
+					words_[word+1] |= value >> (64-offset);
+			}
+			++size_;
+		}
+
+
+		void PackedPartitions::append(PackedPartitions const& other)
+		{
+			if (other.length_ != length_ || other.bits_per_entry_ != bits_per_entry_)
+				throw std::runtime_error("attempting to append partitions of differing shape");
+
+			words_.insert(words_.end(), other.words_.begin(), other.words_.end());
+			size_ += other.size_;
+		}
+
+
+		int PackedPartitions::operator()(size_t index, size_t row) const
+		{
+			auto bit = row*bits_per_entry_;
+			auto word = index*words_per_partition_ + bit/64;
+			auto offset = bit%64;
+
+			std::uint64_t value = words_[word] >> offset;
+			if (offset + bits_per_entry_ > 64)
+				value |= words_[word+1] << (64-offset);
+
+			return static_cast<int>(value & ((std::uint64_t(1) << bits_per_entry_) - 1));
+		}
+
+
+		Vec<int> PackedPartitions::operator[](size_t index) const
+		{
+			Vec<int> partition(length_);
+			for (size_t ii = 0; ii < length_; ++ii)
+				partition(ii) = (*this)(index, ii);
+			return partition;
+		}
+
+
+
 		// constructor for MHomogeneous start system, from any other *suitable* system. System can be homogeneous or non-homogeneous. 
 		MHomogeneous::MHomogeneous(System const& s)
 		{
@@ -121,12 +298,34 @@ namespace bertini
 		*/
 		unsigned long long MHomogeneous::NumStartPoints() const
 		{
-			unsigned long long num_start_points = 0;
-			for(int ii = 0; ii < valid_partitions_.size(); ii++)
-			{ 
-    			num_start_points += NumStartPointsForPartition(valid_partitions_[ii]);
+			if (partition_offsets_.empty())
+				return 0;
+			return partition_offsets_.back();
+		}
+
+
+		void MHomogeneous::ComputePartitionOffsets()
+		{
+			partition_offsets_.resize(valid_partitions_.size()+1);
+			partition_offsets_[0] = 0;
+			for (size_t ii = 0; ii < valid_partitions_.size(); ++ii)
+			{
+				auto num_points = NumStartPointsForPartition(valid_partitions_[ii]);
+				if (num_points > std::numeric_limits<unsigned long long>::max() - partition_offsets_[ii])
+					throw std::overflow_error("number of start points for m-homogeneous start system exceeds the capacity of unsigned long long");
+				partition_offsets_[ii+1] = partition_offsets_[ii] + num_points;
 			}
-			return num_start_points;
+		}
+
+
+		size_t MHomogeneous::PartitionContaining(unsigned long long index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("attempted to find the partition of an mhom start point, but index not valid");
+
+			// the first offset strictly greater than index is one past the partition containing it.
+			auto iter = std::upper_bound(partition_offsets_.begin(), partition_offsets_.end(), index);
+			return static_cast<size_t>(iter - partition_offsets_.begin()) - 1;
 		}
 
 		/**
@@ -206,8 +405,8 @@ namespace bertini
 			\brief Function to find all valid partitions inside of a degree matrix. 
 
 			## Input: 
-				target_system: System that we wish to solve. Using this we can know total number of variables, functions, and variable groups,
-				 by using the systems member functions. 
+				target_system: System that we wish to solve.  Only used for its number of functions; the degree matrix and variable groups must already have been computed by CreateDegreeMatrix().
+				num_threads: the number of threads to search with.  0 means use as many as the hardware supports.
 
 
 			## Output:
@@ -215,129 +414,156 @@ namespace bertini
 
 
 			##Details:
-					TODO: Fill this.
+					A valid partition chooses, for each row (function) of the degree matrix, a column (variable group) in which that row has positive degree, such that each column is chosen exactly as many times as its group has variables.  
+
+					The partitions are found by a depth-first search over the rows, choosing columns left to right, so they come out in lexicographic order.  A branch is abandoned as soon as some column still needs more choices than there are remaining rows with positive degree in it.
+
+					To search in parallel, the first few rows are expanded breadth-first into enough independent subtrees to keep the threads busy.  The subtrees are searched concurrently, and their partitions concatenated in order, so the result is the same as a serial search.
 		*/
-		void MHomogeneous::GenerateValidPartitions(System const& target_system)
+		void MHomogeneous::GenerateValidPartitions(System const& target_system, unsigned num_threads)
 		{
-			int row = 0;
-			int old_current_part_row = -1;
-			int bad_choice = 0;
-			Vec<int> current_partition = -1*Vec<int>::Ones(target_system.NumNaturalFunctions());
-			Vec<int> variable_group_counter = Vec<int>::Zero(target_system.NumTotalVariableGroups());
+			if (degree_matrix_.rows() != static_cast<int>(target_system.NumNaturalFunctions()))
+				throw std::runtime_error("degree matrix does not match target system when generating mhom partitions.  call CreateDegreeMatrix first");
 
-			auto size_of_each_var_gp = target_system.VariableGroupSizes(); //K
-			
+			PartitionSearch search(degree_matrix_, var_groups_);
 
+			if (num_threads==0)
+				num_threads = std::max(1u, std::thread::hardware_concurrency());
 
+			// expand the top of the search tree until there are enough subtrees to share among the threads.
+			std::vector<PartitionSearch::Branch> branches;
+			auto root = search.Root();
+			if (search.Feasible(root.remaining, 0))
+				branches.push_back(root);
 
+			int depth = 0;
+			while (depth < degree_matrix_.rows() && branches.size() < 8*num_threads && !branches.empty())
+			{
+				std::vector<PartitionSearch::Branch> next;
+				for (auto& b : branches)
+					search.Expand(b, depth, next);
+				branches.swap(next);
+				++depth;
+			}
+
+			std::vector<PackedPartitions> found(branches.size(), PackedPartitions(degree_matrix_.rows(), degree_matrix_.cols()));
 
-			for(int ii = 0; ii < target_system.NumTotalVariableGroups(); ++ii)
+			auto work = [&](std::atomic<size_t>& next_branch)
 			{
-				variable_group_counter[ii] = size_of_each_var_gp[ii];
-			}			    
-			// std::cout << "variable_group_counter is " << std::endl;
-			// std::cout << variable_group_counter << std::endl;		
-			  while (row > -1)  // Algorithm will move up and down rows, kicking out to row=-1 at end
-			  {
-//			  	 std::cout << "current_partition before is " << std::endl;
-//			  	 std::cout <<  current_partition << std::endl;
-			    old_current_part_row = current_partition[row];  //Hang on to previous choice of column for this row, in case we are done with this row.
-			    current_partition[row] = ChooseColumnInRow(target_system,variable_group_counter,row,current_partition[row]);  //Pick next column (var gp) for the current row (func)
-//				  std::cout << "current_partition after is " << std::endl;
-//				  std::cout <<  current_partition << std::endl;
-
-			    //ChooseColumnInRow() will make this happen if it runs into col being equal to system.NumVariables()!
-			    if (current_partition[row] == target_system.NumTotalVariableGroups()) // means we have exhausted all good columns for the current row, so we go back up a row
-			    { //no choices for current row
-			      row = row - 1;  //go back up a row
-			      bad_choice = 1;
-			    }
-			    else  //found a good choice of column for this row!
-			    {
-			      	row = row + 1;  //move on to next row!
-			      	if (row < target_system.NumNaturalFunctions())
-			        	current_partition[row] = -1; //This allows us to consider all possible columns from left to right.
-			        	//since we are starting a new row, we start with the left-most entry (ChooseColumnInRow() first increments col)
-			    }
-			     
-			    if((row == target_system.NumNaturalFunctions()) && (!bad_choice))
-			    {
-			    	// std::cout << "Good partition!!!!" << std::endl;
-			    	// std::cout << current_partition << std::endl;
-			    	valid_partitions_.push_back(current_partition);
-			     	row = row - 1; //put the counter back on the last row to try to move to the next column
-			    }
-			    bad_choice=0;
-			  }
+				for (size_t ii = next_branch++; ii < branches.size(); ii = next_branch++)
+					search.Enumerate(branches[ii], depth, found[ii]);
+			};
+
+			std::atomic<size_t> next_branch(0);
+			if (num_threads==1 || branches.size() < 2)
+				work(next_branch);
+			else
+			{
+				std::vector<std::thread> threads;
+				for (unsigned ii = 0; ii < std::min<size_t>(num_threads, branches.size()); ++ii)
+					threads.emplace_back(work, std::ref(next_branch));
+				for (auto& t : threads)
+					t.join();
+			}
+
+			valid_partitions_ = PackedPartitions(degree_matrix_.rows(), degree_matrix_.cols());
+			for (auto const& f : found)
+				valid_partitions_.append(f);
+
+			ComputePartitionOffsets();
 		}
 
 
-		/**
-			\brief Function to find a valid column for a given row. 
 
-			## Input: 
-				target_system: System that we wish to solve. Using this we can know total number of variables, functions, and variable groups,
-				 by using the systems member functions. 
-				variable_group_counter: This vector of integers will keep track of how many times we can pick from a column.
-				row: This is the row in GenerateValidPartitions(). 
-				column: This comes from current_partition[row] in GenerateValidPartitions(). Because of this we will walk through the 
-				degree matrix from left to right.  
+		unsigned long long MHomogeneous::CountStartPoints(Mat<int> const& degree_matrix, std::vector<size_t> const& group_sizes)
+		{
+			if (group_sizes.size() != static_cast<size_t>(degree_matrix.cols()))
+				throw std::runtime_error("mismatch between number of variable group sizes and number of columns of degree matrix, when counting mhom start points");
 
+			// the number of choices remaining in each column, mapped to the sum, over all ways of reaching that state, of the products of the chosen degrees.
+			std::map< std::vector<size_t>, unsigned long long > states{ {group_sizes, 1} };
 
-			## Output:
-					int col: Returns the column that we have chosen for a given row. 
+			for (int row = 0; row < degree_matrix.rows(); ++row)
+			{
+				std::map< std::vector<size_t>, unsigned long long > next_states;
+				for (auto const& s : states)
+				{
+					for (int col = 0; col < degree_matrix.cols(); ++col)
+					{
+						if (degree_matrix(row,col)==0 || s.first[col]==0)
+							continue;
+
+						auto weight = s.second;
+						if (weight > std::numeric_limits<unsigned long long>::max() / degree_matrix(row,col))
+							throw std::overflow_error("m-homogeneous Bezout number exceeds the capacity of unsigned long long");
+						weight *= degree_matrix(row,col);
+
+						auto remaining = s.first;
+						--remaining[col];
+						auto& total = next_states[remaining];
+						if (weight > std::numeric_limits<unsigned long long>::max() - total)
+							throw std::overflow_error("m-homogeneous Bezout number exceeds the capacity of unsigned long long");
+						total += weight;
+					}
+				}
+				states.swap(next_states);
+			}
+
+			// only the state with every column used up corresponds to valid partitions.
+			auto done = states.find(std::vector<size_t>(group_sizes.size(), 0));
+			if (done == states.end())
+				return 0;
+			return done->second;
+		}
 
 
-			##Details:
-					Given a row, we search for a valid column from left to right. Since column is defaulted to -1 we will start with 
-					col = 0. Variaable_group_counter will be incremented or decremented if we are coming off a good partition, or have found a 
-					good column. 
 
+		
+		std::vector<size_t> MHomogeneous::PartitionDimensions(Vec<int> const& partition) const
+		{
+			std::vector<size_t> dim_vector(partition.size());
+			for (int ii = 0; ii < partition.size(); ++ii)
+			{
+				dim_vector[ii] = degree_matrix_(ii, partition(ii));
+			}
+			return dim_vector;
+		}
+
+
+		/**
+			\brief Solve the linear system for the coordinates of one variable group.
+
+			##Details:
+					Each row of a start point's linear system is a linear factor in the variables of the group chosen for that row by the partition, so the system is block diagonal, with one block per variable group.  The block for a group is square, since a valid partition chooses each group exactly as many times as it has variables.
 		*/
-		int MHomogeneous::ChooseColumnInRow(System const& target_system,Vec<int>& variable_group_counter, int row, int column)
+		template<typename T>
+		void MHomogeneous::SolveGroupBlock(Vec<T>& start_point, size_t group, std::vector<size_t> const& rows, std::vector<size_t> const& factors) const
 		{
-			int col = column + 1;  //We assume the current column is done and we need to increment by at least one. 
-			int done = 0;		   //Note: we started at -1 so this is ok
-
-			if (col - 1 > -1)
-			{ //If we are coming off of a good partition, we need to remember to increment var_gp_ctr, 
-			  //this holds how many we have chosen in a column as we move away from that column.
-			  variable_group_counter[col - 1] = variable_group_counter[col - 1] + 1;// var_gp_ctr is incremented because if(var_gp_ctr[col] == 0) -> bad choice
-			} 
-			while (!done)
+			std::vector<size_t> const& cols = variable_cols_[group];
+
+			if (rows.size() != cols.size())
+				throw std::runtime_error("non-square block in linear system for mhom start point");
+
+			Mat<T> A(rows.size(), cols.size());
+			Vec<T> b(rows.size());
+
+			for (size_t ii = 0; ii < rows.size(); ++ii)
 			{
-				/*We have reached the end of the degree matrix. 
-				Return and (current_partition[row] == target_system.NumTotalVariableGroups()) in GenerateValidPartitions() gets executed.
-			    */
-			    if (col == target_system.NumTotalVariableGroups())
-			    {
-			    	done = 1; //got to the right end of the degree matrix!
-			    } 
-			   
-			    else
-			    {
-			    	/*
-			    		If degree_matrix(row,col) == 0, we know that this is not a valid partition choice. We cannot pick 0 linears. 
-						If variable_group_counter[col] == 0, we have picked the maximum number of choices for this column.
-			    	*/
-			        if ((degree_matrix_(row,col) == 0) || (variable_group_counter[col] == 0))  //bad choice, either way!
-			        {	
-			        	col = col + 1;
-			        }
-			        else  
-			        {	/*means degree_matrix[row][col] > 0, so we have a possible valid choice,
-			        	 col <= NumTotalVariableGroups, we have not ran out of the matrix,
-			        	  and variable_group_counter[col] > 0 --> we still have choices for this column! Good column!
-			            */
-			            done = 1;
-			            variable_group_counter[col] = variable_group_counter[col] - 1;
-			        }
-			    }
+				auto coeff = linprod_matrix_(rows[ii], group)->GetCoeffs<T>(factors[ii]);
+				for (size_t jj = 0; jj < cols.size(); ++jj)
+				{
+					A(ii,jj) = coeff(jj);
+				}
+				b(ii) = -coeff(cols.size());
 			}
-			return col;
 
-		}
+			Vec<T> x = A.partialPivLu().solve(b);
 
+			for (size_t jj = 0; jj < cols.size(); ++jj)
+			{
+				start_point(cols[jj]) = x(jj);
+			}
+		}
 
 		
 		template<typename T>
@@ -346,74 +572,124 @@ namespace bertini
 			if(valid_partitions_.size() <= 0)
 				throw std::runtime_error("Trying to generate MHom start points before determining valid partitions.");
 			
-			
-			
-			// First, determine which partition we are looking through
-			int counter = 0;
-			int partition_ii = -1;
-			for (int ii = 0; ii < valid_partitions_.size(); ++ii)
-			{
-				counter += NumStartPointsForPartition(valid_partitions_[ii]);
-				
-				if(index < counter)
-				{
-					partition_ii = ii;
-					counter -= NumStartPointsForPartition(valid_partitions_[ii]);
-					index -= counter;
-					break;
-				}
-			}
-			
-			if(partition_ii == -1)
+			if (index >= NumStartPoints())
 				throw std::runtime_error("attempted to generate mhom start point, but index not valid");
 			
+			// First, determine which partition we are looking through
+			auto partition_ii = PartitionContaining(index);
+			index -= partition_offsets_[partition_ii];
 			
 			// Using partition ii, create dimension vector.  Then find the subscript.
-			auto partition = valid_partitions_[partition_ii];
-			std::vector<size_t> dim_vector(partition.size());
-			for (int ii = 0; ii < partition.size(); ++ii)
-			{
-				dim_vector[ii] = degree_matrix_(ii, partition(ii));
-			}
-			
-			std::vector<size_t> subscript = IndexToSubscript<size_t>(index, dim_vector);
-			
+			auto const& partition = valid_partitions_[partition_ii];
+			std::vector<size_t> subscript = IndexToSubscript<size_t>(index, PartitionDimensions(partition));
 			
 			
-			
-			
-			
-			// Create a linear system to solve.
+			// Solve the linear system, one variable group at a time.
 			size_t num_grouped_variables = NumNaturalVariables() - NumUngroupedVariables();
-			Mat<T> A(partition.size(), num_grouped_variables);
-			Vec<T> v(num_grouped_variables);
-			Vec<T> b(partition.size());
+			start_point.resize(num_grouped_variables);
 			
-			for(int ii = 0; ii < partition.size(); ++ii)
+			std::vector<size_t> rows, factors;
+			for (size_t group = 0; group < variable_cols_.size(); ++group)
 			{
-				v.setZero();
-				std::vector<size_t> cols = variable_cols_[partition[ii]];
-				auto coeff = linprod_matrix_(ii,partition[ii])->GetCoeffs<T>(subscript[ii]);
-				for(int jj = 0; jj < cols.size(); ++jj)
+				rows.clear();
+				factors.clear();
+				for (int ii = 0; ii < partition.size(); ++ii)
+					if (static_cast<size_t>(partition(ii)) == group)
+					{
+						rows.push_back(ii);
+						factors.push_back(subscript[ii]);
+					}
+
+				if (!rows.empty())
+					SolveGroupBlock(start_point, group, rows, factors);
+			}
+		}
+
+
+		template<typename T>
+		void MHomogeneous::GenerateStartPointsForPartitionT(std::vector<Vec<T>>& start_points, size_t partition_index) const
+		{
+			if (partition_index >= valid_partitions_.size())
+				throw std::out_of_range("attempted to generate mhom start points for a partition, but partition index not valid");
+
+			auto const& partition = valid_partitions_[partition_index];
+			auto dim_vector = PartitionDimensions(partition);
+			size_t num_grouped_variables = NumNaturalVariables() - NumUngroupedVariables();
+			auto num_groups = variable_cols_.size();
+
+			// Solve each group's block once for every choice of linear factors in its rows.
+			// The block solutions for a group are indexed the same way as the start points of the partition,
+			// but using only that group's rows, so the first row varies fastest.
+			std::vector< std::vector<size_t> > rows(num_groups);
+			std::vector< std::vector<Vec<T>> > block_solutions(num_groups);
+			for (size_t group = 0; group < num_groups; ++group)
+			{
+				std::vector<size_t> group_dims;
+				for (int ii = 0; ii < partition.size(); ++ii)
+					if (static_cast<size_t>(partition(ii)) == group)
+					{
+						rows[group].push_back(ii);
+						group_dims.push_back(dim_vector[ii]);
+					}
+
+				if (rows[group].empty())
+					continue;
+
+				size_t num_choices = 1;
+				for (auto d : group_dims)
+					num_choices *= d;
+
+				block_solutions[group].resize(num_choices);
+				for (size_t choice = 0; choice < num_choices; ++choice)
 				{
-					v(cols[jj]) = coeff[jj];
+					auto factors = IndexToSubscript<size_t>(choice, group_dims);
+					Vec<T>& block = block_solutions[group][choice];
+					block.resize(num_grouped_variables);
+					SolveGroupBlock(block, group, rows[group], factors);
 				}
-				
-				A.row(ii) = v;
-				b(ii) = -coeff[cols.size()];
 			}
-			
-			start_point = A.partialPivLu().solve(b);
-			
-			
-			var_groups_[0][0]->set_current_value(start_point(0));
-			var_groups_[0][1]->set_current_value(start_point(1));
-			
-			std::shared_ptr<node::Node> f = Function(0);
-			// !!! superfluous line?
-			
-			
 
+			// Assemble the start points by picking one block solution per group.
+			auto num_points = NumStartPointsForPartition(partition);
+			start_points.resize(num_points);
+			for (unsigned long long index = 0; index < num_points; ++index)
+			{
+				auto subscript = IndexToSubscript<size_t>(index, dim_vector);
+
+				Vec<T>& start_point = start_points[index];
+				start_point.resize(num_grouped_variables);
+				for (size_t group = 0; group < num_groups; ++group)
+				{
+					if (rows[group].empty())
+						continue;
+
+					size_t choice = 0, stride = 1;
+					for (auto row : rows[group])
+					{
+						choice += subscript[row]*stride;
+						stride *= dim_vector[row];
+					}
+
+					for (auto col : variable_cols_[group])
+						start_point(col) = block_solutions[group][choice](col);
+				}
+			}
+		}
+
+
+		std::vector<Vec<dbl>> MHomogeneous::GenerateStartPointsForPartition(dbl, size_t partition_index) const
+		{
+			std::vector<Vec<dbl>> start_points;
+			GenerateStartPointsForPartitionT(start_points, partition_index);
+			return start_points;
+		}
+
+
+		std::vector<Vec<mpfr_complex>> MHomogeneous::GenerateStartPointsForPartition(mpfr_complex, size_t partition_index) const
+		{
+			std::vector<Vec<mpfr_complex>> start_points;
+			GenerateStartPointsForPartitionT(start_points, partition_index);
+			return start_points;
 		}
 		
 		
@@ -442,7 +718,7 @@ namespace bertini
 		}
 
 
-		unsigned long long MHomogeneous::NumStartPointsForPartition(Vec<int> partition) const
+		unsigned long long MHomogeneous::NumStartPointsForPartition(Vec<int> const& partition) const
 		{
 			unsigned long long num_points = 1;
     			for(int ii = 0; ii < partition.size() ; ii++)
@@ -453,6 +729,124 @@ namespace bertini
 			return num_points;
 		}
 
+
+
+
+		unsigned long long MHomBezoutNumber(System const& s, std::vector<VariableGroup> const& groups)
+		{
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to compute m-homogeneous Bezout number of non-polynomial system");
+
+			Mat<int> degree_matrix(s.NumNaturalFunctions(), groups.size());
+			std::vector<size_t> group_sizes;
+			for (size_t col = 0; col < groups.size(); ++col)
+			{
+				auto degs = s.Degrees(groups[col]);
+				for (int row = 0; row < degree_matrix.rows(); ++row)
+					degree_matrix(row,col) = degs[row];
+				group_sizes.push_back(groups[col].size());
+			}
+
+			return MHomogeneous::CountStartPoints(degree_matrix, group_sizes);
+		}
+
+
+
+		std::vector<VariableGroup> LowestMHomBezoutGrouping(System const& s)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("attempting to regroup variables of system with homogeneous variable groups");
+
+			if (s.NumUngroupedVariables() > 0)
+				throw std::runtime_error("attempting to regroup variables of system with ungrouped variables");
+
+			// a grouping whose count overflows, or which admits no valid partitions, is no better than any other.
+			auto Count = [&s](std::vector<VariableGroup> const& groups)
+			{
+				unsigned long long count = 0;
+				try{
+					count = MHomBezoutNumber(s, groups);
+				}
+				catch (std::overflow_error const&)
+				{}
+
+				if (count==0)
+					return std::numeric_limits<unsigned long long>::max();
+				return count;
+			};
+
+			// local search, taking the first improvement found among moving one variable to another or a new group, and merging two groups.
+			auto Descend = [&Count](std::vector<VariableGroup> groups)
+			{
+				auto best_count = Count(groups);
+
+				auto TryCandidate = [&](std::vector<VariableGroup>& candidate)
+				{
+					auto count = Count(candidate);
+					if (count < best_count)
+					{
+						groups.swap(candidate);
+						best_count = count;
+						return true;
+					}
+					return false;
+				};
+
+				bool improved = true;
+				while (improved)
+				{
+					improved = false;
+
+					for (size_t from = 0; from < groups.size() && !improved; ++from)
+						for (size_t ii = 0; ii < groups[from].size() && !improved; ++ii)
+							for (size_t to = 0; to <= groups.size() && !improved; ++to)
+							{
+								if (to==from || (to==groups.size() && groups[from].size()==1))
+									continue;
+
+								auto candidate = groups;
+								auto v = candidate[from][ii];
+								if (to==candidate.size())
+									candidate.emplace_back();
+								candidate[to].push_back(v);
+								candidate[from].erase(candidate[from].begin()+ii);
+								if (candidate[from].empty())
+									candidate.erase(candidate.begin()+from);
+
+								improved = TryCandidate(candidate);
+							}
+
+					for (size_t first = 0; first < groups.size() && !improved; ++first)
+						for (size_t second = first+1; second < groups.size() && !improved; ++second)
+						{
+							auto candidate = groups;
+							candidate[first].insert(candidate[first].end(), candidate[second].begin(), candidate[second].end());
+							candidate.erase(candidate.begin()+second);
+
+							improved = TryCandidate(candidate);
+						}
+				}
+
+				return std::make_pair(groups, best_count);
+			};
+
+			VariableGroup all_variables;
+			for (auto const& g : s.VariableGroups())
+				all_variables.insert(all_variables.end(), g.begin(), g.end());
+
+			// start from both extremes, the total degree grouping and every variable on its own, and keep the better.
+			std::vector<VariableGroup> singletons;
+			for (auto const& v : all_variables)
+				singletons.push_back(VariableGroup{v});
+
+			auto from_one_group = Descend(std::vector<VariableGroup>{all_variables});
+			auto from_singletons = Descend(singletons);
+
+			auto best_groups = from_singletons.second < from_one_group.second ? from_singletons.first : from_one_group.first;
+
+			return best_groups;
+		}
+
 	} // namespace start_system
 
 } //namespace bertini
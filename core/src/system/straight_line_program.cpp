@@ -23,6 +23,9 @@
 // silviana amethyst, university of wisconsin eau claire
 // michael mumm, university of wisconsin eau claire
 
+#include <algorithm>
+#include <limits>
+
 #include "bertini2/system/straight_line_program.hpp"
 #include "bertini2/system/system.hpp"
 
@@ -219,6 +222,18 @@ namespace bertini{
 		if (is_evaluated_)
 			return;
 
+		EvalInMemory(memory);
+
+		is_evaluated_ = true;
+	}
+
+	template void StraightLineProgram::Eval<dbl_complex>() const;
+	template void StraightLineProgram::Eval<mpfr_complex>() const;
+
+
+	template<typename NumT>
+	void StraightLineProgram::EvalInMemory(std::vector<NumT> & memory) const{
+
 		for (int ii = 0; ii<instructions_.size();/*the increment is done at end of loop depending on arity */) {
 			//in the unary case the loop will increment by 3
 			//binary: by 4
@@ -307,12 +322,18 @@ namespace bertini{
 				ii = ii+4;
 			}
 		} // for loop around operations
-
-		is_evaluated_ = true;
 	}
 
-	template void StraightLineProgram::Eval<dbl_complex>() const;
-	template void StraightLineProgram::Eval<mpfr_complex>() const;
+	template void StraightLineProgram::EvalInMemory(std::vector<dbl_complex> &) const;
+	template void StraightLineProgram::EvalInMemory(std::vector<mpfr_complex> &) const;
+
+
+	StraightLineProgram::EvaluationContext StraightLineProgram::MakeContext() const{
+		EvaluationContext context;
+		context.Memory = memory_; // numbers included, at the current precision
+		context.WorkingPrecision = precision_;
+		return context;
+	}
 
 
 	template<typename NumT>
@@ -381,6 +402,225 @@ namespace bertini{
 	}
 
 
+	size_t SLPCompiler::LocationOf(Nd const& n){
+		if (this->locations_encountered_nodes_.find(n) == this->locations_encountered_nodes_.end())
+			n->Accept(*this);
+		return this->locations_encountered_nodes_[n];
+	}
+
+
+
+	// products of linears.
+	//
+	// the linears themselves are compiled once per source product, no matter how many of the
+	// terms of its derivative they appear in.  the derivative of a product of k linears
+	// has k terms, each a differential times a product of k-1 of the linears, and these
+	// come from prefix and suffix products at one multiplication each.
+	SLPCompiler::LinearProductLocations& SLPCompiler::CompileLinears(std::shared_ptr<const node::LinearProduct> const& source){
+
+		auto found = linear_products_.find(source);
+		if (found != linear_products_.end())
+			return found->second;
+
+		LinearProductLocations locations;
+
+		VariableGroup vars;
+		source->GetVariables(vars);
+		std::shared_ptr<node::Node> hom_var;
+		source->GetHomVariable(hom_var);
+
+		std::vector<size_t> var_locations;
+		for (auto const& v : vars)
+			var_locations.push_back(LocationOf(v));
+
+		// the homogenizing "variable" is the integer 1 until homogenized, or 0 for a homogeneous variable group
+		bool hom_is_variable = static_cast<bool>(std::dynamic_pointer_cast<node::Variable>(hom_var));
+		bool hom_is_zero = !hom_is_variable && hom_var->Eval<dbl>() == dbl(0);
+		bool hom_is_one = !hom_is_variable && hom_var->Eval<dbl>() == dbl(1);
+
+		const auto num_vars = source->NumVariables();
+		for (size_t ii{0}; ii < source->NumFactors(); ++ii)
+		{
+			std::vector<size_t> coefficient_locations;
+			for (size_t jj{0}; jj < num_vars + 1; ++jj)
+			{
+				if (jj==num_vars && hom_is_zero)
+				{
+					coefficient_locations.push_back(std::numeric_limits<size_t>::max());
+					continue;
+				}
+				slp_under_construction_.AddNumber(source->CoefficientAsNode(ii,jj), next_available_complex_);
+				coefficient_locations.push_back(next_available_complex_++);
+			}
+
+			// sum the terms of the linear
+			size_t prev_result_loc;
+			if (hom_is_zero)
+			{
+				slp_under_construction_.AddInstruction(Multiply, coefficient_locations[0], var_locations[0], next_available_complex_);
+				prev_result_loc = next_available_complex_++;
+			}
+			else if (hom_is_one)
+				prev_result_loc = coefficient_locations[num_vars];
+			else
+			{
+				slp_under_construction_.AddInstruction(Multiply, coefficient_locations[num_vars], LocationOf(hom_var), next_available_complex_);
+				prev_result_loc = next_available_complex_++;
+			}
+
+			for (size_t jj{hom_is_zero ? 1u : 0u}; jj < num_vars; ++jj)
+			{
+				slp_under_construction_.AddInstruction(Multiply, coefficient_locations[jj], var_locations[jj], next_available_complex_);
+				slp_under_construction_.AddInstruction(Add, prev_result_loc, next_available_complex_, next_available_complex_+1);
+				prev_result_loc = next_available_complex_+1;
+				next_available_complex_ += 2;
+			}
+
+			locations.coefficients.push_back(coefficient_locations);
+			locations.linears.push_back(prev_result_loc);
+		}
+
+		return linear_products_[source] = locations;
+	}
+
+
+
+	size_t SLPCompiler::ProductOfLinears(LinearProductLocations& locations, std::vector<size_t> const& factors){
+
+		const auto& linears = locations.linears;
+
+		if (factors.size()==1)
+			return linears[factors[0]];
+
+		if (factors.empty())
+		{
+			auto one = node::Integer::Make(1);
+			this->DealWithNumber(*one);
+			return locations_encountered_nodes_[one];
+		}
+
+		// each product is emitted once per source, however many derivatives it appears in
+		auto found = locations.products.find(factors);
+		if (found != locations.products.end())
+			return found->second;
+
+		return locations.products[factors] = MultiplyLinears(locations, factors);
+	}
+
+
+
+	size_t SLPCompiler::MultiplyLinears(LinearProductLocations& locations, std::vector<size_t> const& factors){
+
+		const auto& linears = locations.linears;
+		const auto num_factors = linears.size();
+
+		// the full product, or all but one of the factors, come from the prefix and suffix products
+		bool in_order = std::is_sorted(factors.begin(), factors.end());
+		if (in_order && (factors.size()==num_factors || factors.size()+1==num_factors))
+		{
+			auto& prefix = locations.prefix;
+			if (prefix.empty())
+			{
+				prefix.push_back(linears[0]);
+				for (size_t ii{1}; ii<num_factors; ++ii)
+				{
+					slp_under_construction_.AddInstruction(Multiply, prefix.back(), linears[ii], next_available_complex_);
+					prefix.push_back(next_available_complex_++);
+				}
+			}
+
+			if (factors.size()==num_factors)
+				return prefix.back();
+
+			// which factor is left out?
+			size_t omitted = num_factors-1;
+			for (size_t ii{0}; ii<factors.size(); ++ii)
+				if (factors[ii]!=ii)
+				{
+					omitted = ii;
+					break;
+				}
+
+			if (omitted==num_factors-1)
+				return prefix[num_factors-2];
+
+			auto& suffix = locations.suffix;
+			if (suffix.empty())
+			{
+				suffix.resize(num_factors);
+				suffix[num_factors-1] = linears[num_factors-1];
+				for (size_t ii{num_factors-1}; ii-- > 0; )
+				{
+					slp_under_construction_.AddInstruction(Multiply, linears[ii], suffix[ii+1], next_available_complex_);
+					suffix[ii] = next_available_complex_++;
+				}
+			}
+
+			if (omitted==0)
+				return suffix[1];
+
+			slp_under_construction_.AddInstruction(Multiply, prefix[omitted-1], suffix[omitted+1], next_available_complex_);
+			return next_available_complex_++;
+		}
+
+		// any other selection of factors is just multiplied out
+		size_t prev_result_loc = linears[factors[0]];
+		for (size_t ii{1}; ii<factors.size(); ++ii)
+		{
+			slp_under_construction_.AddInstruction(Multiply, prev_result_loc, linears[factors[ii]], next_available_complex_);
+			prev_result_loc = next_available_complex_++;
+		}
+		return prev_result_loc;
+	}
+
+
+
+	void SLPCompiler::Visit(node::LinearProduct const& n){
+		auto as_ptr = std::dynamic_pointer_cast<node::LinearProduct const>(n.shared_from_this());
+
+		auto& locations = CompileLinears(n.Source());
+		this->locations_encountered_nodes_[as_ptr] = ProductOfLinears(locations, n.SourceFactors());
+	}
+
+
+
+	void SLPCompiler::Visit(node::DiffLinear const& n){
+		auto as_ptr = std::dynamic_pointer_cast<node::DiffLinear const>(n.shared_from_this());
+
+		auto const& v = n.DiffVariable();
+		if (!v)
+			throw std::runtime_error("compiling differential of linear without a variable of differentiation.  differentiate with respect to a variable to compile into an SLP");
+
+		auto const& linear = n.Linear();
+		auto source = linear->Source();
+		auto& locations = CompileLinears(source);
+		auto factor = linear->SourceFactors()[0];
+
+		VariableGroup vars;
+		source->GetVariables(vars);
+		std::shared_ptr<node::Node> hom_var;
+		source->GetHomVariable(hom_var);
+
+		// the derivative of a linear is the coefficient of the variable, and was compiled with the linear.
+		size_t term;
+		auto where = std::find(vars.begin(), vars.end(), v);
+		if (where != vars.end())
+			term = where - vars.begin();
+		else if (v == hom_var)
+			term = source->NumVariables();
+		else
+		{
+			auto zero = node::Integer::Make(0);
+			this->DealWithNumber(*zero);
+			this->locations_encountered_nodes_[as_ptr] = locations_encountered_nodes_[zero];
+			return;
+		}
+
+		this->locations_encountered_nodes_[as_ptr] = locations.coefficients[factor][term];
+	}
+
+
+
 	void SLPCompiler::Visit(node::Jacobian const& n){
 		throw std::runtime_error("unimplemented visit to node of type Jacobian");
 
@@ -766,9 +1006,14 @@ namespace bertini{
 
 
 		
-			// make space for natural functions and derivatives.  we omit the patches.
+			// make space for natural functions and derivatives.  the patches go after the natural functions, if they are being compiled in.
 			// 3. ADD FUNCTIONS
-		slp_under_construction_.number_of_.Functions = sys.NumNaturalFunctions();
+		const auto num_natural_functions = sys.NumNaturalFunctions();
+		const auto num_patches = (sys.IsPatched() && sys.IsCompilingPatchesIntoSLP()) ? sys.NumPatches() : 0;
+		const auto num_functions = num_natural_functions + num_patches;
+
+		slp_under_construction_.number_of_.Functions = num_functions;
+		slp_under_construction_.number_of_.Patches = num_patches;
 		slp_under_construction_.output_locations_.Functions = next_available_complex_;
 		for (auto f: sys.GetNaturalFunctions())
 		{
@@ -786,21 +1031,28 @@ namespace bertini{
 
 
 		}
+		next_available_complex_ += num_patches; // the patch values, filled in by CompilePatches
 
 
 
 
 
 		
-		// always have space derivatives
+		// always have space derivatives.  the derivatives of the natural functions are column-major in ds_dx, and we lay them out column-major here too, with a gap at the bottom of each column for the rows of the patches.
 
 		auto ds_dx = sys.GetSpaceDerivatives(); // a linear object, so can just run down the object
-		slp_under_construction_.number_of_.Jacobian = ds_dx.size();
+		const auto num_variables = variable_ordering.size();
+		slp_under_construction_.number_of_.Jacobian = num_functions*num_variables;
 		slp_under_construction_.output_locations_.Jacobian = next_available_complex_;
-		for (auto n: ds_dx)
+		for (size_t jj{0}; jj<num_variables; ++jj)
 		{
-			locations_top_level_functions_and_derivatives_[n] = next_available_complex_; // don't increment yet, we're listing it a few places. this is for an optimization that elides a copy for assignment.
-			locations_encountered_nodes_[n] = next_available_complex_++;
+			for (size_t ii{0}; ii<num_natural_functions; ++ii)
+			{
+				auto const& n = ds_dx[ii+jj*num_natural_functions];
+				locations_top_level_functions_and_derivatives_[n] = next_available_complex_; // don't increment yet, we're listing it a few places. this is for an optimization that elides a copy for assignment.
+				locations_encountered_nodes_[n] = next_available_complex_++;
+			}
+			next_available_complex_ += num_patches;
 		}
 
 
@@ -810,13 +1062,14 @@ namespace bertini{
 		if (sys.HavePathVariable()) {
 			
 			auto ds_dt = sys.GetTimeDerivatives();  // a linear object, so can just run down the object
-			slp_under_construction_.number_of_.TimeDeriv = ds_dt.size();
+			slp_under_construction_.number_of_.TimeDeriv = num_functions;
 			slp_under_construction_.output_locations_.TimeDeriv = next_available_complex_; // note the start of the block in memory.  the size was also recorded in the previous line.
 			for (auto n: ds_dt)
 			{
 				locations_top_level_functions_and_derivatives_[n] = next_available_complex_; // don't increment yet, we're listing it a few places. this is for an optimization that elides a copy for assignment.
 				locations_encountered_nodes_[n] = next_available_complex_++;
 			}
+			next_available_complex_ += num_patches;
 		}
 
 
@@ -854,6 +1107,10 @@ namespace bertini{
 		}
 
 
+		if (num_patches > 0)
+			CompilePatches(sys);
+
+
 		// adjust the sizes of the memory blocks to match the number expected via compilation
 		slp_under_construction_.GetMemory<dbl_complex>().resize(next_available_complex_);
 		slp_under_construction_.GetMemory<mpfr_complex>().resize(next_available_complex_);
@@ -867,11 +1124,73 @@ namespace bertini{
 		return slp_under_construction_;
 	}
 
+	void SLPCompiler::CompilePatches(System const& sys){
+
+		auto patch = sys.GetPatch();
+		auto const& group_sizes = patch.VariableGroupSizes();
+		auto variable_ordering = sys.VariableOrdering();
+
+		auto const& number_of = slp_under_construction_.number_of_;
+		auto const& outputs = slp_under_construction_.output_locations_;
+		const auto num_natural_functions = number_of.Functions - number_of.Patches;
+
+		auto zero = Integer::Make(0);
+		auto minus_one = Integer::Make(-1);
+		this->DealWithNumber(*minus_one);
+		const auto location_minus_one = locations_encountered_nodes_[minus_one];
+
+		// the patch for group ii is  -1 + sum_j c_j x_j,  over the variables in the group, which are consecutive in the variable ordering.
+		size_t first_variable{0};
+		for (size_t ii{0}; ii<group_sizes.size(); ++ii)
+		{
+			const auto row = num_natural_functions + ii;
+			const auto last_variable = first_variable + group_sizes[ii];
+			auto const& coefficients = patch.Coefficients(ii);
+
+			size_t prev_result_loc = location_minus_one;
+			for (size_t jj{0}; jj<number_of.Variables; ++jj)
+			{
+				const auto location_derivative = outputs.Jacobian + row + jj*number_of.Functions;
+
+				if (jj < first_variable || jj >= last_variable)
+				{
+					slp_under_construction_.AddNumber(zero, location_derivative);
+					continue;
+				}
+
+				// the coefficient is the derivative, so it lives in the Jacobian, and is used from there.
+				slp_under_construction_.AddNumber(Float::Make(coefficients(jj-first_variable)), location_derivative);
+
+				slp_under_construction_.AddInstruction(Multiply, location_derivative, LocationOf(variable_ordering[jj]), next_available_complex_);
+				auto location_term = next_available_complex_++;
+
+				size_t location_sum;
+				if (jj+1 == last_variable)
+					location_sum = outputs.Functions + row;
+				else
+					location_sum = next_available_complex_++;
+
+				slp_under_construction_.AddInstruction(Add, prev_result_loc, location_term, location_sum);
+				prev_result_loc = location_sum;
+			}
+
+			// the patch doesn't move with time
+			if (slp_under_construction_.HavePathVariable())
+				slp_under_construction_.AddNumber(zero, outputs.TimeDeriv + row);
+
+			first_variable = last_variable;
+		}
+	}
+
+
+
 	void SLPCompiler::Clear(){
 		next_available_complex_ = 0;
 		next_available_int_ = 0;
 
 		locations_encountered_nodes_.clear();
+		locations_top_level_functions_and_derivatives_.clear();
+		linear_products_.clear();
 		slp_under_construction_ = SLP();
 	}
 
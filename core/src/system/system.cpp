@@ -53,6 +53,11 @@ namespace bertini
 		return true;
 	}
 
+	bool DefaultCompilePatchesIntoSLP()
+	{
+		return false;
+	}
+
 	void swap(System & a, System & b)
 	{
 		using std::swap;
@@ -85,6 +90,12 @@ namespace bertini
 
 		swap(a.assume_uniform_precision_,b.assume_uniform_precision_);
 		swap(a.eval_method_,b.eval_method_);
+		swap(a.deriv_method_,b.deriv_method_);
+		swap(a.auto_simplify_,b.auto_simplify_);
+		swap(a.compile_patches_into_slp_,b.compile_patches_into_slp_);
+		swap(a.slp_,b.slp_);
+		swap(a.sparse_,b.sparse_);
+		swap(a.simplification_stats_,b.simplification_stats_);
 
 		swap(a.precision_,b.precision_);
 		swap(a.is_patched_,b.is_patched_);
@@ -113,6 +124,12 @@ namespace bertini
 
 		assume_uniform_precision_ = other.assume_uniform_precision_;
 		eval_method_ = other.eval_method_;
+		deriv_method_ = other.deriv_method_;
+		auto_simplify_ = other.auto_simplify_;
+		compile_patches_into_slp_ = other.compile_patches_into_slp_;
+		slp_ = other.slp_;
+		sparse_ = other.sparse_;
+		simplification_stats_ = other.simplification_stats_;
 
 		time_order_of_variable_groups_ = other.time_order_of_variable_groups_;
 
@@ -288,6 +305,11 @@ namespace bertini
 					this->slp_.precision(new_precision);
 					break;					
 				}
+				case EvalMethod::SparsePolynomial:
+				{
+					this->sparse_.precision(new_precision);
+					break;
+				}
 			}
 			
 		}
@@ -322,6 +344,14 @@ namespace bertini
 
 	void System::Differentiate() const
 	{
+		if (eval_method_==EvalMethod::SparsePolynomial)
+		{
+			// the sparse form carries its own derivatives, so there is no need to differentiate the trees
+			this->sparse_ = SparsePolynomialSystem(*this);
+			is_differentiated_ = true;
+			return;
+		}
+
 		switch (deriv_method_){
 			case DerivMethod::JacobianNode:
 			{
@@ -347,6 +377,17 @@ namespace bertini
 			}
 			case EvalMethod::SLP:
 			{	
+				// structurally identical subexpressions become single nodes, which the compiler then emits once.  the nodes themselves are left alone, since copies of this system share them, so the derivatives are replaced by their representatives, and the handles given them as roots.
+				NodeFactory factory;
+				for (const auto& f : functions_)
+					factory.Intern(f);
+				for (auto& d : space_derivatives_)
+					d = factory.Intern(d);
+				for (auto& d : time_derivatives_)
+					d = factory.Intern(d);
+				for (const auto& j : jacobian_)
+					factory.Intern(j);
+
 				SLPCompiler compiler;
 				this->slp_ = compiler.Compile(*this);
 				break;
@@ -373,6 +414,9 @@ namespace bertini
 		const auto num_vars = NumVariables();
 		const auto num_functions = NumNaturalFunctions();
 
+		// one memo for all the (function, variable) pairs, so that subfunctions and other shared subexpressions are differentiated once per variable, and the derivatives share their structure.
+		DifferentiationMemo memo;
+
 		space_derivatives_.resize(num_functions*num_vars);
 		// again, computing these in column major, so staying with one variable at a time.
 		for (int jj = 0; jj < num_vars; ++jj)
@@ -392,7 +436,7 @@ namespace bertini
 
 	std::vector< Nd > System::GetSpaceDerivatives() const
 	{
-		if ( (deriv_method_==DerivMethod::JacobianNode) || (!is_differentiated_) )
+		if ( (deriv_method_==DerivMethod::JacobianNode) || (!is_differentiated_) || (eval_method_==EvalMethod::SparsePolynomial) )
 			DifferentiateUsingDerivatives();
 
 		return space_derivatives_;
@@ -400,7 +444,7 @@ namespace bertini
 
 	std::vector< Nd > System::GetTimeDerivatives() const
 	{
-		if ( (deriv_method_==DerivMethod::JacobianNode) || (!is_differentiated_) )
+		if ( (deriv_method_==DerivMethod::JacobianNode) || (!is_differentiated_) || (eval_method_==EvalMethod::SparsePolynomial) )
 			DifferentiateUsingDerivatives();
 		
 		return time_derivatives_;
@@ -905,6 +949,9 @@ namespace bertini
 		patch_ = Patch(VariableGroupSizesFIFO());
 
 		is_patched_ = true;
+
+		if (eval_method_==EvalMethod::SLP && compile_patches_into_slp_)
+			is_differentiated_ = false; // so the SLP is recompiled with the new patch
 	}
 
 
@@ -916,6 +963,9 @@ namespace bertini
 
 		this->patch_ = other.patch_;
 		is_patched_ = true;
+
+		if (eval_method_==EvalMethod::SLP && compile_patches_into_slp_)
+			is_differentiated_ = false; // so the SLP is recompiled with the new patch
 	}
 
 
@@ -1067,64 +1117,41 @@ namespace bertini
 
 	void System::SimplifyFunctions()
 	{
-		using bertini::Simplify;
+		// the handles are opaque to simplification, so simplify what they hold, and give them the result
+		Simplifier simplifier;
 		for (auto& iter : this->functions_)
-			Simplify(iter);
+			iter->SetRoot(simplifier.Simplify(iter->EntryNode()));
 	}
 
 
 
 	void System::SimplifyDerivatives() const
 	{
-		using bertini::Simplify;
+		// one simplifier for everything, since the derivatives share many subexpressions
+		Simplifier simplifier;
 
-		auto num_vars = this->NumVariables();
-		std::vector<dbl> old_vals(num_vars);  dbl old_path_var_val;
-
-		auto vars = this->Variables();
-		for (unsigned ii=0; ii<num_vars; ++ii)
+		// the handles themselves are opaque to simplification, so simplify the derivatives they hold, and give them the results.  a result may be another node entirely, such as a number.
+		auto simplify_root = [&simplifier](Handle & h)
 		{
-			old_vals[ii] = vars[ii]->Eval<dbl>();
-			vars[ii]->SetToRandUnit<dbl>();
-		}
-
-		if (HavePathVariable())
-		{
-			old_path_var_val = path_variable_->Eval<dbl>();
-			path_variable_->SetToRandUnit<dbl>();
-		}
-
-
-		for (const auto& n : jacobian_)
-			n->Reset();
-		for (const auto& n : space_derivatives_)
-			n->Reset();
-		for (const auto& n : time_derivatives_)
-			n->Reset();
-
-
+			h.SetRoot(simplifier.Simplify(h.EntryNode()));
+		};
 
 		switch (deriv_method_){
 			case DerivMethod::JacobianNode:{
 				for (auto& iter : this->jacobian_)
-					Simplify(iter);
+					simplify_root(*iter);
 				break;
 			}
 			case DerivMethod::Derivatives:{
 				for (auto& iter : this->space_derivatives_)
-					Simplify(iter);
+					simplify_root(dynamic_cast<Handle&>(*iter));
 				for (auto& iter : this->time_derivatives_)
-					Simplify(iter);
+					simplify_root(dynamic_cast<Handle&>(*iter));
 				break;
 			}
 		}
 
-		
-		for (unsigned ii=0; ii<num_vars; ++ii)
-			vars[ii]->set_current_value<dbl>(old_vals[ii]);
-		if (HavePathVariable())
-			path_variable_->set_current_value(old_path_var_val);
-
+		simplification_stats_ = simplifier.Statistics();
 
 		for (const auto& n : jacobian_)
 			n->Reset();
@@ -1132,7 +1159,6 @@ namespace bertini
 			n->Reset();
 		for (const auto& n : time_derivatives_)
 			n->Reset();
-
 	}
 
 
@@ -26,6 +26,7 @@
 
 #include "bertini2/blackbox/switches_zerodim.hpp"
 #include "bertini2/system/precon.hpp"
+#include "bertini2/io/system_cache.hpp"
 
 
 BOOST_AUTO_TEST_SUITE(blackbox_test)
@@ -57,6 +58,61 @@ BOOST_AUTO_TEST_CASE(make_zero_dim_nondefaults)
 	// zd_ptr->DefaultSetup();
 }
 
+
+BOOST_AUTO_TEST_CASE(make_zero_dim_uses_requested_endgame)
+{
+	auto sys = system::Precon::GriewankOsborn();
+	blackbox::ZeroDimRT my_runtime_type_options;
+	my_runtime_type_options.tracker = bertini::blackbox::type::Tracker::FixedDouble;
+	my_runtime_type_options.endgame = bertini::blackbox::type::Endgame::PowerSeries;
+	auto zd_ptr = blackbox::MakeZeroDim(my_runtime_type_options, sys);
+
+	using TrackerT = tracking::DoublePrecisionTracker;
+	using ExpectedT = algorithm::ZeroDim<TrackerT, endgame::EndgameSelector<TrackerT>::PSEG, System, start_system::TotalDegree, policy::CloneGiven>;
+	BOOST_CHECK(dynamic_cast<ExpectedT*>(zd_ptr.get()));
+}
+
+
+/**
+A solver given systems from a cache should have the same homotopy, start points included, as the one which stored them, and solve the same.
+*/
+BOOST_AUTO_TEST_CASE(make_zero_dim_uses_cached_systems)
+{
+	auto sys = system::Precon::GriewankOsborn();
+	blackbox::ZeroDimRT my_runtime_type_options;
+	my_runtime_type_options.tracker = bertini::blackbox::type::Tracker::FixedDouble;
+
+	using TrackerT = tracking::DoublePrecisionTracker;
+	using ExpectedT = algorithm::ZeroDim<TrackerT, endgame::EndgameSelector<TrackerT>::Cauchy, System, start_system::TotalDegree, policy::CloneGiven>;
+
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	SystemCache cache(directory);
+	auto key = SystemCache::Key("GriewankOsborn", "zero dim");
+
+	auto storing = blackbox::MakeZeroDim(my_runtime_type_options, sys);
+	storing->UseCachedSystems(cache, key);
+	BOOST_REQUIRE(cache.Contains(key));
+
+	auto loading = blackbox::MakeZeroDim(my_runtime_type_options, sys);
+	loading->UseCachedSystems(cache, key);
+
+	auto& stored = dynamic_cast<ExpectedT&>(*storing);
+	auto& loaded = dynamic_cast<ExpectedT&>(*loading);
+	BOOST_CHECK_EQUAL(loaded.NumPaths(), stored.NumPaths());
+
+	// the homotopies of separately constructed solvers have different random numbers, unless the systems came from the cache
+	Vec<dbl> x = Vec<dbl>::Random(stored.Homotopy().NumVariables());
+	dbl t(0.3, 0.1);
+	BOOST_CHECK_SMALL((loaded.Homotopy().Eval(x, t) - stored.Homotopy().Eval(x, t)).norm(), 1e-12);
+	BOOST_CHECK_SMALL((loaded.StartSystem().StartPoint<dbl>(1) - stored.StartSystem().StartPoint<dbl>(1)).norm(), 1e-12);
+
+	storing->Run();
+	loading->Run();
+	BOOST_CHECK_EQUAL(loading->NumSuccessfulPaths(), storing->NumSuccessfulPaths());
+
+	boost::filesystem::remove_all(directory);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // end the zerodim sub-suite
 
 BOOST_AUTO_TEST_SUITE_END() // end the blackbox suite
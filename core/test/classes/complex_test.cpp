@@ -560,6 +560,77 @@ BOOST_AUTO_TEST_CASE(complex_serialization)
 }
 
 
+BOOST_AUTO_TEST_CASE(complex_serialization_binary_is_exact)
+{
+	using mpfr_float = bertini::mpfr_float;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::mpfr_complex z(-acos(mpfr_float("-1")), 0);
+	bertini::mpfr_complex y(sqrt(mpfr_float("2")), mpfr_float("1e-300"));
+
+	{
+		std::ofstream fout("serialization_test_complex_binary", std::ios::binary);
+		boost::archive::binary_oarchive oa(fout);
+		oa << z << y;
+	}
+
+	DefaultPrecision(30);
+	bertini::mpfr_complex w, v;
+	{
+		std::ifstream fin("serialization_test_complex_binary", std::ios::binary);
+		boost::archive::binary_iarchive ia(fin);
+		ia >> w >> v;
+	}
+
+	BOOST_CHECK_EQUAL(w.precision(), z.precision());
+	BOOST_CHECK_EQUAL(real(z),real(w));
+	BOOST_CHECK_EQUAL(imag(z),imag(w));
+	BOOST_CHECK_EQUAL(real(y),real(v));
+	BOOST_CHECK_EQUAL(imag(y),imag(v));
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_CASE(complex_serialization_binary_special_values)
+{
+	using mpfr_float = bertini::mpfr_float;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	mpfr_float nan, neg_inf, neg_zero, tiny("-3e-1000");
+	mpfr_set_nan(nan.backend().data());
+	mpfr_set_inf(neg_inf.backend().data(), -1);
+	mpfr_set_zero(neg_zero.backend().data(), -1);
+
+	bertini::mpfr_complex z(nan, neg_inf);
+	bertini::mpfr_complex y(neg_zero, tiny);
+
+	{
+		std::ofstream fout("serialization_test_complex_binary_special", std::ios::binary);
+		boost::archive::binary_oarchive oa(fout);
+		oa << z << y;
+	}
+
+	DefaultPrecision(30);
+	bertini::mpfr_complex w, v;
+	{
+		std::ifstream fin("serialization_test_complex_binary_special", std::ios::binary);
+		boost::archive::binary_iarchive ia(fin);
+		ia >> w >> v;
+	}
+
+	BOOST_CHECK_EQUAL(w.precision(), z.precision());
+	BOOST_CHECK(mpfr_nan_p(real(w).backend().data()));
+	BOOST_CHECK(mpfr_inf_p(imag(w).backend().data()));
+	BOOST_CHECK(imag(w) < 0);
+	BOOST_CHECK(mpfr_zero_p(real(v).backend().data()));
+	BOOST_CHECK(mpfr_signbit(real(v).backend().data()));
+	BOOST_CHECK_EQUAL(imag(y),imag(v));
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
 
 
 
@@ -1060,5 +1060,37 @@ BOOST_AUTO_TEST_CASE(integer_power)
 }
 
 
+BOOST_AUTO_TEST_CASE(shared_subexpression_differentiated_once)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::shared_ptr<Variable> x = Variable::Make("x");
+	std::shared_ptr<Variable> y = Variable::Make("y");
+
+	auto s = x*y + sin(x);
+	auto f = pow(s,2) + exp(s) - s*y;
+
+	bertini::node::DifferentiationMemo memo;
+	auto ds = bertini::node::DifferentiationMemo::Derivative(s, x);
+	auto df = bertini::node::DifferentiationMemo::Derivative(f, x);
+
+	// within one memo, the shared subexpression's derivative is the very same node every time.
+	BOOST_CHECK(bertini::node::DifferentiationMemo::Derivative(s, x) == ds);
+	BOOST_CHECK(bertini::node::DifferentiationMemo::Derivative(f, x) == df);
+
+	// derivatives of constants short-circuit to zero.
+	BOOST_CHECK(bertini::node::IsZeroNumber(sin(bertini::node::Integer::Make(2))->Differentiate(x)));
+
+	dbl xval(0.3,-0.7), yval(-1.1,0.4);
+	x->set_current_value(xval);
+	y->set_current_value(yval);
+
+	dbl sval = xval*yval + sin(xval);
+	dbl dsval = yval + cos(xval);
+	dbl expected = 2.0*sval*dsval + exp(sval)*dsval - dsval*yval;
+
+	BOOST_CHECK(abs(df->Eval<dbl>() - expected) < threshold_clearance_d);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -32,6 +32,7 @@
 
 
 #include "bertini2/eigen_extensions.hpp"
+#include "bertini2/mpfr_lu.hpp"
 
 #include <Eigen/Dense>
 #include <Eigen/LU>
@@ -594,3 +595,132 @@ BOOST_AUTO_TEST_SUITE_END()
 	
 
 
+
+
+BOOST_AUTO_TEST_SUITE(mpfr_partial_piv_lu)
+
+using mpfr_complex = bertini::mpfr_complex;
+using mpfr_float = bertini::mpfr_float;
+template<typename T> using Mat = bertini::Mat<T>;
+template<typename T> using Vec = bertini::Vec<T>;
+
+	BOOST_AUTO_TEST_CASE(solve_matches_eigen)
+	{
+		bertini::DefaultPrecision(50);
+
+		unsigned size = 20;
+		Mat<mpfr_complex> A = bertini::RandomOfUnits<mpfr_complex>(size, size);
+		Vec<mpfr_complex> b = bertini::RandomOfUnits<mpfr_complex>(size);
+
+		bertini::MPFRPartialPivLU lu(A);
+		Vec<mpfr_complex> x = lu.solve(b);
+		Vec<mpfr_complex> y = A.lu().solve(b);
+
+		BOOST_CHECK((A*x - b).norm() < mpfr_float("1e-45"));
+		BOOST_CHECK((x - y).norm() < mpfr_float("1e-40"));
+		BOOST_CHECK_EQUAL(bertini::Precision(lu.matrixLU()), 50);
+		BOOST_CHECK(bertini::LUPartialPivotDecompositionSuccessful(lu.matrixLU())==bertini::MatrixSuccessCode::Success);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(adjoint_solve)
+	{
+		bertini::DefaultPrecision(50);
+
+		unsigned size = 15;
+		Mat<mpfr_complex> A = bertini::RandomOfUnits<mpfr_complex>(size, size);
+		Vec<mpfr_complex> b = bertini::RandomOfUnits<mpfr_complex>(size);
+
+		bertini::MPFRPartialPivLU lu(A);
+		Vec<mpfr_complex> x = b;
+		lu.AdjointSolveInPlace(x);
+
+		BOOST_CHECK((A.adjoint()*x - b).norm() < mpfr_float("1e-45"));
+	}
+
+
+	BOOST_AUTO_TEST_CASE(reused_for_new_matrix_in_higher_precision)
+	{
+		bertini::DefaultPrecision(30);
+		unsigned size = 8;
+		bertini::MPFRPartialPivLU lu(size);
+		lu.compute(bertini::RandomOfUnits<mpfr_complex>(size, size).eval());
+
+		bertini::DefaultPrecision(100);
+		Mat<mpfr_complex> A = bertini::RandomOfUnits<mpfr_complex>(size, size);
+		Vec<mpfr_complex> b = bertini::RandomOfUnits<mpfr_complex>(size);
+		lu.compute(A);
+
+		BOOST_CHECK_EQUAL(bertini::Precision(lu.matrixLU()), 100);
+		BOOST_CHECK((A*lu.solve(b) - b).norm() < mpfr_float("1e-95"));
+	}
+
+
+	BOOST_AUTO_TEST_CASE(singular_matrix_detected)
+	{
+		bertini::DefaultPrecision(50);
+
+		Mat<mpfr_complex> A(3,3);
+		A << mpfr_complex(1), mpfr_complex(2), mpfr_complex(3),
+		     mpfr_complex(2), mpfr_complex(4), mpfr_complex(6),
+		     mpfr_complex(0,1), mpfr_complex(1), mpfr_complex(1);
+
+		bertini::MPFRPartialPivLU lu(A);
+		BOOST_CHECK(bertini::LUPartialPivotDecompositionSuccessful(lu.matrixLU())!=bertini::MatrixSuccessCode::Success);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(condition_number_estimate)
+	{
+		bertini::DefaultPrecision(50);
+
+		unsigned size = 12;
+		Mat<mpfr_complex> A = bertini::RandomOfUnits<mpfr_complex>(size, size);
+		A.row(3) = A.row(5) + mpfr_complex("1e-20")*A.row(3); // nearly singular
+
+		auto one_norm = [](Mat<mpfr_complex> const& M)
+		{
+			double largest = 0;
+			for (unsigned jj = 0; jj < M.cols(); ++jj)
+			{
+				double sum = 0;
+				for (unsigned ii = 0; ii < M.rows(); ++ii)
+					sum += static_cast<double>(abs(M(ii,jj)));
+				largest = std::max(largest, sum);
+			}
+			return largest;
+		};
+
+		bertini::MPFRPartialPivLU lu(A);
+		double exact = one_norm(A.inverse());
+		double estimate = lu.InverseOneNormEstimate();
+
+		BOOST_CHECK(estimate <= exact*(1+1e-10));
+		BOOST_CHECK(estimate >= exact/3);
+		BOOST_CHECK_CLOSE(lu.OneNorm(), one_norm(A), 1e-10);
+		BOOST_CHECK_CLOSE(bertini::OneNorm(A), one_norm(A), 1e-10);
+		BOOST_CHECK_CLOSE(lu.ConditionNumberEstimate(), lu.OneNorm()*estimate, 1e-10);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(inverse_norm_estimate_double)
+	{
+		using dbl = std::complex<double>;
+		unsigned size = 12;
+		Mat<dbl> A = bertini::RandomOfUnits<dbl>(size, size);
+
+		auto one_norm = [](Mat<dbl> const& M)
+		{
+			return M.cwiseAbs().colwise().sum().maxCoeff();
+		};
+
+		Eigen::PartialPivLU<Mat<dbl>> lu(A);
+		double exact = one_norm(A.inverse());
+		double estimate = bertini::InverseOneNormEstimate(lu);
+
+		BOOST_CHECK(estimate <= exact*(1+1e-10));
+		BOOST_CHECK(estimate >= exact/3);
+		BOOST_CHECK_CLOSE(bertini::OneNorm(A), one_norm(A), 1e-10);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -788,9 +788,9 @@ dbl a(4.1203847861962345182734, -5.1234768951256847623781614314);
 dbl b(-8.98798649152356714919234, 0.49879892634876018735619234);
 x->set_current_value(a); y->set_current_value(b);
 
-	auto num_rounds = bertini::Simplify(r);
+	auto num_rewrites = bertini::Simplify(r);
 
-	BOOST_CHECK(num_rounds >= 2);
+	BOOST_CHECK(num_rewrites >= 2);
 
 
 	r->Reset();
@@ -805,12 +805,12 @@ BOOST_AUTO_TEST_CASE(complicated)
 
 	auto n = (((((2*x*1)*y)+(0*(pow(x,2))))/2)-(0*((pow(x,2))*y)/(pow(2,2))));
 
-	auto num_rounds = bertini::Simplify(n);
+	auto num_rewrites = bertini::Simplify(n);
 
 	auto a = x->Eval<dbl>();
 	auto b = y->Eval<dbl>();
 
-	BOOST_CHECK(num_rounds >= 2);
+	BOOST_CHECK(num_rewrites >= 2);
 	BOOST_CHECK_EQUAL(n->Eval<dbl>(), a*b);
 }
 
@@ -904,10 +904,164 @@ f->Reset();
 	BOOST_CHECK_EQUAL(init_val, f->Eval<dbl>());
 }
 
+
+
+BOOST_AUTO_TEST_CASE(folds_constants_and_collects_like_terms)
+{
+	auto x = Variable::Make("x");
+	auto y = Variable::Make("y");
+
+	dbl a(0.3, -1.2), b(-0.7, 0.4);
+	x->set_current_value(a); y->set_current_value(b);
+
+	// 2xy + 3xy + (4-1)x^2 x x  =  5xy + 3x^4
+	Nd f = 2*x*y + 3*(x*y) + (Integer::Make(4)-1)*pow(x,2)*x*x;
+
+	bertini::SimplificationStatistics stats;
+	auto num_rewrites = bertini::Simplify(f, stats);
+
+	BOOST_CHECK(num_rewrites > 0);
+	BOOST_CHECK(stats.constants_folded >= 1);
+	BOOST_CHECK(stats.terms_merged >= 1);
+	BOOST_CHECK(stats.factors_merged >= 2);
+
+	auto as_sum = std::dynamic_pointer_cast<SumOperator>(f);
+	BOOST_REQUIRE(as_sum);
+	BOOST_CHECK_EQUAL(as_sum->NumOperands(), 2);
+
+	f->Reset();
+	BOOST_CHECK_SMALL(abs(f->Eval<dbl>() - (5.*a*b + 3.*pow(a,4))), 1e-14);
+}
+
+
+BOOST_AUTO_TEST_CASE(simplifying_leaves_shared_nodes_alone)
+{
+	auto x = Variable::Make("x");
+	auto y = Variable::Make("y");
+
+	auto shared = x*1 + 0;
+	auto g = shared*y;
+	auto h = shared - x;
+
+	bertini::Simplifier simplifier;
+	auto g_simplified = simplifier.Simplify(g);
+
+	// g is x*y now, but what it was made of is as it was, as h uses it too
+	BOOST_CHECK(g_simplified!=g);
+	auto as_sum = std::dynamic_pointer_cast<SumOperator>(shared);
+	BOOST_REQUIRE(as_sum);
+	BOOST_CHECK_EQUAL(as_sum->NumOperands(), 2);
+	BOOST_CHECK(std::dynamic_pointer_cast<MultOperator>(g)->Operands()[0]==shared);
+
+	auto xval = x->Eval<dbl>();
+	auto yval = y->Eval<dbl>();
+	g_simplified->Reset(); h->Reset();
+	BOOST_CHECK_SMALL(abs(g_simplified->Eval<dbl>() - xval*yval), 1e-14);
+	BOOST_CHECK_SMALL(abs(h->Eval<dbl>()), 1e-14);
+}
+
+
+BOOST_AUTO_TEST_CASE(only_nonzero_constants_cancel)
+{
+	auto x = Variable::Make("x");
+	auto pi = bertini::node::Pi();
+
+	bertini::Simplifier simplifier;
+
+	// x/x is undefined at x=0, so isn't 1
+	auto x_over_x = std::dynamic_pointer_cast<MultOperator>(simplifier.Simplify(x/x));
+	BOOST_REQUIRE(x_over_x);
+	BOOST_CHECK_EQUAL(x_over_x->NumOperands(), 2);
+
+	// nor is (x^-1)^-1 just x
+	BOOST_CHECK(simplifier.Simplify(pow(pow(x,-1),-1))!=x);
+
+	// but pi/pi is
+	BOOST_CHECK(simplifier.Simplify(pi*x/pi)==x);
+}
+
+
+BOOST_AUTO_TEST_CASE(shared_subtrees_simplified_once)
+{
+	auto x = Variable::Make("x");
+	auto y = Variable::Make("y");
+
+	auto s = (x+y)*(x-y);
+	auto g1 = s + 1;
+	auto g2 = s*x;
+
+	bertini::Simplifier simplifier;
+	simplifier.SimplifyInPlace(g1);
+	auto num_visited = simplifier.Statistics().nodes_visited;
+
+	simplifier.SimplifyInPlace(g2);
+	BOOST_CHECK_EQUAL(simplifier.Statistics().nodes_visited, num_visited+1); // only the new root
+
+	auto xval = x->Eval<dbl>();
+	auto yval = y->Eval<dbl>();
+	g1->Reset(); g2->Reset();
+	BOOST_CHECK_SMALL(abs(g1->Eval<dbl>() - ((xval+yval)*(xval-yval)+1.)), 1e-14);
+	BOOST_CHECK_SMALL(abs(g2->Eval<dbl>() - ((xval+yval)*(xval-yval)*xval)), 1e-14);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // simplify
 
 
 
+BOOST_AUTO_TEST_SUITE(intern)
+
+BOOST_AUTO_TEST_CASE(identical_subtrees_become_one_node)
+{
+	auto x = Variable::Make("x");
+	auto y = Variable::Make("y");
+
+	Nd a = (x*y+2)*sin(x*y+2);
+	Nd b = pow(x*y+2,2) - exp(sin(x*y+2));
+
+	x->set_current_value(dbl(0.3,-1.2));
+	y->set_current_value(dbl(-0.7,0.5));
+	auto a_val = a->Eval<dbl>();
+	auto b_val = b->Eval<dbl>();
+
+	bertini::node::NodeFactory factory;
+	auto a_interned = factory.Intern(a);
+	auto b_interned = factory.Intern(b);
+	BOOST_CHECK(factory.NumDistinct() < factory.NumSeen());
+
+	auto a_mult = std::dynamic_pointer_cast<MultOperator>(a_interned);
+	auto a_sin = std::dynamic_pointer_cast<bertini::node::UnaryOperator>(a_mult->Operands()[1]);
+	BOOST_CHECK(a_mult->Operands()[0] == a_sin->Operand());
+
+	// the trees themselves are left as they were, since they may be shared
+	BOOST_CHECK(a_interned != a);
+	auto original_mult = std::dynamic_pointer_cast<MultOperator>(a);
+	auto original_sin = std::dynamic_pointer_cast<bertini::node::UnaryOperator>(original_mult->Operands()[1]);
+	BOOST_CHECK(original_mult->Operands()[0] != original_sin->Operand());
+
+	// the same structure made anew interns to the existing representative
+	BOOST_CHECK(factory.Intern(x*y+2) == a_mult->Operands()[0]);
+	BOOST_CHECK(factory.Make<bertini::node::SinOperator>(x*y+2) == a_mult->Operands()[1]);
+
+	// numbers are compared by value
+	BOOST_CHECK(factory.Intern(Integer::Make(7)) == factory.Intern(Integer::Make(7)));
+	BOOST_CHECK(factory.Intern(Integer::Make(7)) != factory.Intern(Integer::Make(8)));
+
+	// but distinct variables are never merged
+	auto z = Variable::Make("x");
+	BOOST_CHECK(factory.Intern(z) != Nd(x));
+
+	a->Reset();
+	a_interned->Reset();
+	b_interned->Reset();
+	BOOST_CHECK_EQUAL(a_val, a->Eval<dbl>());
+	BOOST_CHECK_EQUAL(a_val, a_interned->Eval<dbl>());
+	BOOST_CHECK_EQUAL(b_val, b_interned->Eval<dbl>());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // intern
+
+
+
 BOOST_AUTO_TEST_SUITE_END() // transform
 BOOST_AUTO_TEST_SUITE_END() // function_tree
 
@@ -214,6 +214,61 @@ BOOST_AUTO_TEST_CASE(Two_var_groups_4_vars_4_fctns_example)
 
 }
 
+BOOST_AUTO_TEST_CASE(start_points_for_partition_match_indexed_start_points)
+{
+	//  	variable groups {x1,x2}, {x3,x4}
+	// 		f1 = x1^2 + x4
+	//  	f2 = x1*x2*x3
+	//  	f3 = x4^2 
+	//  	f4 = x3^2
+	//		Number of paths: 16, spread over several partitions.
+	//		The batched start points for each partition must coincide with the individually generated ones,
+	//		and must be roots of the start system.
+ 	auto x1 = Variable::Make("x1");
+	auto x2 = Variable::Make("x2");
+	auto x3 = Variable::Make("x3");
+	auto x4 = Variable::Make("x4");
+
+	System sys;
+
+	VariableGroup v1{x1,x2};
+	VariableGroup v2{x3,x4};
+
+	sys.AddVariableGroup(v1);
+	sys.AddVariableGroup(v2);
+
+	sys.AddFunction(pow(x1,2) + x4);
+	sys.AddFunction(x1*x2*x3);
+	sys.AddFunction(pow(x4,2));
+	sys.AddFunction(pow(x3,2));
+
+	auto mhom_start_system = bertini::start_system::MHomogeneous(sys);
+
+	BOOST_CHECK_EQUAL(mhom_start_system.PartitionOffset(0), 0);
+	BOOST_CHECK_EQUAL(mhom_start_system.PartitionOffset(mhom_start_system.NumPartitions()), mhom_start_system.NumStartPoints());
+	BOOST_CHECK_THROW(mhom_start_system.PartitionContaining(mhom_start_system.NumStartPoints()), std::out_of_range);
+
+	for (size_t ii = 0; ii < mhom_start_system.NumPartitions(); ++ii)
+	{
+		auto offset = mhom_start_system.PartitionOffset(ii);
+		auto batch = mhom_start_system.StartPointsForPartition<dbl>(ii);
+
+		BOOST_CHECK_EQUAL(batch.size(), mhom_start_system.PartitionOffset(ii+1) - offset);
+
+		for (size_t jj = 0; jj < batch.size(); ++jj)
+		{
+			BOOST_CHECK_EQUAL(mhom_start_system.PartitionContaining(offset+jj), ii);
+
+			auto start = mhom_start_system.StartPoint<dbl>(offset+jj);
+			BOOST_CHECK((batch[jj] - start).norm() < relaxed_threshold_clearance_d);
+
+			auto function_values = mhom_start_system.Eval(batch[jj]);
+			for (decltype(function_values.size()) kk = 0; kk < function_values.size(); ++kk)
+				BOOST_CHECK(abs(function_values(kk)) < 1e-10);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(four_var_groups_4_vars_4_fctns_example)
 {
 	//	Basic problem from Dan Bates 
@@ -277,6 +332,78 @@ BOOST_AUTO_TEST_CASE(four_var_groups_4_vars_4_fctns_example)
 
 }
 
+BOOST_AUTO_TEST_CASE(count_start_points_without_enumerating_partitions)
+{
+	//  	Degree matrix, with group sizes {2,1,1}
+	//  	[2 0 1]
+	//		[2 1 0]
+	//		[1 0 2]
+	//		[1 2 0]
+	//		the count must agree with the sum over the enumerated partitions, however many threads enumerate them.
+ 	auto x1 = Variable::Make("x1");
+	auto x2 = Variable::Make("x2");
+	auto x3 = Variable::Make("x3");
+	auto x4 = Variable::Make("x4");
+
+	System sys;
+
+	VariableGroup v1{x1,x2};
+	VariableGroup v2{x3};
+	VariableGroup v3{x4};
+
+	sys.AddVariableGroup(v1);
+	sys.AddVariableGroup(v2);
+	sys.AddVariableGroup(v3);
+
+	sys.AddFunction(pow(x1,2) + x4);
+	sys.AddFunction(x1*x2*x3);
+	sys.AddFunction(pow(x4,2)*x2);
+	sys.AddFunction(pow(x3,2)*x1);
+
+	auto mhom_start_system = bertini::start_system::MHomogeneous(sys);
+
+	auto count = MHomogeneous::CountStartPoints(mhom_start_system.degree_matrix_, {2,1,1});
+	BOOST_CHECK_EQUAL(count, mhom_start_system.NumStartPoints());
+	BOOST_CHECK_EQUAL(MHomBezoutNumber(sys, {v1,v2,v3}), mhom_start_system.NumStartPoints());
+
+	auto serial_partitions = mhom_start_system.valid_partitions_;
+	mhom_start_system.GenerateValidPartitions(sys, 4);
+
+	BOOST_CHECK_EQUAL(mhom_start_system.valid_partitions_.size(), serial_partitions.size());
+	for (size_t ii = 0; ii < serial_partitions.size(); ++ii)
+		BOOST_CHECK(mhom_start_system.valid_partitions_[ii] == serial_partitions[ii]);
+	BOOST_CHECK_EQUAL(count, mhom_start_system.NumStartPoints());
+}
+
+
+BOOST_AUTO_TEST_CASE(lowest_bezout_grouping_of_bilinear_system)
+{
+	//	four functions, each bilinear in {x1,x2} and {y1,y2}.
+	//	total degree is 2^4 = 16, but the 2-homogeneous Bezout number is 4 choose 2 = 6.
+ 	auto x1 = Variable::Make("x1");
+	auto x2 = Variable::Make("x2");
+	auto y1 = Variable::Make("y1");
+	auto y2 = Variable::Make("y2");
+
+	System sys;
+
+	VariableGroup v{x1,x2,y1,y2};
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x1*y1 + x2*y2 - 1);
+	sys.AddFunction(x1*y2 + 2*x2*y1 + x1 - 3);
+	sys.AddFunction(x2*y2 + x1*y1*3 + y1 + 1);
+	sys.AddFunction(x1*y1 - x2*y2 + x2 + y2);
+
+	BOOST_CHECK_EQUAL(MHomBezoutNumber(sys, {v}), 16);
+
+	auto groups = LowestMHomBezoutGrouping(sys);
+
+	BOOST_CHECK_EQUAL(groups.size(), 2);
+	BOOST_CHECK_EQUAL(MHomBezoutNumber(sys, groups), 6);
+}
+
+
 BOOST_AUTO_TEST_CASE(one_var_group_4_vars_4_fctns_example)
 {
 	//	Basic problem from Dan Bates 
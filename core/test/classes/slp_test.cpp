@@ -297,4 +297,255 @@ BOOST_AUTO_TEST_CASE(evaluate_three_variable_system)
 
 
 
+// m-homogeneous start systems are made of products of linears, whose derivatives share all but one factor.
+BOOST_AUTO_TEST_CASE(evaluate_m_hom_start_system_matches_function_tree)
+{
+	using bertini::VariableGroup;
+
+	auto x1 = Variable::Make("x1");
+	auto x2 = Variable::Make("x2");
+	auto y1 = Variable::Make("y1");
+	auto y2 = Variable::Make("y2");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y1,y2});
+
+	sys.AddFunction(pow(x1,2)*y1 + x2*y2 - 1);
+	sys.AddFunction(x1*pow(y2,2) + x2 - 2);
+	sys.AddFunction(x1*x2*y1*y2 - 3);
+	sys.AddFunction(pow(x2,3) + y1 - 4);
+
+	auto mhom = bertini::start_system::MHomogeneous(sys);
+	mhom.SetEvalMethod(bertini::EvalMethod::SLP);
+	mhom.SetDerivMethod(bertini::DerivMethod::Derivatives);
+
+	bertini::System tree = mhom;
+	tree.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+
+	Vec<dbl> values(4);
+	values << dbl(0.3,-0.2), dbl(1.1,0.4), dbl(-0.7,0.5), dbl(0.2,0.9);
+
+	Vec<dbl> f_slp = mhom.Eval(values);
+	Mat<dbl> J_slp = mhom.Jacobian(values);
+
+	Vec<dbl> f_tree = tree.Eval(values);
+	Mat<dbl> J_tree = tree.Jacobian(values);
+
+	BOOST_REQUIRE_EQUAL(f_slp.size(), f_tree.size());
+	for (int ii = 0; ii < f_slp.size(); ++ii)
+		BOOST_CHECK_SMALL(abs(f_slp(ii) - f_tree(ii)), 1e-13);
+
+	// the derivatives should also agree with a finite difference of the functions
+	double h = 1e-7;
+	BOOST_REQUIRE_EQUAL(J_slp.rows(), J_tree.rows());
+	BOOST_REQUIRE_EQUAL(J_slp.cols(), J_tree.cols());
+	for (int jj = 0; jj < J_slp.cols(); ++jj)
+	{
+		Vec<dbl> shifted = values;
+		shifted(jj) += h;
+		Vec<dbl> fd = (tree.Eval(shifted) - f_tree) / h;
+
+		for (int ii = 0; ii < J_slp.rows(); ++ii)
+		{
+			BOOST_CHECK_SMALL(abs(J_slp(ii,jj) - J_tree(ii,jj)), 1e-13);
+			BOOST_CHECK_SMALL(abs(J_slp(ii,jj) - fd(ii)), 1e-5);
+		}
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(patches_compiled_into_slp)
+{
+	std::string str = "function f, g; variable_group x, y; f = x^2+y^2-1; g = x*y-2;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	BOOST_CHECK(!sys.IsCompilingPatchesIntoSLP()); // opt in only
+	sys.SetCompilePatchesIntoSLP(true);
+
+	bertini::System separate = sys;
+	separate.SetCompilePatchesIntoSLP(false);
+
+	Vec<dbl> values(3);
+	values << dbl(0.4,0.1), dbl(-1.3,0.7), dbl(0.8,-0.2);
+
+	Vec<dbl> f = sys.Eval(values);
+	Mat<dbl> J = sys.Jacobian(values);
+
+	Vec<dbl> f_separate = separate.Eval(values);
+	Mat<dbl> J_separate = separate.Jacobian(values);
+
+	auto slp = SLP(sys);
+	BOOST_CHECK_EQUAL(slp.NumFunctions(), sys.NumTotalFunctions());
+	BOOST_CHECK_EQUAL(slp.NumPatches(), sys.NumPatches());
+
+	BOOST_REQUIRE_EQUAL(f.size(), 3);
+	BOOST_REQUIRE_EQUAL(J.rows(), 3);
+	BOOST_REQUIRE_EQUAL(J.cols(), 3);
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_separate(ii)), 1e-14);
+		for (int jj = 0; jj < 3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_separate(ii,jj)), 1e-14);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(views_match_copied_outputs)
+{
+	auto homotopy = HomotopyTotalDegreeTestSystem();
+
+	bertini::System tree = homotopy;
+	tree.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+
+	Vec<dbl> values(homotopy.NumVariables());
+	for (int ii = 0; ii < values.size(); ++ii)
+		values(ii) = dbl(0.1*ii+0.3, -0.2*ii+0.1);
+	dbl t(0.4,0.1);
+
+	for (auto const* sys : {&homotopy, &tree})
+	{
+		Vec<dbl> f = sys->Eval(values, t);
+		Mat<dbl> J = sys->Jacobian(values, t);
+		Vec<dbl> dt = sys->TimeDerivative(values, t);
+
+		sys->SetAndReset(values, t);
+		auto f_view = sys->FunctionValuesView<dbl>();
+		auto J_view = sys->JacobianView<dbl>();
+		auto dt_view = sys->TimeDerivativeView<dbl>();
+
+		BOOST_REQUIRE_EQUAL(J_view.rows(), J.rows());
+		BOOST_REQUIRE_EQUAL(J_view.cols(), J.cols());
+		BOOST_CHECK_SMALL((f_view - f).norm(), 1e-14);
+		BOOST_CHECK_SMALL((J_view - J).norm(), 1e-14);
+		BOOST_CHECK_SMALL((dt_view - dt).norm(), 1e-14);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(evaluation_contexts_are_independent)
+{
+	auto homotopy = HomotopyTotalDegreeTestSystem();
+	BOOST_CHECK(!homotopy.SupportsEvaluationContexts()); // it's patched, and by default the patches are evaluated separately
+	homotopy.SetCompilePatchesIntoSLP(true);
+
+	Vec<dbl> values_a(homotopy.NumVariables()), values_b(homotopy.NumVariables());
+	for (int ii = 0; ii < values_a.size(); ++ii)
+	{
+		values_a(ii) = dbl(0.1*ii+0.3, -0.2*ii+0.1);
+		values_b(ii) = dbl(-0.4*ii+0.2, 0.3*ii-0.5);
+	}
+	dbl t_a(0.4,0.1), t_b(0.7,-0.2);
+
+	Vec<dbl> f_a = homotopy.Eval(values_a, t_a);
+	Mat<dbl> J_a = homotopy.Jacobian(values_a, t_a);
+	Vec<dbl> f_b = homotopy.Eval(values_b, t_b);
+	Mat<dbl> J_b = homotopy.Jacobian(values_b, t_b);
+	Vec<dbl> dt_b = homotopy.TimeDerivative(values_b, t_b);
+
+	BOOST_REQUIRE(homotopy.SupportsEvaluationContexts());
+	auto context_a = homotopy.MakeEvaluationContext();
+	auto context_b = homotopy.MakeEvaluationContext();
+
+	BOOST_CHECK_THROW(homotopy.FunctionValuesView<dbl>(context_a), std::runtime_error);
+
+	homotopy.Evaluate(context_a, values_a, t_a);
+	homotopy.Evaluate(context_b, values_b, t_b);
+
+	// the system's own memory is untouched by evaluating through contexts
+	BOOST_CHECK_SMALL((homotopy.FunctionValuesView<dbl>() - f_b).norm(), 1e-14);
+
+	BOOST_CHECK_SMALL((homotopy.FunctionValuesView<dbl>(context_a) - f_a).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.JacobianView<dbl>(context_a) - J_a).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.FunctionValuesView<dbl>(context_b) - f_b).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.JacobianView<dbl>(context_b) - J_b).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.TimeDerivativeView<dbl>(context_b) - dt_b).norm(), 1e-14);
+}
+
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_matches_function_tree)
+{
+	std::string str = "function f1, f2, f3, f4; variable_group u0, u1, u2, u3; "
+		"f1 = u0 + 2*u1 + 2*u2 + 2*u3 - 1; "
+		"f2 = u0^2 + 2*u1^2 + 2*u2^2 + 2*u3^2 - u0; "
+		"f3 = 2*u0*u1 + 2*u1*u2 + 2*u2*u3 - u1; "
+		"f4 = u1^2 + 2*u0*u2 + 2*u1*u3 - u2;";
+
+	bertini::System katsura;
+	bertini::parsing::classic::parse(str.begin(), str.end(), katsura);
+
+	auto homotopy = HomotopyTotalDegreeTestSystem();
+
+	Vec<dbl> x(4);
+	x << dbl(0.3,-0.2), dbl(-0.7,0.1), dbl(0.25,0.5), dbl(1.1,-0.4);
+	Vec<dbl> values(homotopy.NumVariables());
+	for (int ii = 0; ii < values.size(); ++ii)
+		values(ii) = dbl(0.1*ii+0.3, -0.2*ii+0.1);
+	dbl t(0.4,0.1);
+
+	bertini::System katsura_tree = katsura, homotopy_tree = homotopy;
+	katsura_tree.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+	homotopy_tree.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+	katsura.SetEvalMethod(bertini::EvalMethod::SparsePolynomial);
+	homotopy.SetEvalMethod(bertini::EvalMethod::SparsePolynomial);
+
+	BOOST_CHECK_SMALL((katsura.Eval(x) - katsura_tree.Eval(x)).norm(), 1e-14);
+	BOOST_CHECK_SMALL((katsura.Jacobian(x) - katsura_tree.Jacobian(x)).norm(), 1e-14);
+
+	BOOST_CHECK_SMALL((homotopy.Eval(values, t) - homotopy_tree.Eval(values, t)).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.Jacobian(values, t) - homotopy_tree.Jacobian(values, t)).norm(), 1e-14);
+	BOOST_CHECK_SMALL((homotopy.TimeDerivative(values, t) - homotopy_tree.TimeDerivative(values, t)).norm(), 1e-14);
+
+	bertini::SparsePolynomialSystem sparse(katsura);
+	BOOST_CHECK_EQUAL(sparse.NumFunctions(), 4);
+	BOOST_CHECK_EQUAL(sparse.NumTerms(), 5+5+4+4);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_keeps_precisions_apart)
+{
+	std::string str = "function f, g; variable_group x, y; f = x^2+y^2-1; g = x*y-2;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	bertini::SparsePolynomialSystem sparse(sys);
+
+	Vec<dbl> x_d(2);
+	x_d << dbl(0.4,0.1), dbl(-1.3,0.7);
+	Vec<bertini::mpfr_complex> x_mp(2);
+	x_mp << bertini::mpfr_complex(2,-1), bertini::mpfr_complex(0.5,3);
+
+	sparse.SetVariableValues(x_mp);
+	sparse.SetVariableValues(x_d);
+
+	Vec<dbl> f_d(2);
+	sparse.GetFuncValsInPlace(f_d);
+
+	// evaluating in double must not pass for evaluating in multiple precision
+	Vec<bertini::mpfr_complex> f_mp(2);
+	sparse.GetFuncValsInPlace(f_mp);
+
+	Vec<bertini::mpfr_complex> expected = sys.Eval(x_mp);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK_SMALL(static_cast<double>(abs(f_mp(ii) - expected(ii))), 1e-14);
+	BOOST_CHECK_SMALL((f_d - sys.Eval(x_d)).norm(), 1e-14);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_rejects_non_polynomials)
+{
+	std::string str = "function f; variable_group x; f = sin(x) + x;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	BOOST_CHECK_THROW(bertini::SparsePolynomialSystem{sys}, std::runtime_error);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
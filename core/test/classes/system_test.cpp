@@ -35,9 +35,13 @@
 
 
 
+#include <sstream>
+
 #include "bertini2/system/system.hpp"
 #include "bertini2/system/precon.hpp"
 #include "bertini2/io/parsing/system_parsers.hpp"
+#include "bertini2/io/parsing/fast_system_parser.hpp"
+#include "bertini2/io/system_cache.hpp"
 
 #include "externs.hpp"
 
@@ -154,6 +158,116 @@ BOOST_AUTO_TEST_CASE(system_parse_around_the_unit_circle_alt)
 
 
 
+/**
+\class bertini::System
+\test \b system_fast_parser_agrees_with_qi Parses the same input with the recursive-descent parser and the Qi grammar, and checks the two systems evaluate the same.
+*/
+BOOST_AUTO_TEST_CASE(system_fast_parser_agrees_with_qi)
+{
+	std::string str =
+ "variable_group x, y;\n variable z;\n function f1, f2, f3;\n pathvariable t;\n parameter p;\n constant c;\n"
+ "c = 1.25e-1;\n p = exp(2*Pi*I*(1-t));\n"
+ "s = x*y - z/3 + 0.5;\n"
+ "f1 = -x^2 + y*s - 2^3*z + sqrt(x+1) - c;\n"
+ "f2 = p*(x - y)^2 / (1 + z) - -y + cos(x)*sin(y) - tan(z)*log(x+2);\n"
+ "f3 = 12345678901234*x - y^-2 + s^2^2 + 1.5*p - 3;\n";
+
+	bertini::System qi_sys;
+	bool s = bertini::parsing::classic::parse(str.begin(), str.end(), qi_sys);
+	BOOST_CHECK(s);
+
+	auto fast_sys = bertini::parsing::classic::FastSystemParser(2).Parse(str);
+
+	BOOST_CHECK_EQUAL(fast_sys.NumNaturalFunctions(), qi_sys.NumNaturalFunctions());
+	BOOST_CHECK_EQUAL(fast_sys.NumVariables(), qi_sys.NumVariables());
+	BOOST_CHECK_EQUAL(fast_sys.NumVariableGroups(), qi_sys.NumVariableGroups());
+	BOOST_CHECK(fast_sys.HavePathVariable());
+
+	Vec<dbl> values(3);
+	values << dbl(0.3,0.2), dbl(-0.7,0.4), dbl(1.1,-0.5);
+	dbl t(0.4,0.1);
+
+	Vec<dbl> fast_values = fast_sys.Eval(values, t);
+	Vec<dbl> qi_values = qi_sys.Eval(values, t);
+	for (int ii = 0; ii < 3; ++ii)
+		BOOST_CHECK(abs(fast_values(ii) - qi_values(ii)) < relaxed_threshold_clearance_d*(1+abs(qi_values(ii))));
+
+	Mat<dbl> fast_jac = fast_sys.Jacobian(values, t);
+	Mat<dbl> qi_jac = qi_sys.Jacobian(values, t);
+	BOOST_CHECK((fast_jac - qi_jac).norm() < relaxed_threshold_clearance_d*(1+qi_jac.norm()));
+}
+
+
+/**
+\class bertini::System
+\test \b system_parse_unary_minus_binds_to_factor Checks that unary minus applies only to the following factor, in both parsers.
+*/
+BOOST_AUTO_TEST_CASE(system_parse_unary_minus_binds_to_factor)
+{
+	std::string str = "variable_group x, y; function f, g; f = -x+y; g = -2^2*x;";
+
+	bertini::System qi_sys;
+	bool s = bertini::parsing::classic::parse(str.begin(), str.end(), qi_sys);
+	BOOST_CHECK(s);
+
+	auto fast_sys = bertini::parsing::classic::FastSystemParser(1).Parse(str);
+
+	Vec<dbl> values(2);
+	values << dbl(1.0), dbl(2.0);
+
+	for (auto const& sys : {qi_sys, fast_sys})
+	{
+		Vec<dbl> v = sys.Eval(values);
+		BOOST_CHECK(abs(v(0) - dbl(1.0)) < relaxed_threshold_clearance_d);
+		BOOST_CHECK(abs(v(1) - dbl(-4.0)) < relaxed_threshold_clearance_d);
+	}
+}
+
+
+/**
+\class bertini::System
+\test \b system_fast_parser_rejects_malformed_input Checks the recursive-descent parser throws on undeclared and out-of-order symbols, bad numbers, and missing semicolons.
+*/
+BOOST_AUTO_TEST_CASE(system_fast_parser_rejects_malformed_input)
+{
+	bertini::parsing::classic::FastSystemParser parser;
+
+	BOOST_CHECK_THROW(parser.Parse("variable x, y; function f; f = xy;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("function f; f = x; variable x;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x; function f; f = 2x;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x; function f; f = x^2"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x; function f; f = (x+1;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x, x;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x; x = 2;"), std::runtime_error);
+	BOOST_CHECK_THROW(parser.Parse("variable x; function f; f = f + x;"), std::runtime_error);
+}
+
+
+/**
+\class bertini::System
+\test \b system_fast_parser_parses_input_section_of_file Checks that parsing a file parses only its input section.
+*/
+BOOST_AUTO_TEST_CASE(system_fast_parser_parses_input_section_of_file)
+{
+	auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	{
+		std::ofstream out(path.string());
+		out << "% an input file\nCONFIG\ntracktype: 0;\nEND;\nINPUT\nvariable_group x;\nfunction f;\nf = x^2 - 1; % END;\nEND;\n";
+	}
+
+	auto sys = bertini::parsing::classic::FastSystemParser().ParseFile(path);
+	boost::filesystem::remove(path);
+
+	BOOST_CHECK_EQUAL(sys.NumNaturalFunctions(), 1);
+	BOOST_CHECK_EQUAL(sys.NumVariables(), 1);
+
+	Vec<dbl> values(1);
+	values << dbl(3.0);
+	BOOST_CHECK_EQUAL(sys.Eval(values)(0), dbl(8.0));
+}
+
+
+
 //TODO: uncomment this test once error handling has been done for the parsers.
 // BOOST_AUTO_TEST_CASE(system_parse_x_y_not_xy)
 // {
@@ -1073,6 +1187,269 @@ BOOST_AUTO_TEST_CASE(clone_system_new_variables_evaluation)
 	BOOST_CHECK_EQUAL(f_clone2,f2);
 }
 
+
+/**
+\class bertini::SystemCache
+\test \b system_cache_round_trip Stores a differentiated system in the cache, and checks the loaded one evaluates the same, and that keys depend on both input and settings.
+*/
+BOOST_AUTO_TEST_CASE(system_cache_round_trip)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::string input = "variable_group x, y; function f1, f2; f1 = x^2*y - 1.5; f2 = x*y + sin(y);";
+	auto key = SystemCache::Key(input, "tracktype: 0;");
+	BOOST_CHECK(key!=SystemCache::Key(input, "tracktype: 1;"));
+	BOOST_CHECK(key!=SystemCache::Key(input + " ", "tracktype: 0;"));
+	BOOST_CHECK_EQUAL(key, SystemCache::Key(input, "tracktype: 0;"));
+
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	SystemCache cache(directory);
+	BOOST_CHECK(!cache.Load(key));
+
+	unsigned num_builds = 0;
+	auto build = [&](){
+		++num_builds;
+		auto sys = parsing::classic::FastSystemParser().Parse(input);
+		sys.Differentiate();
+		return sys;
+	};
+
+	auto built = cache.GetOrBuild(key, build);
+	auto loaded = cache.GetOrBuild(key, build);
+	BOOST_CHECK_EQUAL(num_builds, 1);
+	BOOST_CHECK(cache.Contains(key));
+
+	Vec<mpfr> values(2);
+	values << mpfr("0.25","-1.5"), mpfr("1.75","0.5");
+
+	BOOST_CHECK_EQUAL(loaded.Eval(values), built.Eval(values));
+	BOOST_CHECK_EQUAL(loaded.Jacobian(values), built.Jacobian(values));
+
+	cache.Erase(key);
+	BOOST_CHECK(!cache.Contains(key));
+	boost::filesystem::remove_all(directory);
+}
+
+
+namespace version_zero{
+
+	// stand-ins writing what System and StraightLineProgram wrote to archives at class version 0, before compile_patches_into_slp_, sparse_ and NumberOf::Patches were added.
+
+	struct NumberOf{
+		size_t Functions{0};
+		size_t Variables{0};
+		size_t Jacobian{0};
+		size_t TimeDeriv{0};
+
+		template <typename Archive>
+		void serialize(Archive& ar, const unsigned version) {
+			ar & Functions;
+			ar & Variables;
+			ar & Jacobian;
+			ar & TimeDeriv;
+		}
+	};
+
+	struct StraightLineProgram{
+		unsigned precision_ = 16;
+		bool has_path_variable_ = false;
+
+		NumberOf number_of_;
+		bertini::StraightLineProgram::OutputLocations output_locations_;
+		bertini::StraightLineProgram::InputLocations input_locations_;
+
+		std::vector<dbl_complex> memory_dbl_;
+		std::vector<mpfr_complex> memory_mpfr_;
+		std::vector<int> integers_;
+
+		std::vector<size_t> instructions_;
+		std::vector< std::pair<std::shared_ptr<const node::Node>,size_t> > true_values_of_numbers_;
+
+		bool is_evaluated_ = false;
+
+		template <typename Archive>
+		void serialize(Archive& ar, const unsigned version) {
+			ar & precision_;
+			ar & has_path_variable_;
+
+			ar & number_of_;
+			ar & output_locations_;
+			ar & input_locations_;
+
+			ar & memory_dbl_;
+			ar & memory_mpfr_;
+			ar & integers_;
+
+			ar & instructions_;
+			ar & true_values_of_numbers_;
+
+			ar & is_evaluated_;
+		}
+	};
+
+	struct System{
+		VariableGroup ungrouped_variables_;
+		std::vector< VariableGroup > variable_groups_;
+		std::vector< VariableGroup > hom_variable_groups_;
+		VariableGroup homogenizing_variables_;
+
+		bool have_path_variable_ = false;
+		Var path_variable_;
+
+		VariableGroup implicit_parameters_;
+		std::vector< std::shared_ptr<node::Function> > explicit_parameters_;
+		std::vector< std::shared_ptr<node::Function> > constant_subfunctions_;
+		std::vector< std::shared_ptr<node::Function> > subfunctions_;
+		std::vector< std::shared_ptr<node::Function> > functions_;
+
+		Patch patch_;
+		bool is_patched_ = false;
+
+		bool assume_uniform_precision_ = false;
+		EvalMethod eval_method_ = EvalMethod::SLP;
+		DerivMethod deriv_method_ = DerivMethod::JacobianNode;
+		bool auto_simplify_ = true;
+
+		unsigned precision_ = 16;
+
+		bool is_differentiated_ = false;
+		std::vector< std::shared_ptr<node::Jacobian> > jacobian_;
+		std::vector< std::shared_ptr<node::Node> > space_derivatives_;
+		std::vector< std::shared_ptr<node::Node> > time_derivatives_;
+
+		StraightLineProgram slp_;
+
+		std::vector< VariableGroupType > time_order_of_variable_groups_;
+
+		bool have_ordering_ = false;
+		VariableGroup variable_ordering_;
+
+		template <typename Archive>
+		void serialize(Archive& ar, const unsigned version) {
+			ar & ungrouped_variables_;
+			ar & variable_groups_;
+			ar & hom_variable_groups_;
+			ar & homogenizing_variables_;
+			ar & have_path_variable_;
+			ar & path_variable_;
+			ar & implicit_parameters_;
+			ar & explicit_parameters_;
+			ar & constant_subfunctions_;
+			ar & subfunctions_;
+			ar & functions_;
+			ar & patch_;
+			ar & is_patched_;
+			ar & assume_uniform_precision_;
+			ar & eval_method_;
+			ar & deriv_method_;
+			ar & auto_simplify_;
+			ar & precision_;
+			ar & is_differentiated_;
+			ar & jacobian_;
+			ar & space_derivatives_;
+			ar & time_derivatives_;
+			ar & slp_;
+			ar & time_order_of_variable_groups_;
+			ar & have_ordering_;
+			ar & variable_ordering_;
+		}
+	};
+}
+
+
+/**
+\class bertini::System
+\test \b system_load_version_zero_archive_with_slp Loads a System archive written at class version 0, whose SLP's counts have no Patches, and checks it is read through to its end, with the patches not compiled into the SLP.
+*/
+BOOST_AUTO_TEST_CASE(system_load_version_zero_archive_with_slp)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	version_zero::System old;
+	old.slp_.number_of_.Functions = 2;
+	old.slp_.number_of_.Variables = 2;
+	old.slp_.number_of_.Jacobian = 4;
+	old.slp_.number_of_.TimeDeriv = 2;
+	old.slp_.output_locations_.Functions = 5;
+	old.slp_.output_locations_.Jacobian = 7;
+	old.slp_.output_locations_.TimeDeriv = 11;
+	old.slp_.instructions_ = {3, 1, 4, 1, 5};
+	old.time_order_of_variable_groups_ = {VariableGroupType::Ungrouped};
+	const int end_marker = 42;
+
+	std::stringstream archive;
+	{
+		boost::archive::text_oarchive oa(archive);
+		oa << old;
+		oa << end_marker;
+	}
+
+	System sys;
+	sys.SetCompilePatchesIntoSLP(true);
+	int loaded_marker = 0;
+	{
+		boost::archive::text_iarchive ia(archive);
+		BOOST_REQUIRE_NO_THROW(ia >> sys);
+		BOOST_REQUIRE_NO_THROW(ia >> loaded_marker);
+	}
+
+	BOOST_CHECK_EQUAL(loaded_marker, end_marker);
+	BOOST_CHECK_EQUAL(sys.precision(), 16);
+	BOOST_CHECK(!sys.IsCompilingPatchesIntoSLP());
+	BOOST_CHECK_EQUAL(sys.NumNaturalFunctions(), 0);
+}
+
+
+/**
+\class bertini::System
+\test \b simplify_derivatives_replaces_their_roots Simplifying the derivatives of a system goes through their handles, replaces their roots, and leaves the Jacobian unchanged, for both methods of differentiation.
+*/
+BOOST_AUTO_TEST_CASE(simplify_derivatives_replaces_their_roots)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	for (auto method : {DerivMethod::Derivatives, DerivMethod::JacobianNode})
+	{
+		Var x = Variable::Make("x");
+		Var y = Variable::Make("y");
+
+		System sys;
+		sys.AddFunction(3*x + y);
+		sys.AddFunction(x*x*y - 2*x*y + pow(y,2));
+		sys.AddVariableGroup(VariableGroup{x,y});
+		sys.SetEvalMethod(EvalMethod::FunctionTree);
+		sys.SetDerivMethod(method);
+		sys.DontAutoSimplify();
+		sys.Differentiate();
+
+		Vec<dbl> values(2);
+		values << dbl(0.3,-1.2), dbl(-0.7,0.4);
+		Mat<dbl> J_before = sys.Jacobian(values);
+
+		// d/dx (3x+y) is a sum until simplified, and then just 3
+		std::shared_ptr<node::Handle> d_dx;
+		if (method==DerivMethod::Derivatives)
+		{
+			d_dx = std::dynamic_pointer_cast<node::Handle>(sys.GetSpaceDerivatives()[0]);
+			BOOST_REQUIRE(d_dx);
+			BOOST_CHECK(!std::dynamic_pointer_cast<node::Number>(d_dx->EntryNode()));
+		}
+
+		sys.SimplifyDerivatives();
+
+		auto const& stats = sys.SimplificationStats();
+		auto num_handles = method==DerivMethod::Derivatives ? 4u : 2u;
+		BOOST_CHECK(stats.nodes_visited > num_handles);
+		BOOST_CHECK(stats.rewrites > 0);
+
+		if (method==DerivMethod::Derivatives)
+			BOOST_CHECK(std::dynamic_pointer_cast<node::Number>(d_dx->EntryNode()));
+
+		Mat<dbl> J_after = sys.Jacobian(values);
+		BOOST_CHECK_SMALL((J_after-J_before).norm(), 1e-14);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1111,6 +1111,92 @@ BOOST_AUTO_TEST_CASE(compute_cauchy_approximation_cycle_num_1)
 
 
 
+/**
+	Doubling the samples around a loop keeps the ones already tracked, and adds one halfway between each, still on the path.  The approximation from the doubled samples is at least as good.
+*/
+BOOST_AUTO_TEST_CASE(double_cauchy_samples_cycle_num_1)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t"); 
+
+	sys.AddFunction((x-1)*(1-t) + (x+1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_preferences;
+	bertini::tracking::NewtonConfig newton_preferences;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	bertini::TimeCont<BCT> cauchy_times; 
+	bertini::SampCont<BCT> cauchy_samples; 
+
+
+	auto time = ComplexFromString("0.1");
+	Vec<BCT> sample(1);
+	auto origin = BCT(0,0);
+	Vec<BCT> x_origin(1);
+
+	cauchy_times.push_back(time);
+	sample << ComplexFromString("7.999999999999999e-01", "2.168404344971009e-19"); // 
+	cauchy_samples.push_back(sample);
+	x_origin << BCT(1,0);
+
+	TestedEGType my_endgame(tracker);
+
+	my_endgame.SetCauchyTimes(cauchy_times);
+	my_endgame.SetCauchySamples(cauchy_samples);
+
+	my_endgame.CircleTrack(origin);
+	my_endgame.CycleNumber(1);
+
+	auto num_samples = my_endgame.SamplesPerLoop();
+	auto old_samples = my_endgame.GetCauchySamples<BCT>();
+
+	auto code = my_endgame.DoubleCauchySamples(origin);
+	BOOST_CHECK(code==SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(my_endgame.SamplesPerLoop(), 2*num_samples);
+	BOOST_CHECK_EQUAL(my_endgame.GetCauchySamples<BCT>().size(), 2*num_samples+1);
+	BOOST_CHECK_EQUAL(my_endgame.GetCauchyTimes<BCT>().size(), 2*num_samples+1);
+
+	for (unsigned ii = 0; ii <= num_samples; ++ii)
+		BOOST_CHECK_EQUAL(my_endgame.GetCauchySamples<BCT>()[2*ii](0), old_samples[ii](0));
+
+	for (unsigned ii = 0; ii < num_samples; ++ii)
+	{ // on the path, x = 1-2t
+		auto const& t_new = my_endgame.GetCauchyTimes<BCT>()[2*ii+1];
+		auto const& x_new = my_endgame.GetCauchySamples<BCT>()[2*ii+1](0);
+		BOOST_CHECK(abs(x_new - (BCT(1)-BCT(2)*t_new)) < 1e-5);
+		BOOST_CHECK(abs(abs(t_new) - abs(time)) < 1e-10);
+	}
+
+	Vec<BCT> doubled_approx;
+	my_endgame.ComputeCauchyApproximationOfXAtT0<BCT>(doubled_approx);
+	BOOST_CHECK((doubled_approx - x_origin).template lpNorm<Eigen::Infinity>() < 1e-5);
+
+	BOOST_CHECK(my_endgame.EstimateQuadratureError<BCT>() < 1e-5);
+	BOOST_CHECK_EQUAL(my_endgame.CoefficientCycleNumber(), 1);
+}// end double_cauchy_samples_cycle_num_1
+
+
+
 /**
 	This test case uses all the sample points collected by CircleTrack around a non-singular point to compute an extrapolant using the 
 	trapezoidal rule for integration. CircleTrack is called twice to close up the loop. 
@@ -1494,6 +1580,186 @@ BOOST_AUTO_TEST_CASE(cauchy_endgame_test_cycle_num_greater_than_1_base)
 
 
 
+/**
+	As above, but starting each circle with the stepsize adapted on the previous one.
+*/
+BOOST_AUTO_TEST_CASE(cauchy_endgame_reusing_circle_stepsize)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t"); 
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_preferences;
+	bertini::tracking::NewtonConfig newton_preferences;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+
+	BCT time = ComplexFromString("0.1");
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01"); // 
+
+	Vec<BCT> x_origin(1);
+	x_origin << BCT(1,0);
+
+	EndgameConfig endgame_settings;
+	CauchyConfig cauchy_settings;
+	SecurityConfig security_settings;
+	cauchy_settings.reuse_circle_stepsize = true;
+
+	TestedEGType my_endgame(tracker,cauchy_settings,endgame_settings,security_settings);
+	auto cauchy_endgame_success = my_endgame.Run(time,sample);
+
+	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).template lpNorm<Eigen::Infinity>() < 1e-5);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+}// end cauchy_endgame_reusing_circle_stepsize
+
+
+
+/**
+	As above, but doubling the samples until the trapezoid rule resolves the Cauchy integral, and accepting its estimated error.
+*/
+BOOST_AUTO_TEST_CASE(cauchy_endgame_adaptive_quadrature)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t"); 
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_preferences;
+	bertini::tracking::NewtonConfig newton_preferences;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+
+	BCT time = ComplexFromString("0.1");
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01"); // 
+
+	Vec<BCT> x_origin(1);
+	x_origin << BCT(1,0);
+
+	EndgameConfig endgame_settings;
+	CauchyConfig cauchy_settings;
+	SecurityConfig security_settings;
+	cauchy_settings.adaptive_quadrature = true;
+
+	TestedEGType my_endgame(tracker,cauchy_settings,endgame_settings,security_settings);
+	auto cauchy_endgame_success = my_endgame.Run(time,sample);
+
+	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).template lpNorm<Eigen::Infinity>() < 1e-5);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK(my_endgame.SamplesPerLoop() >= endgame_settings.num_sample_points);
+	BOOST_CHECK(my_endgame.SamplesPerLoop() <= endgame_settings.num_sample_points << cauchy_settings.max_sample_doublings);
+}// end cauchy_endgame_adaptive_quadrature
+
+
+
+/**
+	On the same singular path, the discrete Fourier coefficients of the samples decay geometrically well before successive circles agree to the final tolerance, so the adaptive quadrature ends the endgame on a larger circle, after fewer radius reductions, and estimates the cycle number from the coefficients.
+*/
+BOOST_AUTO_TEST_CASE(cauchy_endgame_adaptive_quadrature_fewer_radius_reductions)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t"); 
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_preferences;
+	bertini::tracking::NewtonConfig newton_preferences;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+
+	BCT time = ComplexFromString("0.1");
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01"); // 
+
+	Vec<BCT> x_origin(1);
+	x_origin << BCT(1,0);
+
+	EndgameConfig endgame_settings;
+	CauchyConfig cauchy_settings;
+	SecurityConfig security_settings;
+
+	TestedEGType default_endgame(tracker,cauchy_settings,endgame_settings,security_settings);
+	auto default_success = default_endgame.Run(time,sample);
+	BOOST_CHECK(default_success==SuccessCode::Success);
+
+	cauchy_settings.adaptive_quadrature = true;
+	TestedEGType adaptive_endgame(tracker,cauchy_settings,endgame_settings,security_settings);
+	auto adaptive_success = adaptive_endgame.Run(time,sample);
+	BOOST_CHECK(adaptive_success==SuccessCode::Success);
+
+	BOOST_CHECK((adaptive_endgame.FinalApproximation<BCT>() - x_origin).template lpNorm<Eigen::Infinity>() < 1e-5);
+	BOOST_CHECK_EQUAL(adaptive_endgame.CycleNumber(), 2);
+	BOOST_CHECK_EQUAL(adaptive_endgame.CoefficientCycleNumber(), 2);
+	BOOST_CHECK(adaptive_endgame.CoefficientDecayRatio() < 1);
+	BOOST_CHECK(adaptive_endgame.QuadratureErrorEstimate() < endgame_settings.final_tolerance);
+
+	// each radius reduction halves the distance to the target time
+	BOOST_CHECK(abs(adaptive_endgame.LatestTime()) > abs(default_endgame.LatestTime()));
+}// end cauchy_endgame_adaptive_quadrature_fewer_radius_reductions
+
+
+
 
 /**
 	Full blown test to see if we can actually find the non singular point at the origin. This example has multiple variables. 
@@ -1814,6 +2080,61 @@ BOOST_AUTO_TEST_CASE(griewank_osborne)
 }//end compute griewank osborne
 
 
+/**
+The path of x*t - 1 = 0 goes to infinity like 1/t.  With early divergence detection on, the endgame should stop as soon as the norms of its samples grow at that rate, well before the norm reaches max_norm, and report the rate.
+*/
+BOOST_AUTO_TEST_CASE(early_divergence_detection)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = Variable::Make("x"), t = Variable::Make("t");
+
+	sys.AddFunction(x*t - 1);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_settings;
+	bertini::tracking::NewtonConfig newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                1e-6,
+                1e5,
+                stepping_settings,
+                newton_settings);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	BCT current_time = ComplexFromString(".1");
+	Vec<BCT> current_space(1);
+	current_space << BCT(10);
+
+	bertini::endgame::EndgameConfig endgame_settings;
+	bertini::endgame::SecurityConfig security_settings;
+	security_settings.early_divergence_detection = true;
+
+	TestedEGType my_endgame(tracker,endgame_settings,security_settings);
+	auto code = my_endgame.Run(current_time,current_space);
+
+	BOOST_CHECK(code==SuccessCode::GoingToInfinity);
+	BOOST_CHECK(abs(my_endgame.DivergenceRate()-1) < 1e-3);
+	BOOST_CHECK(my_endgame.template GetPSEGSamples<BCT>().back().template lpNorm<Eigen::Infinity>() < security_settings.max_norm);
+
+	security_settings.early_divergence_detection = false;
+	TestedEGType undetecting_endgame(tracker,endgame_settings,security_settings);
+	code = undetecting_endgame.Run(current_time,current_space);
+
+	BOOST_CHECK(code!=SuccessCode::GoingToInfinity);
+	BOOST_CHECK_EQUAL(undetecting_endgame.DivergenceRate(), 0);
+}
+
+
 /**
 In this example we take a decoupled system, homogenize and patch it. Track to endgame boundary and then run our endgame on the space
 values we have. 
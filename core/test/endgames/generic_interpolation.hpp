@@ -227,4 +227,52 @@ BOOST_AUTO_TEST_CASE(eight_degree_univariate_advanced_gets_better)
 	BOOST_CHECK((second_approx - correct).norm() < 1e-10);	
 	BOOST_CHECK((third_approx - correct).norm() < 1e-10);
 
-}//end hermite test case
\ No newline at end of file
+}//end hermite test case
+
+
+
+/**
+An interpolator reused for different data reproduces a cubic exactly from any two or more nodes, and gives the same results as fresh ones.
+*/
+BOOST_AUTO_TEST_CASE( reused_hermite_interpolator )
+{
+	DefaultPrecision(ambient_precision);
+
+	unsigned int num_samples = 2;
+
+	auto f = [](BCT const& t){ return t*t*t + t + BCT(5);};
+	auto df = [](BCT const& t){ return BCT(3)*t*t + BCT(1);};
+
+	TimeCont<BCT> times; 
+	SampCont<BCT> samples, derivatives;
+
+	Vec<BCT> sample(1), derivative(1);
+	for (auto time_string : {"1", "2", "0.5"})
+	{
+		BCT time = ComplexFromString(time_string);
+		times.push_back(time);
+		sample << f(time);
+		samples.push_back(sample);
+		derivative << df(time);
+		derivatives.push_back(derivative);
+	}
+
+	BCT target_time = ComplexFromString("0.3","0.2");
+
+	HermiteInterpolator<BCT> interpolator;
+	auto from_back = HermiteInterpolateAndSolve(interpolator, target_time, num_samples, times, samples, derivatives);
+	auto from_front = HermiteInterpolateAndSolve(interpolator, target_time, num_samples, times, samples, derivatives, ContStart::Front);
+	auto all_three = HermiteInterpolateAndSolve(interpolator, target_time, 3, times, samples, derivatives);
+
+	BOOST_CHECK_EQUAL(interpolator.NumNodes(), 3);
+
+	Vec<BCT> correct(1);
+	correct << f(target_time);
+	BOOST_CHECK((from_back - correct).norm() < 1e-10);
+	BOOST_CHECK((from_front - correct).norm() < 1e-10);
+	BOOST_CHECK((all_three - correct).norm() < 1e-10);
+
+	BOOST_CHECK((from_back - HermiteInterpolateAndSolve(target_time, num_samples, times, samples, derivatives)).norm() < 1e-20);
+	BOOST_CHECK((from_front - HermiteInterpolateAndSolve(target_time, num_samples, times, samples, derivatives, ContStart::Front)).norm() < 1e-20);
+	BOOST_CHECK((all_three - HermiteInterpolateAndSolve(target_time, 3, times, samples, derivatives)).norm() < 1e-20);
+}
@@ -421,6 +421,79 @@ BOOST_AUTO_TEST_CASE(compute_cycle_number)
 
 
 
+/**
+Derivatives are kept as samples are added, and only the new samples get one computed.  For x = t^2, dx/dt = 2t.
+*/
+BOOST_AUTO_TEST_CASE(derivatives_computed_for_new_samples)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t");
+	sys.AddFunction( x - pow(t,2) );
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_settings;
+	bertini::tracking::NewtonConfig newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_settings,
+                newton_settings);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	bertini::TimeCont<BCT> times; 
+	bertini::SampCont<BCT> samples; 
+
+	Vec<BCT> sample(1);
+	for (auto time_string : {".1", ".05", ".025"})
+	{
+		BCT time = ComplexFromString(time_string);
+		times.push_back(time);
+		sample << time*time;
+		samples.push_back(sample);
+	}
+
+	bertini::endgame::PowerSeriesConfig power_series_settings;
+
+	TestedEGType my_endgame(tracker,power_series_settings);
+	my_endgame.SetTimes(times);
+	my_endgame.SetSamples(samples);
+
+	my_endgame.ComputeAllDerivatives<BCT>();
+	BOOST_CHECK_EQUAL(my_endgame.GetDerivatives<BCT>().size(), 3);
+
+	auto advance_success = my_endgame.AdvanceTime<BCT>(BCT(0));
+	BOOST_CHECK(advance_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(my_endgame.GetDerivatives<BCT>().size(), 3);
+	BOOST_CHECK_EQUAL(my_endgame.GetSamples<BCT>().size(), 4);
+
+	my_endgame.ComputeAllDerivatives<BCT>();
+	const auto& derivatives = my_endgame.GetDerivatives<BCT>();
+	const auto& new_times = my_endgame.GetTimes<BCT>();
+	BOOST_CHECK_EQUAL(derivatives.size(), 4);
+	for (unsigned ii = 0; ii < derivatives.size(); ++ii)
+		BOOST_CHECK(abs(derivatives[ii](0) - BCT(2)*new_times[ii]) < 1e-10);
+
+	// replacing the samples replaces the derivatives
+	my_endgame.SetSamples(samples);
+	my_endgame.SetTimes(times);
+	BOOST_CHECK(my_endgame.GetDerivatives<BCT>().empty());
+} // end derivatives_computed_for_new_samples
+
+
+
 
 /**
 Compute approximation at origin using three sample points. 
@@ -1104,6 +1177,61 @@ BOOST_AUTO_TEST_CASE(griewank_osborne)
 
 
 
+/**
+The path of x*t - 1 = 0 goes to infinity like 1/t.  With early divergence detection on, the endgame should stop as soon as the norms of its samples grow at that rate, well before the norm reaches max_norm, and report the rate.
+*/
+BOOST_AUTO_TEST_CASE(early_divergence_detection)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = Variable::Make("x"), t = Variable::Make("t");
+
+	sys.AddFunction(x*t - 1);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	bertini::tracking::SteppingConfig stepping_settings;
+	bertini::tracking::NewtonConfig newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                1e-6,
+                1e5,
+                stepping_settings,
+                newton_settings);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	BCT current_time = ComplexFromString(".1");
+	Vec<BCT> current_space(1);
+	current_space << BCT(10);
+
+	bertini::endgame::EndgameConfig endgame_settings;
+	bertini::endgame::SecurityConfig security_settings;
+	security_settings.early_divergence_detection = true;
+
+	TestedEGType my_endgame(tracker,endgame_settings,security_settings);
+	auto code = my_endgame.Run(current_time,current_space);
+
+	BOOST_CHECK(code==SuccessCode::GoingToInfinity);
+	BOOST_CHECK(abs(my_endgame.DivergenceRate()-1) < 1e-3);
+	BOOST_CHECK(my_endgame.template GetSamples<BCT>().back().template lpNorm<Eigen::Infinity>() < security_settings.max_norm);
+
+	security_settings.early_divergence_detection = false;
+	TestedEGType undetecting_endgame(tracker,endgame_settings,security_settings);
+	code = undetecting_endgame.Run(current_time,current_space);
+
+	BOOST_CHECK(code!=SuccessCode::GoingToInfinity);
+	BOOST_CHECK_EQUAL(undetecting_endgame.DivergenceRate(), 0);
+}
+
+
 /**
 In this example we take a decoupled system, homogenize and patch it. Track to endgame boundary and then run our endgame on the space
 values we have. 
@@ -31,6 +31,8 @@
 #include "bertini2/endgames.hpp"
 #include "bertini2/system/start_systems.hpp"
 #include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <thread>
 #include "bertini2/nag_algorithms/output.hpp"
 
 
@@ -190,4 +192,509 @@ BOOST_AUTO_TEST_CASE(reference_managed_systems_GO)
 }
 
 
+/**
+Counts the paths a tracker starts.
+*/
+template<class ObservedTrackerT>
+class PathStartCounter : public bertini::Observer<ObservedTrackerT>
+{
+	using EmitterT = typename bertini::tracking::TrackerTraits<ObservedTrackerT>::EventEmitterType;
+
+public:
+	PathStartCounter()
+	{
+		this->template SubscribeTo<bertini::tracking::TrackingStarted<EmitterT>>();
+	}
+
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		if (dynamic_cast<const bertini::tracking::TrackingStarted<EmitterT>*>(&e))
+			++num_paths_started;
+	}
+
+	unsigned num_paths_started = 0;
+};
+
+
+/**
+Tracking with several threads gives each thread but the first its own tracker and endgame, and should find the same solutions as tracking with one.  The first thread tracks with the algorithm's own, so observers attached to it see some paths.
+*/
+BOOST_AUTO_TEST_CASE(threaded_solve_agrees_with_serial)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	using ZeroDimT = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>;
+
+	ZeroDimT serial(sys);
+	serial.DefaultSetup();
+	serial.Solve();
+
+	// a fresh solver, so that results it failed to write can't be left over from the serial solve
+	ZeroDimT threaded(sys);
+	threaded.DefaultSetup();
+	threaded.SetNumThreads(4);
+
+	PathStartCounter<TrackerT> counter;
+	threaded.GetTracker().AddObserver(counter);
+	threaded.Solve();
+	BOOST_CHECK(counter.num_paths_started > 0);
+
+	auto const& serial_solutions = serial.FinalSolutions();
+	auto const& serial_metadata = serial.FinalSolutionMetadata();
+
+	BOOST_CHECK_EQUAL(threaded.NumPaths(), serial_solutions.size());
+	BOOST_CHECK_EQUAL(threaded.NumSuccessfulPaths(), serial.NumSuccessfulPaths());
+
+	for (decltype(serial_solutions.size()) ii{0}; ii < serial_solutions.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(threaded.FinalSolutionMetadata()[ii].path_index, ii);
+		BOOST_CHECK(threaded.FinalSolutionMetadata()[ii].endgame_success==serial_metadata[ii].endgame_success);
+		if (serial_metadata[ii].endgame_success==SuccessCode::Success)
+			BOOST_CHECK_SMALL((threaded.FinalSolutions()[ii] - serial_solutions[ii]).norm(), 1e-8);
+	}
+}
+
+
+/**
+The homotopy ZeroDim forms is patched, and compiles its patches into its SLP, so its function values and Jacobian are viewed straight out of the SLP's memory while tracking, rather than copied.
+*/
+BOOST_AUTO_TEST_CASE(homotopy_views_its_slp)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+
+	auto const& homotopy = zd.Homotopy();
+	BOOST_CHECK(homotopy.IsPatched());
+	BOOST_CHECK(homotopy.IsCompilingPatchesIntoSLP());
+
+	// the views map the SLP's memory, rather than a buffer copied into, exactly when contexts are supported
+	BOOST_REQUIRE(homotopy.SupportsEvaluationContexts());
+
+	Vec<dbl> x = RandomOfUnits<dbl>(homotopy.NumVariables());
+	dbl t(0.3, 0.1);
+
+	Mat<dbl> J = homotopy.Jacobian(x, t);
+	homotopy.SetAndReset<dbl>(x, t);
+	BOOST_CHECK_SMALL((Mat<dbl>(homotopy.JacobianView<dbl>()) - J).norm(), 1e-12);
+}
+
+
+/**
+As ZeroDim sets it up by default, its homotopy can be shared between threads, each evaluating through its own context, without cloning it.
+*/
+BOOST_AUTO_TEST_CASE(homotopy_shares_through_contexts)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+
+	auto const& homotopy = zd.Homotopy();
+
+	std::vector<Vec<dbl>> points{RandomOfUnits<dbl>(homotopy.NumVariables()), RandomOfUnits<dbl>(homotopy.NumVariables())};
+	std::vector<dbl> times{dbl(0.3, 0.1), dbl(0.8, -0.2)};
+
+	std::vector<Vec<dbl>> f, dt;
+	std::vector<Mat<dbl>> J;
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+	{
+		f.push_back(homotopy.Eval(points[ii], times[ii]));
+		J.push_back(homotopy.Jacobian(points[ii], times[ii]));
+		dt.push_back(homotopy.TimeDerivative(points[ii], times[ii]));
+	}
+
+	BOOST_REQUIRE(homotopy.SupportsEvaluationContexts());
+	std::vector<System::EvaluationContext> contexts;
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+		contexts.push_back(homotopy.MakeEvaluationContext());
+
+	std::vector<std::thread> threads;
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+		threads.emplace_back([&, ii]{ homotopy.Evaluate(contexts[ii], points[ii], times[ii]); });
+	for (auto& thread : threads)
+		thread.join();
+
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+	{
+		BOOST_CHECK_SMALL((homotopy.FunctionValuesView<dbl>(contexts[ii]) - f[ii]).norm(), 1e-12);
+		BOOST_CHECK_SMALL((homotopy.JacobianView<dbl>(contexts[ii]) - J[ii]).norm(), 1e-12);
+		BOOST_CHECK_SMALL((homotopy.TimeDerivativeView<dbl>(contexts[ii]) - dt[ii]).norm(), 1e-12);
+	}
+}
+
+
+
+
+/**
+Each path is written to raw_data once its results are final, from whichever thread ran it, and what's written is what would be written after the solve.  Pipelined, paths re-tracked after their endgames ran must still be written only once.
+*/
+BOOST_AUTO_TEST_CASE(threaded_solve_streams_raw_data)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	using ZeroDimT = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>;
+	using Classic = algorithm::output::Classic<ZeroDimT>;
+
+	for (bool pipelined : {false, true})
+	{
+		ZeroDimT zd(sys);
+		zd.DefaultSetup();
+		zd.SetNumThreads(4);
+
+		auto zero_dim_config = zd.Get<algorithm::ZeroDimConfig<dbl>>();
+		zero_dim_config.pipelined = pipelined;
+		zd.Set(zero_dim_config);
+
+		std::stringstream streamed;
+		algorithm::output::ClassicRawDataStreamer<ZeroDimT> streamer(streamed);
+		zd.AddObserver(streamer);
+		zd.Solve();
+
+		unsigned num_endgames_run = 0;
+		for (decltype(zd.NumPaths()) ii{0}; ii < zd.NumPaths(); ++ii)
+		{
+			if (zd.FinalSolutionMetadata()[ii].endgame_success == SuccessCode::NeverStarted)
+				continue;
+			++num_endgames_run;
+
+			std::stringstream block;
+			Classic::EndPointMDRaw(ii, block, zd, "\n\n");
+			BOOST_CHECK(streamed.str().find(block.str())!=std::string::npos);
+		}
+		BOOST_CHECK(num_endgames_run > 0);
+
+		std::stringstream after;
+		for (decltype(zd.NumPaths()) ii{0}; ii < zd.NumPaths(); ++ii)
+			if (zd.FinalSolutionMetadata()[ii].endgame_success != SuccessCode::NeverStarted)
+				Classic::EndPointMDRaw(ii, after, zd, "\n\n");
+		BOOST_CHECK_EQUAL(streamed.str().size(), after.str().size());
+	}
+}
+
+
+/**
+Until it has seen enough endgames, the model predicts a path's endgame takes as long as tracking it to the boundary did.  Once fit, it should pick up on what actually makes endgames long, here the conditioning.
+*/
+BOOST_AUTO_TEST_CASE(path_cost_model_learns_from_endgames)
+{
+	using namespace bertini::algorithm;
+
+	PathCostModel model;
+
+	PathCost well_conditioned, ill_conditioned;
+	well_conditioned.seconds_before_endgame = 2e-3;
+	ill_conditioned.seconds_before_endgame = 1e-3;
+	ill_conditioned.condition_number = 1e8;
+
+	BOOST_CHECK(!model.IsFitted());
+	BOOST_CHECK(model.Predict(well_conditioned) > model.Predict(ill_conditioned));
+
+	for (unsigned ii = 0; ii < 20; ++ii)
+	{
+		PathCost path;
+		path.num_steps = 50 + ii;
+		path.seconds_before_endgame = 1e-3 * (1 + (ii%3));
+		path.condition_number = std::pow(10., ii%9);
+		model.Observe(path, 1e-4 * path.condition_number);
+	}
+
+	BOOST_CHECK(model.IsFitted());
+	BOOST_CHECK_EQUAL(model.NumObservations(), 20);
+	BOOST_CHECK(model.Predict(ill_conditioned) > 100*model.Predict(well_conditioned));
+}
+
+
+BOOST_AUTO_TEST_CASE(longest_first_path_queue)
+{
+	using namespace bertini::algorithm;
+
+	PathCostModel model;
+	std::vector<PathCost> costs(4);
+	costs[0].seconds_before_endgame = 2;
+	costs[1].seconds_before_endgame = 8;
+	costs[2].seconds_before_endgame = 1;
+	costs[3].seconds_before_endgame = 4;
+
+	LongestFirstPathQueue queue(costs, model);
+	for (SolnIndT ii = 0; ii < costs.size(); ++ii)
+		queue.Push(ii);
+
+	BOOST_CHECK_EQUAL(queue.Size(), 4);
+
+	std::vector<SolnIndT> order;
+	SolnIndT path;
+	while (queue.Pop(path))
+	{
+		costs[path].seconds_during_endgame = costs[path].seconds_before_endgame;
+		queue.Done(path);
+		order.push_back(path);
+	}
+
+	BOOST_CHECK((order==std::vector<SolnIndT>{1, 3, 0, 2}));
+	BOOST_CHECK_EQUAL(model.NumObservations(), 4);
+}
+
+
+/**
+When the model refits, the waiting paths are reordered by their costs as they were when pushed, not as they are now, since a path being re-tracked writes its cost without the queue's lock.
+*/
+BOOST_AUTO_TEST_CASE(longest_first_path_queue_refits_from_pushed_costs)
+{
+	using namespace bertini::algorithm;
+
+	// one observation short of fitting, endgames taking as long as tracking to the boundary
+	PathCostModel model;
+	for (unsigned ii = 0; ii < 11; ++ii)
+	{
+		PathCost path;
+		path.seconds_before_endgame = std::pow(2., ii);
+		model.Observe(path, path.seconds_before_endgame);
+	}
+	BOOST_REQUIRE(!model.IsFitted());
+
+	std::vector<PathCost> costs(4);
+	costs[0].seconds_before_endgame = 2;
+	costs[1].seconds_before_endgame = 8;
+	costs[2].seconds_before_endgame = 1;
+	costs[3].seconds_before_endgame = 4;
+
+	LongestFirstPathQueue queue(costs, model);
+	for (SolnIndT ii = 0; ii < costs.size(); ++ii)
+		queue.Push(ii);
+
+	SolnIndT path;
+	BOOST_REQUIRE(queue.Pop(path));
+	BOOST_CHECK_EQUAL(path, 1);
+
+	// path 3 starts re-tracking, and its cost is written
+	costs[3].seconds_before_endgame = 1e-6;
+
+	costs[path].seconds_during_endgame = costs[path].seconds_before_endgame;
+	queue.Done(path);
+	BOOST_REQUIRE(model.IsFitted());
+
+	std::vector<SolnIndT> order;
+	while (queue.Pop(path))
+		order.push_back(path);
+
+	BOOST_CHECK((order==std::vector<SolnIndT>{3, 0, 2}));
+}
+
+
+/**
+Each path's step count, conditioning and times are recorded, and the endgames run with several threads teach the model.
+*/
+BOOST_AUTO_TEST_CASE(threaded_solve_records_path_costs)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+
+	zd.DefaultSetup();
+	zd.SetNumThreads(4);
+	zd.Solve();
+
+	unsigned long long num_endgames = 0;
+	for (decltype(zd.NumPaths()) ii{0}; ii < zd.NumPaths(); ++ii)
+	{
+		auto const& cost = zd.PathCosts()[ii];
+		BOOST_CHECK(cost.num_steps > 0);
+		BOOST_CHECK(cost.seconds_before_endgame > 0);
+
+		if (zd.FinalSolutionMetadata()[ii].pre_endgame_success==SuccessCode::Success)
+		{
+			BOOST_CHECK(cost.seconds_during_endgame > 0);
+			++num_endgames;
+		}
+	}
+
+	BOOST_CHECK_EQUAL(zd.GetEndgameCostModel().NumObservations(), num_endgames);
+}
+
+
+
+/**
+Paths arriving at the endgame boundary one at a time should be found to cross the same paths as checking them all at once.
+*/
+BOOST_AUTO_TEST_CASE(incremental_midpath_check_agrees_with_check)
+{
+	using namespace bertini;
+	using namespace bertini::algorithm;
+	using dbl = std::complex<double>;
+	using BoundaryT = EGBoundaryMetaData<dbl>;
+
+	auto sys = system::Precon::GriewankOsborn();
+	start_system::TotalDegree start(sys);
+
+	std::vector<Vec<dbl>> points(4, Vec<dbl>(2));
+	points[0] << dbl(1,1), dbl(1,0);
+	points[1] << dbl(2,0), dbl(0,3);
+	points[2] << dbl(1,1+1e-9), dbl(1,0);
+	points[3] << dbl(2,0), dbl(1e-9,3);
+
+	SolnCont<BoundaryT> boundary_data;
+	for (auto const& p : points)
+		boundary_data.push_back(BoundaryT(p, SuccessCode::Success, 0.01));
+
+	MidpathChecker<double, dbl, BoundaryT> all_at_once(MidPathConfig{});
+	BOOST_CHECK(!all_at_once.Check(boundary_data, start));
+
+	MidpathChecker<double, dbl, BoundaryT> incremental(MidPathConfig{});
+	incremental.StartIncremental();
+
+	std::vector<std::vector<unsigned long long>> crossed;
+	for (unsigned long long ii = 0; ii < boundary_data.size(); ++ii)
+		crossed.push_back(incremental.Arrive(ii, boundary_data, start));
+
+	BOOST_CHECK(!incremental.Passed());
+	BOOST_CHECK(crossed[0].empty());
+	BOOST_CHECK(crossed[1].empty());
+	BOOST_CHECK((crossed[2]==std::vector<unsigned long long>{0}));
+	BOOST_CHECK((crossed[3]==std::vector<unsigned long long>{1}));
+
+	BOOST_CHECK_EQUAL(incremental.GetCrossedPaths().size(), all_at_once.GetCrossedPaths().size());
+	for (unsigned long long ii = 0; ii < boundary_data.size(); ++ii)
+		BOOST_CHECK_EQUAL(incremental.ShouldRerun(ii), all_at_once.ShouldRerun(ii));
+
+	// a departed path isn't compared with
+	incremental.Depart(0);
+	BOOST_CHECK(incremental.Arrive(2, boundary_data, start).empty());
+}
+
+
+/**
+A path asked to re-track after its endgame is queued loses that endgame, and gets one after the re-track.  One asked while its endgame runs is re-tracked after.
+*/
+BOOST_AUTO_TEST_CASE(path_pipeline_retracks)
+{
+	using namespace bertini::algorithm;
+	using Task = PathPipeline::Task;
+	using Stage = PathPipeline::Stage;
+
+	PathCostModel model;
+	std::vector<PathCost> costs(3);
+	PathPipeline pipeline(3, 2, costs, model);
+
+	auto no_retracks = [](PathPipeline const&){ return std::vector<SolnIndT>(); };
+
+	Task task;
+	BOOST_REQUIRE(pipeline.Next(task));
+	BOOST_CHECK(task.path==0 && task.stage==Stage::TrackToBoundary && task.num_retracks==0);
+	pipeline.Finish(task, true, no_retracks);
+
+	BOOST_REQUIRE(pipeline.Next(task));
+	BOOST_CHECK(task.path==1 && task.stage==Stage::TrackToBoundary);
+	pipeline.Finish(task, true, [](PathPipeline const& p){ BOOST_CHECK(p.CanRetrack(0)); return std::vector<SolnIndT>{0}; });
+
+	// re-tracks come before first tracks, which come before endgames
+	Task retrack_0, track_2, endgame_1;
+	BOOST_REQUIRE(pipeline.Next(retrack_0));
+	BOOST_CHECK(retrack_0.path==0 && retrack_0.stage==Stage::TrackToBoundary && retrack_0.num_retracks==1);
+	BOOST_REQUIRE(pipeline.Next(track_2));
+	BOOST_CHECK(track_2.path==2 && track_2.stage==Stage::TrackToBoundary);
+	BOOST_REQUIRE(pipeline.Next(endgame_1));
+	BOOST_CHECK(endgame_1.path==1 && endgame_1.stage==Stage::Endgame); // path 0's endgame was dropped for its re-track
+
+	pipeline.Finish(retrack_0, true, no_retracks);
+	// path 2 fails, but crosses path 1, whose endgame is running.  path 2 could still be crossed, so it isn't final
+	auto finished = pipeline.Finish(track_2, false, [](PathPipeline const&){ return std::vector<SolnIndT>{1}; });
+	BOOST_CHECK(finished.final_paths.empty());
+
+	BOOST_REQUIRE(pipeline.Next(task));
+	BOOST_CHECK(task.path==0 && task.stage==Stage::Endgame);
+	finished = pipeline.Finish(task, false, no_retracks);
+	BOOST_CHECK(finished.final_paths.empty());
+
+	pipeline.Finish(endgame_1, false, no_retracks);
+
+	// with path 1 back at the boundary, tracking is over, so the done paths are final
+	BOOST_REQUIRE(pipeline.Next(task));
+	BOOST_CHECK(task.path==1 && task.stage==Stage::TrackToBoundary && task.num_retracks==1);
+	finished = pipeline.Finish(task, true, no_retracks);
+	BOOST_CHECK(finished.final_paths==std::vector<SolnIndT>({0,2}));
+	BOOST_CHECK(finished.checked_paths==std::vector<SolnIndT>({0,2}));
+
+	BOOST_REQUIRE(pipeline.Next(task));
+	BOOST_CHECK(task.path==1 && task.stage==Stage::Endgame);
+	finished = pipeline.Finish(task, false, no_retracks);
+	BOOST_CHECK(finished.final_paths==std::vector<SolnIndT>({1}));
+	BOOST_CHECK(finished.checked_paths==std::vector<SolnIndT>({1}));
+
+	BOOST_CHECK(!pipeline.Next(task));
+	BOOST_CHECK_EQUAL(model.NumObservations(), 3);
+}
+
+
+/**
+The pipelined solve should find the same solutions as the phased one, with one thread or several.
+*/
+BOOST_AUTO_TEST_CASE(pipelined_solve_agrees_with_phased)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	using ZeroDimT = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>;
+
+	ZeroDimT phased(sys);
+	phased.DefaultSetup();
+	phased.Solve();
+
+	auto const& phased_solutions = phased.FinalSolutions();
+	auto const& phased_metadata = phased.FinalSolutionMetadata();
+
+	for (unsigned num_threads : {1u, 4u})
+	{
+		// a fresh solver for each, so that results it failed to write can't be left over from another solve
+		ZeroDimT pipelined(sys);
+		pipelined.DefaultSetup();
+
+		auto zero_dim_config = pipelined.Get<algorithm::ZeroDimConfig<dbl>>();
+		zero_dim_config.pipelined = true;
+		pipelined.Set(zero_dim_config);
+		pipelined.SetNumThreads(num_threads);
+
+		pipelined.Solve();
+
+		// the endgames don't get to leave their setting on the algorithm's tracker
+		BOOST_CHECK(pipelined.GetTracker().ReinitializesInitialStepSize());
+
+		BOOST_CHECK_EQUAL(pipelined.NumPaths(), phased_solutions.size());
+		BOOST_CHECK_EQUAL(pipelined.NumSuccessfulPaths(), phased.NumSuccessfulPaths());
+
+		for (decltype(phased_solutions.size()) ii{0}; ii < phased_solutions.size(); ++ii)
+		{
+			auto const& metadata = pipelined.FinalSolutionMetadata()[ii];
+			BOOST_CHECK_EQUAL(metadata.path_index, ii);
+			BOOST_CHECK(metadata.pre_endgame_success==phased_metadata[ii].pre_endgame_success);
+
+			// an endgame the pipeline dropped, or failed to re-run, would show up here
+			if (phased_metadata[ii].endgame_success==SuccessCode::Success)
+			{
+				BOOST_CHECK(metadata.endgame_success==SuccessCode::Success);
+				BOOST_CHECK_SMALL((pipelined.FinalSolutions()[ii] - phased_solutions[ii]).norm(), 1e-8);
+			}
+		}
+	}
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
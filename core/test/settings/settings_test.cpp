@@ -104,6 +104,20 @@ BOOST_AUTO_TEST_CASE(read_mptype)
 	
 	BOOST_CHECK(parsed && iter == end);
 	BOOST_CHECK(type == PrecisionType::Adaptive);
+
+
+	for (auto const& mptype : {std::make_pair("0", PrecisionType::Fixed), std::make_pair("1", PrecisionType::FixedMultiple), std::make_pair("2", PrecisionType::Adaptive)})
+	{
+		inputfile = ParseInputFile(std::string("Config \n MPType: ") + mptype.first + "; \n end;  \n iNpUt % \n  \n variable x; \n ENd;");
+		configStr = inputfile.Config();
+		iter = configStr.begin();
+		end = configStr.end();
+
+		parsed = phrase_parse(iter, end, parser,boost::spirit::ascii::space, type);
+
+		BOOST_CHECK(parsed && iter == end);
+		BOOST_CHECK(type == mptype.second);
+	}
 }
 
 
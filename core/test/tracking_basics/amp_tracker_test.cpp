@@ -25,6 +25,10 @@
 
 
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 #include <boost/test/unit_test.hpp>
 #include "bertini2/system/start_systems.hpp"
 #include "bertini2/trackers/tracker.hpp"
@@ -82,6 +86,156 @@ BOOST_AUTO_TEST_CASE(mindigits)
 	BOOST_CHECK_EQUAL(digits, 8);
 }
 
+
+BOOST_AUTO_TEST_CASE(arithmetic_cost_model_interpolates)
+{
+	using namespace bertini::tracking;
+
+	ArithmeticCostModel model;
+	BOOST_CHECK(!model.IsCalibrated());
+	BOOST_CHECK_EQUAL(model.Cost(50), ArithmeticCost(50));
+
+	model.Set(20, 4);
+	model.Set(40, 8);
+
+	BOOST_CHECK(model.IsCalibrated());
+	BOOST_CHECK_EQUAL(model.Cost(bertini::DoublePrecision()), 1);
+	BOOST_CHECK_CLOSE(model.Cost(30), 6, 1e-10);
+	BOOST_CHECK_CLOSE(model.Cost(60), 12, 1e-10);
+
+	std::stringstream stream;
+	stream << model;
+	ArithmeticCostModel read_back;
+	stream >> read_back;
+	BOOST_CHECK(read_back==model);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimize_tracking_cost_uses_cost_model)
+{
+	DefaultPrecision(30);
+	using namespace bertini::tracking;
+
+	unsigned new_precision;
+	mpfr_float new_stepsize;
+
+	MinimizeTrackingCost(new_precision, new_stepsize,
+	                     bertini::DoublePrecision(), mpfr_float("1e-10"),
+	                     60, mpfr_float("0.1"),
+	                     10, 2);
+	BOOST_CHECK_EQUAL(new_precision, bertini::DoublePrecision());
+
+	// if multiple precision were cheaper than double, it should be chosen
+	ArithmeticCostModel cheap_multiple_precision;
+	for (unsigned p = bertini::LowestMultiplePrecision(); p <= 60; p += bertini::PrecisionIncrement())
+		cheap_multiple_precision.Set(p, 0.5);
+
+	MinimizeTrackingCost(new_precision, new_stepsize,
+	                     bertini::DoublePrecision(), mpfr_float("1e-10"),
+	                     60, mpfr_float("0.1"),
+	                     10, 2, 0, cheap_multiple_precision);
+	BOOST_CHECK_EQUAL(new_precision, bertini::LowestMultiplePrecision());
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_calibrated_arithmetic_cost)
+{
+	DefaultPrecision(30);
+	using namespace bertini::tracking;
+
+	Var x = Variable::Make("x");
+	Var y = Variable::Make("y");
+	Var t = Variable::Make("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+	AMP.maximum_precision = 100;
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	tracker.Setup(Predictor::RK4,
+	              1e-5,
+	              1e5,
+	              SteppingConfig(),
+	              NewtonConfig());
+	tracker.PrecisionSetup(AMP);
+
+	const std::string cache_file = "amp_tracker_test_arithmetic_cost.txt";
+	std::remove(cache_file.c_str());
+
+	tracker.CalibrateArithmeticCost(cache_file);
+
+	auto const& cost = tracker.Get<PrecConf>().arithmetic_cost;
+	BOOST_CHECK(cost.IsCalibrated());
+	BOOST_CHECK_EQUAL(cost.Table().begin()->first, bertini::LowestMultiplePrecision());
+	BOOST_CHECK_EQUAL(cost.Table().rbegin()->first, 100);
+	for (auto const& entry : cost.Table())
+		BOOST_CHECK(entry.second > 0);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_CHECK_EQUAL(sys.precision(), 30);
+
+	// a second calibration reads the cache.  replace the measured costs in it with a sentinel table, which a recalibration would not reproduce.
+	std::string cache_key;
+	{
+		std::ifstream in(cache_file);
+		std::getline(in, cache_key);
+	}
+
+	ArithmeticCostModel sentinel;
+	sentinel.Set(bertini::LowestMultiplePrecision(), 1.2345678901234567);
+	sentinel.Set(100, 98.76543210987654);
+	{
+		std::ofstream out(cache_file);
+		out << cache_key << "\n" << sentinel;
+	}
+
+	tracker.CalibrateArithmeticCost(cache_file);
+	BOOST_CHECK(tracker.Get<PrecConf>().arithmetic_cost==sentinel);
+
+	// a different system of the same size doesn't share the cached cost
+	System other_sys;
+	other_sys.AddFunction(x-2*t);
+	other_sys.AddFunction(pow(y,3)-x);
+	other_sys.AddPathVariable(t);
+	other_sys.AddVariableGroup(v);
+
+	bertini::tracking::AMPTracker other_tracker(other_sys);
+	other_tracker.Setup(Predictor::RK4,
+	              1e-5,
+	              1e5,
+	              SteppingConfig(),
+	              NewtonConfig());
+	other_tracker.PrecisionSetup(AMP);
+	BOOST_CHECK(bertini::tracking::ArithmeticCostKey(other_sys, 100)!=cache_key);
+
+	other_tracker.CalibrateArithmeticCost(cache_file);
+	BOOST_CHECK(other_tracker.Get<PrecConf>().arithmetic_cost!=sentinel);
+	std::remove(cache_file.c_str());
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+
+	Vec<mpfr> y_start(2);
+	y_start << mpfr(1), mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	auto code = tracker.TrackPath(y_end, t_start, t_end, y_start);
+
+	BOOST_CHECK(code==bertini::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),2);
+	BOOST_CHECK(abs(y_end(0)-mpfr(0)) < 1e-5);
+}
+
 BOOST_AUTO_TEST_CASE(AMP_tracker_track_linear)
 {
 	DefaultPrecision(30);
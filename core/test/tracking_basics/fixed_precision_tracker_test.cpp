@@ -24,6 +24,7 @@
 
 
 
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 #include "bertini2/system/start_systems.hpp"
 #include "bertini2/trackers/fixed_precision_tracker.hpp"
@@ -158,6 +159,191 @@ BOOST_AUTO_TEST_CASE(multiple_100_tracker_track_linear)
 
 
 
+/**
+Records the time and stepsize at the start of each step, and the time and stepsize after each successful one.
+*/
+template<class ObservedTrackerT>
+class StepRecorder : public bertini::Observer<ObservedTrackerT>
+{
+	using EmitterT = typename bertini::tracking::TrackerTraits<ObservedTrackerT>::EventEmitterType;
+
+public:
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		if (auto p = dynamic_cast<const bertini::tracking::NewStep<EmitterT>*>(&e))
+			step_starts.emplace_back(p->Get().CurrentTime(), p->Get().CurrentStepsize());
+		else if (auto p = dynamic_cast<const bertini::tracking::SuccessfulStep<EmitterT>*>(&e))
+			successes.emplace_back(p->Get().CurrentTime(), p->Get().CurrentStepsize());
+	}
+
+	std::vector<std::pair<dbl, double>> step_starts;
+	std::vector<std::pair<dbl, double>> successes;
+};
+
+
+/**
+Tracking around a contour carries the stepsize from one side to the next, and counts the steps on all sides, but limits the number of steps on each side separately.
+*/
+BOOST_AUTO_TEST_CASE(double_tracker_track_contour)
+{
+	DefaultPrecision(100);
+	using namespace bertini::tracking;
+
+	Var y = Variable::Make("y");
+	Var t = Variable::Make("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(pow(y,2)-t-2);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+
+	// start small, so the stepsize has to grow on the first side
+	SteppingConfig stepping_preferences;
+	stepping_preferences.initial_step_size = SteppingConfig::T(1)/SteppingConfig::T(1000);
+	NewtonConfig newton_preferences;
+
+	tracker.Setup(Predictor::Euler,
+	              1e-8,
+	              1e5,
+	              stepping_preferences,
+	              newton_preferences);
+
+	StepRecorder<DoublePrecisionTracker> recorder;
+	tracker.AddObserver(recorder);
+
+	dbl t_start(0.5);
+	std::vector<dbl> waypoints{dbl(0,0.5), dbl(-0.5), dbl(0,-0.5), dbl(0.5)};
+
+	Vec<dbl> y_start(1);
+	y_start << sqrt(dbl(2.5));
+
+	std::vector<Vec<dbl>> samples;
+	auto code = tracker.TrackContour(samples, t_start, waypoints, y_start);
+	BOOST_REQUIRE(code==bertini::SuccessCode::Success);
+	BOOST_REQUIRE_EQUAL(samples.size(), waypoints.size());
+	for (unsigned ii = 0; ii < waypoints.size(); ++ii)
+		BOOST_CHECK(abs(samples[ii](0) - sqrt(waypoints[ii]+2.)) < 1e-6);
+
+	// every step taken on every side is counted
+	BOOST_CHECK_EQUAL(tracker.NumTotalStepsTaken(), recorder.step_starts.size());
+
+	// the successful steps on each side, and the stepsize at the end of each
+	std::vector<unsigned> side_steps(waypoints.size(), 0);
+	std::vector<double> side_end_stepsizes(waypoints.size());
+	unsigned side = 0;
+	for (auto const& step : recorder.successes)
+	{
+		++side_steps[side];
+		if (abs(step.first - waypoints[side]) < 1e-12)
+			side_end_stepsizes[side++] = step.second;
+	}
+	BOOST_REQUIRE_EQUAL(side, waypoints.size());
+
+	// each side after the first starts with the stepsize the previous one ended with
+	side = 1;
+	for (auto const& step : recorder.step_starts)
+		if (side < waypoints.size() && abs(step.first - waypoints[side-1]) < 1e-12)
+		{
+			BOOST_CHECK_EQUAL(step.second, side_end_stepsizes[side-1]);
+			++side;
+		}
+	BOOST_CHECK_EQUAL(side, waypoints.size());
+	BOOST_CHECK(side_end_stepsizes[0] > 10*double(stepping_preferences.initial_step_size));
+
+	// a limit on the number of steps big enough for each side, but not for the whole contour
+	auto max_side_steps = *std::max_element(side_steps.begin(), side_steps.end());
+	BOOST_REQUIRE(recorder.successes.size() > max_side_steps);
+
+	stepping_preferences.max_num_steps = max_side_steps;
+	tracker.Setup(Predictor::Euler,
+	              1e-8,
+	              1e5,
+	              stepping_preferences,
+	              newton_preferences);
+
+	std::vector<Vec<dbl>> limited_samples;
+	code = tracker.TrackContour(limited_samples, t_start, waypoints, y_start);
+	BOOST_CHECK(code==bertini::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(limited_samples.size(), waypoints.size());
+}
+
+
+
+/**
+x = 1/t goes to infinity at t = 0 at rate 1.  Told that paths approach t = 0, the tracker should stop it well before the truncation threshold, once its norm has grown past the minimum at a settled rate.
+*/
+BOOST_AUTO_TEST_CASE(double_tracker_detects_divergence)
+{
+	DefaultPrecision(100);
+	using namespace bertini::tracking;
+
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddFunction(x*t-1);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+
+	SteppingConfig stepping_preferences;
+	NewtonConfig newton_preferences;
+
+	tracker.Setup(Predictor::RK4,
+	              1e-8,
+	              1e5,
+	              stepping_preferences,
+	              newton_preferences);
+
+	dbl t_start(1);
+	dbl t_end(1e-4);
+
+	Vec<dbl> x_start(1);
+	x_start << dbl(1);
+
+	Vec<dbl> x_end;
+
+	// off by default, so the path makes it to the end time, short of the truncation threshold
+	auto code = tracker.TrackPath(x_end, t_start, t_end, x_start);
+	BOOST_CHECK(code==bertini::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.DivergenceRate(), 0);
+
+	DivergenceConfig divergence;
+	divergence.early_divergence_detection = true;
+	tracker.SetDivergenceDetection(divergence, dbl(0));
+
+	code = tracker.TrackPath(x_end, t_start, t_end, x_start);
+	BOOST_CHECK(code==bertini::SuccessCode::GoingToInfinity);
+	BOOST_CHECK(abs(tracker.DivergenceRate()-1) < 1e-3);
+	BOOST_CHECK(abs(tracker.CurrentTime()) > 1e-3);
+
+	// a path to a finite point isn't stopped
+	Var y = Variable::Make("y");
+	System finite_sys;
+	VariableGroup w{y};
+	finite_sys.AddFunction(y-t);
+	finite_sys.AddPathVariable(t);
+	finite_sys.AddVariableGroup(w);
+
+	DoublePrecisionTracker finite_tracker(finite_sys);
+	finite_tracker.Setup(Predictor::RK4,
+	                     1e-8,
+	                     1e5,
+	                     stepping_preferences,
+	                     newton_preferences);
+	finite_tracker.SetDivergenceDetection(divergence, dbl(0));
+
+	code = finite_tracker.TrackPath(x_end, t_start, t_end, x_start);
+	BOOST_CHECK(code==bertini::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(finite_tracker.DivergenceRate(), 0);
+}
 
 
 
@@ -787,6 +787,192 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		BOOST_CHECK(success_code==bertini::SuccessCode::FailedToConverge);
 	}
 
+
+	/**
+	Factoring the Jacobian in double and refining in multiple precision should give the same Newton step as factoring in multiple precision, to the working precision.
+	*/
+	BOOST_AUTO_TEST_CASE(circle_line_mixed_precision_refinement_mp)
+	{
+		DefaultPrecision(100);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = Variable::Make("x"), y = Variable::Make("y"), t = Variable::Make("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		double tracking_tolerance = 1e-100;
+		unsigned max_num_newton_iterations = 1;
+		unsigned min_num_newton_iterations = 1;
+
+		NewtonCorrector full_precision(sys), mixed_precision(sys);
+		bertini::tracking::NewtonConfig newton_settings;
+		newton_settings.mixed_precision_refinement = true;
+		mixed_precision.Settings(newton_settings);
+
+		Vec<mpfr> full_result, mixed_result;
+		full_precision.Correct(full_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		mixed_precision.Correct(mixed_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		BOOST_CHECK_EQUAL(mixed_precision.NumRefinementFallbacks(), 0);
+		BOOST_CHECK_EQUAL(mixed_result.size(),2);
+		for (unsigned ii = 0; ii < mixed_result.size(); ++ii)
+			BOOST_CHECK(abs(mixed_result(ii)-full_result(ii)) < mpfr_float("1e-90"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+
+	/**
+	Refinement need only find the Newton step to the tracking tolerance, not to the working precision, so a loose tolerance in high precision should take fewer refinements, and still agree with the full precision step to the tolerance.
+	*/
+	BOOST_AUTO_TEST_CASE(mixed_precision_refinement_stops_at_tracking_tolerance_mp)
+	{
+		DefaultPrecision(100);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = Variable::Make("x"), y = Variable::Make("y"), t = Variable::Make("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		unsigned max_num_newton_iterations = 1;
+		unsigned min_num_newton_iterations = 1;
+
+		NewtonCorrector full_precision(sys), loose(sys), tight(sys);
+		bertini::tracking::NewtonConfig newton_settings;
+		newton_settings.mixed_precision_refinement = true;
+		loose.Settings(newton_settings);
+		tight.Settings(newton_settings);
+
+		Vec<mpfr> full_result, loose_result, tight_result;
+		full_precision.Correct(full_result, sys, current_space, current_time, 1e-100, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		loose.Correct(loose_result, sys, current_space, current_time, 1e-10, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		tight.Correct(tight_result, sys, current_space, current_time, 1e-100, min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		BOOST_CHECK_EQUAL(loose.NumRefinementFallbacks(), 0);
+		BOOST_CHECK_EQUAL(tight.NumRefinementFallbacks(), 0);
+		BOOST_CHECK(loose.NumRefinements() < tight.NumRefinements());
+		for (unsigned ii = 0; ii < loose_result.size(); ++ii)
+			BOOST_CHECK(abs(loose_result(ii)-full_result(ii)) < mpfr_float("1e-11"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+
+	/**
+	A Jacobian which is singular once rounded to double, but not in the working precision, must be factored in full precision.
+	*/
+	BOOST_AUTO_TEST_CASE(mixed_precision_refinement_falls_back_mp)
+	{
+		DefaultPrecision(50);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("0.3","0.1"), mpfr("0.6","-0.2");
+		mpfr current_time("0.5");
+		
+		bertini::System sys;
+		Var x = Variable::Make("x"), y = Variable::Make("y"), t = Variable::Make("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( x + y - t );
+		sys.AddFunction( x + mpfr("1.00000000000000000001")*y - t );
+		
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+
+		double tracking_tolerance = 1e1;
+		unsigned max_num_newton_iterations = 1;
+		unsigned min_num_newton_iterations = 1;
+
+		NewtonCorrector corrector(sys);
+		bertini::tracking::NewtonConfig newton_settings;
+		newton_settings.mixed_precision_refinement = true;
+		corrector.Settings(newton_settings);
+
+		Vec<mpfr> newton_correction_result;
+		auto success_code = corrector.Correct(newton_correction_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations);
+
+		BOOST_CHECK(success_code==bertini::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(corrector.NumRefinementFallbacks(), 1);
+		BOOST_CHECK(abs(newton_correction_result(0)-mpfr("0.5")) < mpfr_float("1e-25"));
+		BOOST_CHECK(abs(newton_correction_result(1)) < mpfr_float("1e-25"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+
+	/**
+	An estimate of the norm of the inverse of the Jacobian shared with the corrector, as the tracker shares the predictor's, should be used for the AMP criteria of the next correction only.
+	*/
+	BOOST_AUTO_TEST_CASE(shared_norm_J_inverse_used_once_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = Variable::Make("x"), y = Variable::Make("y"), t = Variable::Make("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		double tracking_tolerance = 1e-5;
+		unsigned max_num_newton_iterations = 3;
+		unsigned min_num_newton_iterations = 1;
+
+		Vec<mpfr> newton_correction_result;
+
+		NewtonCorrector fresh(sys);
+		auto expected_code = fresh.Correct(newton_correction_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		NewtonCorrector sharing(sys);
+		sharing.ShareNormJInverse(1e300); // far too ill-conditioned for the current precision
+		auto shared_code = sharing.Correct(newton_correction_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		BOOST_CHECK(shared_code==bertini::SuccessCode::HigherPrecisionNecessary);
+
+		auto next_code = sharing.Correct(newton_correction_result, sys, current_space, current_time, tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		BOOST_CHECK(next_code==expected_code);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -229,6 +229,124 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 
 
 
+template<class TrackerT>
+struct SuccessfulStepCounter : public bertini::Observer<TrackerT>
+{
+	SuccessfulStepCounter()
+	{
+		this->template SubscribeTo<bertini::tracking::SuccessfulStep<TrackerT>>();
+	}
+
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++num_observed;
+		if (dynamic_cast<const bertini::tracking::SuccessfulStep<TrackerT>*>(&e))
+			++num_successful;
+	}
+
+	unsigned num_observed = 0;
+	unsigned num_successful = 0;
+};
+
+
+BOOST_AUTO_TEST_CASE(observers_only_receive_subscribed_events)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = Variable::Make("x");
+	Var y = Variable::Make("y");
+	Var t = Variable::Make("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	SteppingConfig stepping_preferences;
+	NewtonConfig newton_preferences;
+
+	tracker.Setup(Predictor::Euler,
+	              	1e-5,
+					1e5,
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	BOOST_CHECK(!tracker.IsObserved<NewStep<AMPTracker>>());
+
+	SuccessfulStepCounter<AMPTracker> counter;
+	tracker.AddObserver(counter);
+
+	BOOST_CHECK(tracker.IsObserved<SuccessfulStep<AMPTracker>>());
+	BOOST_CHECK(!tracker.IsObserved<NewStep<AMPTracker>>());
+	BOOST_CHECK(!tracker.IsObserved<TrackingEvent<AMPTracker>>());
+
+	MinMaxPrecisionRecorder<AMPTracker> recorder;
+	tracker.AddObserver(recorder);
+	BOOST_CHECK(tracker.IsObserved<PrecisionIncreased<AMPTracker>>()); // derived from the subscribed PrecisionChanged
+	BOOST_CHECK(!tracker.IsObserved<PrecisionEvent<AMPTracker>>());
+
+	mpfr t_start(1);
+	mpfr t_end = mpfr(1)/mpfr(2); // stay away from the singular endpoint at 0
+
+	Vec<mpfr> start_point(2);
+	start_point << mpfr(1), mpfr(1);
+
+	Vec<mpfr> end_point;
+
+	auto tracking_success = tracker.TrackPath(end_point, t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==bertini::SuccessCode::Success);
+	BOOST_CHECK(counter.num_successful > 0);
+	BOOST_CHECK_EQUAL(counter.num_observed, counter.num_successful);
+
+	tracker.RemoveObserver(counter);
+	BOOST_CHECK(!tracker.IsObserved<SuccessfulStep<AMPTracker>>());
+}
+
+
+BOOST_AUTO_TEST_CASE(static_observer_list)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = Variable::Make("x");
+	Var t = Variable::Make("t");
+
+	System sys;
+	sys.AddFunction(x-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(VariableGroup{x});
+
+	AMPTracker tracker(sys);
+
+	MinMaxPrecisionRecorder<AMPTracker> recorder;
+	SuccessfulStepCounter<AMPTracker> counter;
+	bertini::StaticObservers<MinMaxPrecisionRecorder<AMPTracker>, SuccessfulStepCounter<AMPTracker>> observers(recorder, counter);
+
+	BOOST_CHECK(!observers.IsObserved<NewStep<AMPTracker>>());
+
+	observers.Emit<PrecisionChanged<AMPTracker>>(tracker, 16, 30);
+	observers.Emit<PrecisionChanged<AMPTracker>>(tracker, 30, 20);
+	observers.Emit<NewStep<AMPTracker>>(tracker);
+	observers.Emit<SuccessfulStep<AMPTracker>>(tracker);
+
+	BOOST_CHECK_EQUAL(recorder.MinPrecision(), 20);
+	BOOST_CHECK_EQUAL(recorder.MaxPrecision(), 30);
+	BOOST_CHECK_EQUAL(counter.num_observed, 1);
+}
+
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -40,7 +40,8 @@ template<typename ObsT>
 struct ObserverWrapper : ObsT, wrapper<ObsT>
 {
 
-	void Observe(AnyEvent const& e) { this->get_override("Observe")(e);}
+	// observed objects may be running with the GIL released, possibly on another thread
+	void Observe(AnyEvent const& e) { ScopedGILAcquire gil; this->get_override("Observe")(e);}
 	
 }; // re: ObserverWrapper
 
@@ -62,4 +62,41 @@ using namespace boost::python;
 using mpfr_float = bertini::mpfr_float;
 using mpfr_complex = bertini::mpfr_complex;
 
+
+namespace bertini{
+	namespace python{
+
+/**
+ Releases the GIL for the lifetime of the object, so that long-running C++ work doesn't block other Python threads.  Nothing touching Python objects may happen while one of these is alive.
+ */
+class ScopedGILRelease
+{
+public:
+	ScopedGILRelease() : state_(PyEval_SaveThread()) {}
+	~ScopedGILRelease() { PyEval_RestoreThread(state_); }
+
+	ScopedGILRelease(ScopedGILRelease const&) = delete;
+	ScopedGILRelease& operator=(ScopedGILRelease const&) = delete;
+private:
+	PyThreadState* state_;
+};
+
+
+/**
+ Acquires the GIL for the lifetime of the object, from whatever thread we're on, for calling back into Python from C++ which may be running with the GIL released.
+ */
+class ScopedGILAcquire
+{
+public:
+	ScopedGILAcquire() : state_(PyGILState_Ensure()) {}
+	~ScopedGILAcquire() { PyGILState_Release(state_); }
+
+	ScopedGILAcquire(ScopedGILAcquire const&) = delete;
+	ScopedGILAcquire& operator=(ScopedGILAcquire const&) = delete;
+private:
+	PyGILState_STATE state_;
+};
+
+}} // namespaces
+
 #endif
@@ -40,11 +40,14 @@
 #include <bertini2/system/system.hpp>
 #include <bertini2/system/start_systems.hpp>
 
+#include <optional>
+
 
 
 
 
 #include "python_common.hpp"
+#include "eigenpy_interaction.hpp"
 
 
 namespace bertini{
@@ -57,6 +60,9 @@ namespace bertini{
 		
 		using dbl = std::complex<double>;
 		using mpfr = bertini::mpfr_complex;
+
+		// the layout of a C-contiguous numpy array, so that one can be passed in without a copy
+		template<typename T> using RowMat = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 		
 		
 		
@@ -174,6 +180,22 @@ namespace bertini{
 				return &SystemBaseT::template Jacobian<T>;
 			};
 
+			/**
+			 Evaluate the system and its Jacobian at each row of a [n, num_variables] complex128 array, in double precision, returning a tuple of numpy arrays (values [n, num_functions], jacobians [n, num_functions, num_variables]).
+
+			 The GIL is released during evaluation.  If the system is evaluated by an SLP, the rows are split among num_threads threads, each with its own evaluation context, and the results are written straight into the returned arrays.  Otherwise the points are evaluated serially through the system itself.
+			 */
+			static
+			tuple EvalMany(SystemBaseT const& self, Eigen::Ref<const RowMat<dbl>> const& points, std::optional<dbl> const& time, unsigned num_threads);
+
+			static
+			tuple eval_many_wrap(SystemBaseT const& self, Eigen::Ref<const RowMat<dbl>> points, unsigned num_threads){
+				return EvalMany(self, points, std::nullopt, num_threads);}
+
+			static
+			tuple eval_many_at_time_wrap(SystemBaseT const& self, Eigen::Ref<const RowMat<dbl>> points, dbl const& time, unsigned num_threads){
+				return EvalMany(self, points, time, num_threads);}
+
 			static
 			void rescale_wrap_inplace_mpfr(SystemBaseT const& self, Eigen::Ref<Vec<mpfr>> x){
 				Vec<mpfr> result(x);
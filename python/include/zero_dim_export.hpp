@@ -36,6 +36,10 @@
 
 #include "python_common.hpp"
 
+#include <chrono>
+#include <future>
+#include <memory>
+
 #include <bertini2/endgames.hpp>
 #include <bertini2/nag_algorithms/zero_dim_solve.hpp>
 
@@ -59,6 +63,55 @@ void ExportZeroDim();
 void ExportZDAlgorithms();
 void ExportZDConfigs();
 void ExposeZDMetaData();
+void ExportSolveFuture();
+
+
+
+/**
+ The handle returned by solve_async: a solve running on another thread.
+
+ Holds the algorithm, so it lives at least as long as the solve.  Waiting releases the GIL, so the solve (and any other Python threads) can get on with it.
+
+ The solve can't be cancelled, so destroying an unfinished SolveFuture blocks until the solve finishes, as the Python docstring says.
+ */
+class SolveFuture
+{
+public:
+
+	SolveFuture(std::shared_ptr<void> algorithm, std::shared_future<void> future) : algorithm_(std::move(algorithm)), future_(std::move(future))
+	{}
+
+	~SolveFuture()
+	{
+		// the solve uses the algorithm, so can't be abandoned
+		if (future_.valid() && !Done())
+			Wait();
+	}
+
+	bool Done() const
+	{
+		return future_.wait_for(std::chrono::seconds(0))==std::future_status::ready;
+	}
+
+	void Wait() const
+	{
+		ScopedGILRelease no_gil;
+		future_.wait();
+	}
+
+	/**
+	 Wait for the solve to finish, rethrowing anything it threw.
+	 */
+	void Result() const
+	{
+		Wait();
+		future_.get();
+	}
+
+private:
+	std::shared_ptr<void> algorithm_;
+	std::shared_future<void> future_;
+};
 
 
 template<typename AlgoT>
@@ -91,6 +144,29 @@ class ZDVisitor: public def_visitor<ZDVisitor<AlgoT> >
 		};
 
 
+		static
+		void solve_wrap(AlgoT & self)
+		{
+			ScopedGILRelease no_gil; // solving touches no Python objects, except observers, which take the GIL back themselves
+			self.Solve();
+		}
+
+		static
+		std::shared_ptr<SolveFuture> solve_async_wrap(std::shared_ptr<AlgoT> const& self)
+		{
+			auto const precision = DefaultPrecision();
+			auto const options = mpfr_float::thread_default_variable_precision_options();
+			auto algorithm = self.get();
+
+			auto future = std::async(std::launch::async, [=](){
+				DefaultPrecision(precision);
+				scoped_mpfr_precision_options_this_thread precision_options(options);
+				algorithm->Solve();
+			});
+
+			return std::make_shared<SolveFuture>(self, future.share());
+		}
+
 		// pattern:
 		// returned type.  name.  argument types.
 
@@ -124,6 +124,10 @@ namespace bertini{
 			class_<endgame::SecurityConfig>("Security","Security settings for endgames.  Control things like truncation because estimated root is near infinity",init<>())
 				.def_readwrite("level", &endgame::SecurityConfig::level,"Turns on or off truncation of paths going to infinity during the endgame.  0 is off, 1 is on.")
 				.def_readwrite("max_norm", &endgame::SecurityConfig::max_norm,"If on, the norm at which to truncate a path.")
+				.def_readwrite("early_divergence_detection", &endgame::SecurityConfig::early_divergence_detection,"Whether to end the endgame as soon as the norms of the samples grow like a fixed negative power of the distance to the target time.")
+				.def_readwrite("min_divergence_rate", &endgame::SecurityConfig::min_divergence_rate,"The smallest power of 1/|t-t0| at which the norm must be growing for a path to be declared divergent.")
+				.def_readwrite("divergence_rate_tolerance", &endgame::SecurityConfig::divergence_rate_tolerance,"How much estimates of that power from consecutive samples may differ, relative to the largest.")
+				.def_readwrite("divergence_min_norm", &endgame::SecurityConfig::divergence_min_norm,"The norm the latest sample must exceed for the path to be declared divergent.")
 				;
 
 			class_<endgame::PowerSeriesConfig>("PowerSeriesConfig","Settings specific to the power series endgame for computing singular endpoints",init<>())
@@ -139,6 +143,9 @@ namespace bertini{
 				.def_readwrite("maximum_cauchy_ratio", &endgame::CauchyConfig::maximum_cauchy_ratio)
 				.def_readwrite("num_needed_for_stabilization", &endgame::CauchyConfig::num_needed_for_stabilization,"When running stabilization testing for the cycle number when entering the endgame, this is the number of consecutive points for which the test must pass.")
 				.def_readwrite("fail_safe_maximum_cycle_number", &endgame::CauchyConfig::fail_safe_maximum_cycle_number, "max number of loops before giving up." )
+				.def_readwrite("reuse_circle_stepsize", &endgame::CauchyConfig::reuse_circle_stepsize, "Whether to start each circle with the stepsize adapted on the previous one, scaled by the ratio of their radii, rather than the initial stepsize.")
+				.def_readwrite("adaptive_quadrature", &endgame::CauchyConfig::adaptive_quadrature, "Whether to double the samples around the loops while their discrete Fourier coefficients decay geometrically but don't yet bound the error of their mean by the final tolerance, and to accept an approximation whose coefficients do, without shrinking the circle again.")
+				.def_readwrite("max_sample_doublings", &endgame::CauchyConfig::max_sample_doublings, "With adaptive_quadrature, the most times the samples around one circle are doubled.")
 				;
 			
 		}
@@ -35,6 +35,10 @@
 //  python/system_export.cpp:  Source file for exposing systems to python, including start systems.
 
 #include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 #include "system_export.hpp"
 
 
@@ -74,6 +78,9 @@ namespace bertini{
 			// .def("eval", &eval_wrap_1<mpfr>)
 			// .def("eval", &eval_wrap_1<dbl>)
 
+			.def("eval_many", &eval_many_wrap, (arg("points"), arg("num_threads")=1), "Evaluate the system and its Jacobian in double precision at each row of a [n, num_variables] complex128 array.  Returns a tuple (values [n, num_functions], jacobians [n, num_functions, num_variables]).  Releases the GIL, and uses up to num_threads threads if the system is evaluated by an SLP.  Throws if the system has a path variable.")
+			.def("eval_many_at_time", &eval_many_at_time_wrap, (arg("points"), arg("time"), arg("num_threads")=1), "As eval_many, at a given value of the path variable.  Throws if doesn't use a time variable")
+
 			.def("eval_jacobian", return_Jac0_ptr<dbl>() ,"Evaluate the Jacobian (martix of partial derivatives) of the system, using already-set time and space value.")
 			.def("eval_jacobian", return_Jac0_ptr<mpfr>() ,"Evaluate the Jacobian (martix of partial derivatives) of the system, using already-set time and space value.")
 			.def("eval_jacobian", return_Jac1_ptr<dbl>() ,"Evaluate the Jacobian (martix of partial derivatives) of the system, using space values you pass in to this function")
@@ -162,6 +169,104 @@ namespace bertini{
 		
 		
 		
+		template<typename SystemBaseT>
+		tuple SystemVisitor<SystemBaseT>::EvalMany(SystemBaseT const& self, Eigen::Ref<const RowMat<dbl>> const& points, std::optional<dbl> const& time, unsigned num_threads)
+		{
+			const auto num_points = points.rows();
+			const auto num_functions = self.NumTotalFunctions();
+			const auto num_variables = self.NumVariables();
+
+			if (points.cols()!=num_variables)
+				throw std::runtime_error("eval_many expects one point per row, with as many columns as the system has variables");
+
+			// the results are allocated as numpy arrays, and written in place
+			npy_intp value_shape[2] = {npy_intp(num_points), npy_intp(num_functions)};
+			npy_intp jacobian_shape[3] = {npy_intp(num_points), npy_intp(num_functions), npy_intp(num_variables)};
+			object values(handle<>(reinterpret_cast<PyObject*>(eigenpy::call_PyArray_SimpleNew(2, value_shape, NPY_CDOUBLE))));
+			object jacobians(handle<>(reinterpret_cast<PyObject*>(eigenpy::call_PyArray_SimpleNew(3, jacobian_shape, NPY_CDOUBLE))));
+
+			auto value_data = static_cast<dbl*>(PyArray_DATA(reinterpret_cast<PyArrayObject*>(values.ptr())));
+			auto jacobian_data = static_cast<dbl*>(PyArray_DATA(reinterpret_cast<PyArrayObject*>(jacobians.ptr())));
+
+			auto store = [&](Eigen::Index ii, auto const& f, auto const& J)
+			{
+				Eigen::Map<RowMat<dbl>>(value_data + ii*num_functions, 1, num_functions) = f.transpose();
+				Eigen::Map<RowMat<dbl>>(jacobian_data + ii*num_functions*num_variables, num_functions, num_variables) = J;
+			};
+
+			// differentiates and compiles, if needed, so must be done before threading
+			if (!self.SupportsEvaluationContexts())
+			{
+				// function trees cache values in their nodes, so this can only go one point at a time, and without releasing the GIL
+				for (Eigen::Index ii = 0; ii < num_points; ++ii)
+				{
+					Vec<dbl> x = points.row(ii).transpose();
+					if (time)
+						store(ii, self.template Eval<dbl>(x, *time), self.template Jacobian<dbl>(x, *time));
+					else
+						store(ii, self.template Eval<dbl>(x), self.template Jacobian<dbl>(x));
+				}
+				return make_tuple(values, jacobians);
+			}
+
+			auto first_context = self.MakeEvaluationContext();
+			{
+				ScopedGILRelease no_gil;
+
+				if (num_threads==0)
+					num_threads = std::max(1u, std::thread::hardware_concurrency());
+				num_threads = unsigned(std::min<Eigen::Index>(num_threads, std::max<Eigen::Index>(num_points, 1)));
+
+				std::atomic<Eigen::Index> next_point{0};
+				std::vector<std::exception_ptr> errors(num_threads);
+
+				auto work = [&](unsigned thread_index, typename SystemBaseT::EvaluationContext& context)
+				{
+					try{
+						for (auto ii = next_point++; ii < num_points; ii = next_point++)
+						{
+							if (time)
+								self.Evaluate(context, points.row(ii).transpose(), *time);
+							else
+								self.Evaluate(context, points.row(ii).transpose());
+							store(ii, self.template FunctionValuesView<dbl>(context), self.template JacobianView<dbl>(context));
+						}
+					}
+					catch (...)
+					{
+						errors[thread_index] = std::current_exception();
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned tt = 1; tt < num_threads; ++tt)
+					threads.emplace_back([&, tt](){
+						try{
+							auto context = self.MakeEvaluationContext();
+							work(tt, context);
+						}
+						catch (...)
+						{
+							errors[tt] = std::current_exception();
+						}
+					});
+				work(0, first_context);
+
+				for (auto& t : threads)
+					t.join();
+
+				for (auto const& e : errors)
+					if (e)
+						std::rethrow_exception(e); // the GIL is restored as this unwinds
+			}
+
+			return make_tuple(values, jacobians);
+		}
+
+
+
+
+
 		template<typename SystemBaseT>
 		template<class PyClass>
 		void StartSystemVisitor<SystemBaseT>::visit(PyClass& cl) const
@@ -200,6 +305,9 @@ namespace bertini{
 		void ExportSystem()
 		{
 			
+			// so that eval_many can take C-contiguous arrays of points without copying them
+			eigenpy::enableEigenPySpecific<RowMat<dbl>>();
+
 			// System class
 			class_<System, std::shared_ptr<System> >("System", init<>())
 			.def(SystemVisitor<System>())
@@ -212,7 +320,7 @@ namespace bertini{
 			
 
 
-			def("simplify", &call_simplify, "Perform all possible simplifications.  Has side effects of modifying your functions, if held separately.  Shared nodes between multiple systems may have adverse effects");
+			def("simplify", &call_simplify, "Perform all possible simplifications.  The system's functions and derivatives are replaced by their simplified forms.  Nodes they were made of are left as they were, so expressions held separately, or shared with other systems, are unaffected");
 			
 		}
 
@@ -83,6 +83,7 @@ namespace bertini{
 		{
 			cl
 			.def("precision_setup", &TrackerT::PrecisionSetup)
+			.def("calibrate_arithmetic_cost", &TrackerT::CalibrateArithmeticCost, "Measure the cost of steps at each precision for the tracked system on this machine, and use it to choose precision and stepsize.  Pass a file name to keep the measurement in, or an empty string to not keep it.  Call after `precision_setup`.")
 			.def("precision_preservation", &TrackerT::PrecisionPreservation, "Turn on or off the preservation of precision.  That is, if this is on (true), then the precision of the final point will be the precision of the start point.  Generally, you want to let precision drift, methinks.")
 
 			.def("refine", return_Refine3_ptr<dbl>)
@@ -129,7 +130,7 @@ namespace bertini{
 			.def_readwrite("consecutive_successful_steps_before_stepsize_increase", &tracking::SteppingConfig::consecutive_successful_steps_before_stepsize_increase,"This number of successful steps have to taken consecutively, and then the stepsize is permitted to increase")
 			.def_readwrite("min_num_steps", &tracking::SteppingConfig::min_num_steps, "The minimum number of steps the tracker can take between now and then.  This is useful if you are tracking closely between times, and want to guarantee some number of steps are taken.  Then again, this could be wasteful, too.")
 			.def_readwrite("max_num_steps", &tracking::SteppingConfig::max_num_steps, "The maximum number of steps.  Tracking will die if it tries to take more than this number, sad day.")
-			.def_readwrite("frequency_of_CN_estimation", &tracking::SteppingConfig::frequency_of_CN_estimation, "How frequently the condition number should be updated.  Less frequently is faster (estimation requires an additional linear solve), but may cause precision adjustment to lag behind.")
+			.def_readwrite("frequency_of_CN_estimation", &tracking::SteppingConfig::frequency_of_CN_estimation, "How frequently the condition number should be updated.  Less frequently is faster (each estimate takes at least three linear solves), but may cause precision adjustment to lag behind.")
 			;
 		}
 
@@ -244,6 +245,8 @@ namespace bertini{
 				class_<NewtonConfig, std::shared_ptr<NewtonConfig> >("NewtonConfig", init<>())
 					.def_readwrite("max_num_newton_iterations", &NewtonConfig::max_num_newton_iterations)
 					.def_readwrite("min_num_newton_iterations", &NewtonConfig::min_num_newton_iterations)
+					.def_readwrite("mixed_precision_refinement", &NewtonConfig::mixed_precision_refinement, "In multiple precision, factor the Jacobian in double and recover the working precision by iterative refinement")
+					.def_readwrite("max_refinement_iterations", &NewtonConfig::max_refinement_iterations, "The most refinements of one Newton step before factoring in full precision")
 					;
 				
 				
@@ -40,7 +40,11 @@ template<class PyClass>
 void ZDVisitor<AlgoT>::visit(PyClass& cl) const
 {
 	cl
-	.def("solve", &AlgoT::Solve, "run the zero dim algorithm with currently stored settings")
+	.def("solve", &solve_wrap, "run the zero dim algorithm with currently stored settings.  Releases the GIL while solving.")
+	.def("solve_async", &solve_async_wrap, "start running the zero dim algorithm on another thread, returning a SolveFuture.  Don't touch the algorithm until the future is done.  Dropping an unfinished future blocks until the solve finishes.")
+	.def("set_num_threads", &AlgoT::SetNumThreads, "set the number of threads to track paths with.  0 means as many as the hardware supports.")
+	.def("num_paths", &AlgoT::NumPaths, "the number of paths the algorithm tracks")
+	.def("num_successful_paths", &AlgoT::NumSuccessfulPaths, "the number of paths which were tracked successfully in the most recent solve")
 	.def("get_tracker", GetTrackerMutable(), return_internal_reference<>(), "get a mutable reference to the Tracker being used")
 	.def("get_endgame", GetEndgameMutable(), return_internal_reference<>(), "get a mutable reference to the Endgame being used")
 	.def("solutions", &AlgoT::FinalSolutions, return_internal_reference<>(), "get the solutions at the target time")
@@ -69,6 +73,7 @@ void ExportZeroDim(){
 
 
 	ExportZDConfigs();
+	ExportSolveFuture();
 	ExportZDAlgorithms();
 
 }
@@ -117,6 +122,17 @@ void ExportZDAlgorithms(){
 
 
 
+void ExportSolveFuture()
+{
+	class_<SolveFuture, std::shared_ptr<SolveFuture>, boost::noncopyable>("SolveFuture", "A zero dim solve running on another thread, as returned by solve_async.  The solve can't be cancelled, and uses the algorithm, so when the last reference to an unfinished SolveFuture goes away, deleting it blocks until the solve finishes.  Call result() to see whether the solve raised, rather than dropping the future.", no_init)
+	.def("done", &SolveFuture::Done, "whether the solve has finished, successfully or not.  Doesn't block.")
+	.def("wait", &SolveFuture::Wait, "block until the solve has finished.  Releases the GIL while waiting.")
+	.def("result", &SolveFuture::Result, "block until the solve has finished, re-raising any error it raised.  The solutions are then available from the algorithm.")
+	;
+}
+
+
+
 void ExportZDConfigs()
 {
 	using namespace bertini::algorithm;
@@ -199,6 +215,7 @@ void ExposeSolutionMetaData(std::string const& class_name){
 	.def_readwrite("accuracy_estimate_user_coords",&MDT::accuracy_estimate_user_coords)
 	.def_readwrite("cycle_num",&MDT::cycle_num)
 	.def_readwrite("endgame_success",&MDT::endgame_success, "this is a SuccessCode.  0 means Success.  Anything other than 0 means something happened.")
+	.def_readwrite("divergence_rate",&MDT::divergence_rate, "If the endgame found the path going to infinity, the power of 1/|t| at which its norm grows.  0 otherwise.")
 
 	.def_readwrite("function_residual",&MDT::function_residual)
 
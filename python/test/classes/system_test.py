@@ -231,6 +231,25 @@ class SystemTest(unittest.TestCase):
 
 
 
+    def test_eval_many(self):
+        sys = pb.parse.system('function f1, f2; variable_group x,y,z; f1 = x*y + z; f2 = x^2*y - z*x;')
+        #
+        rng = np.random.default_rng(1)
+        points = rng.standard_normal((50,3)) + 1j*rng.standard_normal((50,3))
+        #
+        for num_threads in (1, 4):
+            values, jacobians = sys.eval_many(points, num_threads)
+            self.assertEqual(values.shape, (50,2))
+            self.assertEqual(jacobians.shape, (50,2,3))
+            #
+            for ii in range(points.shape[0]):
+                e = sys.eval(points[ii])
+                J = sys.eval_jacobian(points[ii])
+                self.assertLessEqual(np.max(np.abs(values[ii] - e)), 1e-13*np.max(np.abs(e)))
+                self.assertLessEqual(np.max(np.abs(jacobians[ii] - J)), 1e-13*np.max(np.abs(J)))
+
+
+
 if __name__ == '__main__':
     unittest.main();
 
@@ -37,5 +37,14 @@ class ZeroDimBasicsTest(unittest.TestCase):
         self.solver.solve()
 
 
+    def test_solve_async(self):
+        future = self.solver.solve_async()
+        future.wait()
+        self.assertTrue(future.done())
+        future.result()
+
+        self.assertEqual(len(self.solver.solutions()), self.solver.num_paths())
+
+
 if __name__ == '__main__':
     unittest.main();
\ No newline at end of file